@@ -78,6 +78,9 @@ seissol::initializers::DynamicRupture        m_dynRup;
 
 GlobalData m_globalDataOnHost;
 GlobalData m_globalDataOnDevice;
+#ifdef USE_COMPRESSED_CELL_MATRICES
+CellMatrixTable m_cellMatrixTable;
+#endif
 
 real* m_fakeDerivatives = nullptr;
 
@@ -94,6 +97,10 @@ void initGlobalData() {
   seissol::initializers::GlobalDataInitializerOnHost::init(m_globalDataOnHost,
                                                            *m_allocator,
                                                            MEMKIND_GLOBAL);
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  seissol::fakeCellMatrixTable(m_cellMatrixTable);
+  m_globalDataOnHost.cellMatrixTable = &m_cellMatrixTable;
+#endif
 
   CompoundGlobalData globalData{};
   globalData.onHost = &m_globalDataOnHost;
@@ -49,8 +49,8 @@ set(DEVICE_ARCH_OPTIONS none sm_60 sm_61 sm_62 sm_70 sm_71 sm_75 sm_80 sm_86 sm_
         dg1 bdw skl Gen8 Gen9 Gen11 Gen12LP)
 set_property(CACHE DEVICE_ARCH PROPERTY STRINGS ${DEVICE_ARCH_OPTIONS})
 
-set(PRECISION "double" CACHE STRING "type of floating point precision, namely: double/single")
-set(PRECISION_OPTIONS single double)
+set(PRECISION "double" CACHE STRING "type of floating point precision, namely: double/single/mixed (single with double fault accumulators)")
+set(PRECISION_OPTIONS single double mixed)
 set_property(CACHE PRECISION PROPERTY STRINGS ${PRECISION_OPTIONS})
 
 
@@ -73,6 +73,8 @@ option(NUMA_AWARE_PINNING "Use libnuma to pin threads to correct NUMA nodes" ON)
 
 option(PROXY_PYBINDING "enable pybind11 for proxy (everything will be compiled with -fPIC)" OFF)
 
+option(COMPRESSED_CELL_MATRICES "Store the material-dependent parts of the cell-local matrices once per material (elastic CPU builds only)" OFF)
+
 set(LOG_LEVEL "warning" CACHE STRING "Log level for the code")
 set(LOG_LEVEL_OPTIONS "debug" "info" "warning" "error")
 set_property(CACHE LOG_LEVEL PROPERTY STRINGS ${LOG_LEVEL_OPTIONS})
@@ -188,6 +190,10 @@ if (WITH_GPU)
     option(PREMULTIPLY_FLUX "Merge device flux matrices (recommended for AMD and Nvidia GPUs)" ${PREMULTIPLY_FLUX_DEFAULT})
 endif()
 
+if (COMPRESSED_CELL_MATRICES AND (WITH_GPU OR NOT ${EQUATIONS} STREQUAL "elastic"))
+    message(FATAL_ERROR "COMPRESSED_CELL_MATRICES is only supported for elastic CPU builds")
+endif()
+
 
 # check compute sub architecture (relevant only for GPU)
 if (NOT ${DEVICE_ARCH} STREQUAL "none")
@@ -230,7 +236,7 @@ endif()
 # derive a byte representation of real numbers
 if ("${PRECISION}" STREQUAL "double")
     set(REAL_SIZE_IN_BYTES 8)
-elseif ("${PRECISION}" STREQUAL "single")
+elseif ("${PRECISION}" STREQUAL "single" OR "${PRECISION}" STREQUAL "mixed")
     set(REAL_SIZE_IN_BYTES 4)
 endif()
 
@@ -259,7 +265,7 @@ string(SUBSTRING ${PRECISION} 0 1 PRECISION_PREFIX)
 if (${PRECISION} STREQUAL "double")
     set(HOST_ARCH_STR "d${HOST_ARCH}")
     set(DEVICE_ARCH_STR "d${DEVICE_ARCH}")
-elseif(${PRECISION} STREQUAL "single")
+elseif(${PRECISION} STREQUAL "single" OR ${PRECISION} STREQUAL "mixed")
     set(HOST_ARCH_STR "s${HOST_ARCH}")
     set(DEVICE_ARCH_STR "s${DEVICE_ARCH}")
 endif()
@@ -92,6 +92,15 @@ def addKernels(generator, aderdg, matricesDir, drQuadRule, targets):
   generator.add('evaluateFaceAlignedDOFSAtPoint',
                 QAtPoint['q'] <= aderdg.Tinv['qp'] * aderdg.Q['lp'] * basisFunctionsAtPoint['l'])
 
+  # Evaluates a block of on-fault receivers of the same face at once; the receivers are
+  # padded with zero basis functions up to the block size
+  numberOfFaceReceiversPerBlock = 4
+  basisFunctionsAtFaceReceivers = Tensor('basisFunctionsAtFaceReceivers', (numberOf3DBasisFunctions, numberOfFaceReceiversPerBlock))
+  QAtFaceReceivers = OptionalDimTensor('QAtFaceReceivers', aderdg.Q.optName(), aderdg.Q.optSize(), aderdg.Q.optPos(), (numberOfQuantities, numberOfFaceReceiversPerBlock))
+
+  generator.add('evaluateFaceAlignedDOFSAtFaceReceivers',
+                QAtFaceReceivers['qk'] <= aderdg.Tinv['qp'] * aderdg.Q['lp'] * basisFunctionsAtFaceReceivers['lk'])
+
   def interpolateQGenerator(i,h):
     return QInterpolated['kp'] <= db.V3mTo2n[i,h][aderdg.t('kl')] * aderdg.Q['lq'] * TinvT['qp']
 
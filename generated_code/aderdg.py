@@ -204,6 +204,21 @@ class ADERDGBase(ABC):
     computeFluxSolverNeighbor = self.AminusT['ij'] <= fluxScale * self.Tinv['ki'] * self.QgodNeighbor['kq'] * self.starMatrix(0)['ql'] * self.T['jl']
     generator.add('computeFluxSolverNeighbor', computeFluxSolverNeighbor)
 
+    # Split of the above kernels for the compressed cell-local matrices: the flux solvers in the
+    # face-aligned frame only depend on the materials and are rotated on the fly.
+    faceAlignedFluxSolver = Tensor('faceAlignedFluxSolver', self.AplusT.shape())
+    computeFaceAlignedFluxSolverLocal = faceAlignedFluxSolver['kl'] <= self.QgodLocal['kq'] * self.starMatrix(0)['ql']
+    generator.add('computeFaceAlignedFluxSolverLocal', computeFaceAlignedFluxSolverLocal)
+
+    computeFaceAlignedFluxSolverNeighbor = faceAlignedFluxSolver['kl'] <= self.QgodNeighbor['kq'] * self.starMatrix(0)['ql']
+    generator.add('computeFaceAlignedFluxSolverNeighbor', computeFaceAlignedFluxSolverNeighbor)
+
+    rotateFluxSolverLocal = self.AplusT['ij'] <= fluxScale * self.Tinv['ki'] * faceAlignedFluxSolver['kl'] * self.T['jl']
+    generator.add('rotateFluxSolverLocal', rotateFluxSolverLocal)
+
+    rotateFluxSolverNeighbor = self.AminusT['ij'] <= fluxScale * self.Tinv['ki'] * faceAlignedFluxSolver['kl'] * self.T['jl']
+    generator.add('rotateFluxSolverNeighbor', rotateFluxSolverNeighbor)
+
     QFortran = Tensor('QFortran', (self.numberOf3DBasisFunctions(), self.numberOfQuantities()))
     multSimToFirstSim = Tensor('multSimToFirstSim', (self.Q.optSize(),), spp={(0,): '1.0'})
     if self.Q.hasOptDim():
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+# Converts the binary receiver output (receiverOutputFormat = 'binary') into the
+# ASCII receiver files written by the default receiver output.
+
+import argparse
+import numpy as np
+
+MAGIC = b"SSRECV\0\0"
+NAME_LENGTH = 16
+
+
+def read_binary_receivers(filename):
+    with open(filename, "rb") as f:
+        data = f.read()
+
+    if data[:8] != MAGIC:
+        raise ValueError(f"{filename} is not a SeisSol binary receiver file")
+    version, real_size, num_receivers, num_columns = np.frombuffer(
+        data, dtype=np.uint64, count=4, offset=8
+    )
+    if version != 1:
+        raise ValueError(f"Unsupported binary receiver file version {version}")
+    real = np.float32 if real_size == 4 else np.float64
+    offset = 8 + 4 * 8
+
+    columns = []
+    for _ in range(num_columns):
+        name = data[offset : offset + NAME_LENGTH].split(b"\0", 1)[0]
+        columns.append(name.decode())
+        offset += NAME_LENGTH
+
+    table = np.frombuffer(
+        data,
+        dtype=[("number", np.uint64), ("x", np.float64, 3)],
+        count=num_receivers,
+        offset=offset,
+    )
+    offset += table.nbytes
+
+    samples = [[] for _ in range(num_receivers)]
+    while offset < len(data):
+        (num_entries,) = np.frombuffer(data, dtype=np.uint64, count=1, offset=offset)
+        offset += 8
+        entries = np.frombuffer(
+            data, dtype=np.uint64, count=2 * num_entries, offset=offset
+        ).reshape(-1, 2)
+        offset += entries.nbytes
+        for receiver, num_samples in entries:
+            count = int(num_samples * num_columns)
+            values = np.frombuffer(data, dtype=real, count=count, offset=offset)
+            samples[receiver].append(values.reshape(-1, num_columns))
+            offset += values.nbytes
+
+    for receiver in range(num_receivers):
+        values = (
+            np.concatenate(samples[receiver])
+            if samples[receiver]
+            else np.empty((0, num_columns))
+        )
+        yield int(table["number"][receiver]), table["x"][receiver], columns, values
+
+
+def write_ascii(prefix, number, position, columns, values):
+    filename = f"{prefix}-receiver-{number:05d}.dat"
+    with open(filename, "w") as f:
+        f.write(f'TITLE = "Temporal Signal for receiver number {number:05d}"\n')
+        f.write("VARIABLES = " + ",".join(f'"{name}"' for name in columns) + "\n")
+        for d in range(3):
+            f.write(f"# x{d + 1}       {position[d]:.12e}\n")
+        np.savetxt(f, values, fmt="%.15e", delimiter="  ")
+    return filename
+
+
+parser = argparse.ArgumentParser(
+    description="convert binary SeisSol receiver files to ASCII receiver files"
+)
+parser.add_argument("files", nargs="+", help="prefix-receivers[-rank].bin files")
+parser.add_argument("--prefix", default="output", help="prefix of the ASCII files")
+args = parser.parse_args()
+
+for filename in args.files:
+    for number, position, columns, values in read_binary_receivers(filename):
+        print(write_ascii(args.prefix, number, position, columns, values))
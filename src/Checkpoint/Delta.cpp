@@ -0,0 +1,238 @@
+#include "Delta.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "utils/logger.h"
+
+namespace
+{
+
+const char DELTA_MAGIC[8] = {'S', 'S', 'D', 'E', 'L', 'T', 'A', '\0'};
+const std::uint64_t DELTA_VERSION = 1;
+
+template<typename T>
+void writeValue(std::ofstream &file, const T &value)
+{
+	file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool readValue(std::ifstream &file, T &value)
+{
+	file.read(reinterpret_cast<char*>(&value), sizeof(T));
+	return static_cast<bool>(file);
+}
+
+std::size_t numBlocks(std::size_t size)
+{
+	return (size + seissol::checkpoint::DeltaCheckpoint::BLOCK_SIZE - 1)
+		/ seissol::checkpoint::DeltaCheckpoint::BLOCK_SIZE;
+}
+
+std::size_t blockLength(std::size_t block, std::size_t size)
+{
+	return std::min(seissol::checkpoint::DeltaCheckpoint::BLOCK_SIZE,
+		size - block * seissol::checkpoint::DeltaCheckpoint::BLOCK_SIZE);
+}
+
+}
+
+void seissol::checkpoint::DeltaCheckpoint::init(const char* filename, int rank,
+		unsigned int numDeltas, const std::size_t sizes[NUM_BUFFERS])
+{
+	m_filename = filename;
+	m_rank = rank;
+	m_numDeltas = numDeltas;
+	m_deltasInChain = 0;
+	m_chainStarted = false;
+	std::copy(sizes, sizes + NUM_BUFFERS, m_sizes);
+}
+
+void seissol::checkpoint::DeltaCheckpoint::startChain(double time, const real* const buffers[NUM_BUFFERS])
+{
+	for (unsigned int i = 0; i < NUM_BUFFERS; i++)
+		m_shadow[i].assign(buffers[i], buffers[i] + m_sizes[i]);
+
+	// Truncating the file invalidates the previous chain. This is only done
+	// after the new full checkpoint is complete.
+	if (m_file.is_open())
+		m_file.close();
+	m_file.open(deltaFile(m_filename.c_str(), m_rank), std::ios::binary | std::ios::trunc);
+	if (!m_file)
+		logError() << "Could not create delta checkpoint file" << deltaFile(m_filename.c_str(), m_rank);
+
+	m_file.write(DELTA_MAGIC, sizeof(DELTA_MAGIC));
+	writeValue(m_file, DELTA_VERSION);
+	writeValue(m_file, static_cast<std::uint64_t>(sizeof(real)));
+	writeValue(m_file, static_cast<std::uint64_t>(BLOCK_SIZE));
+	writeValue(m_file, static_cast<std::uint64_t>(NUM_BUFFERS));
+	for (unsigned int i = 0; i < NUM_BUFFERS; i++)
+		writeValue(m_file, static_cast<std::uint64_t>(m_sizes[i]));
+	writeValue(m_file, time);
+	m_file.flush();
+
+	m_chainStarted = true;
+	m_deltasInChain = 0;
+}
+
+void seissol::checkpoint::DeltaCheckpoint::write(double time, int faultTimeStep,
+		const void* header, std::size_t headerSize,
+		const real* const buffers[NUM_BUFFERS])
+{
+	std::uint64_t recordSize = sizeof(double) + sizeof(std::int64_t) + sizeof(std::uint64_t) + headerSize;
+	std::size_t numChanged = 0;
+	std::size_t numTotal = 0;
+	for (unsigned int i = 0; i < NUM_BUFFERS; i++) {
+		m_changedBlocks[i].clear();
+		for (std::size_t block = 0; block < numBlocks(m_sizes[i]); block++) {
+			const std::size_t offset = block * BLOCK_SIZE;
+			const std::size_t length = blockLength(block, m_sizes[i]);
+			if (memcmp(buffers[i] + offset, &m_shadow[i][offset], length * sizeof(real)) != 0) {
+				m_changedBlocks[i].push_back(block);
+				recordSize += sizeof(std::uint64_t) + length * sizeof(real);
+			}
+		}
+		recordSize += sizeof(std::uint64_t);
+
+		numChanged += m_changedBlocks[i].size();
+		numTotal += numBlocks(m_sizes[i]);
+	}
+
+	writeValue(m_file, recordSize);
+	writeValue(m_file, time);
+	writeValue(m_file, static_cast<std::int64_t>(faultTimeStep));
+	writeValue(m_file, static_cast<std::uint64_t>(headerSize));
+	m_file.write(static_cast<const char*>(header), headerSize);
+	for (unsigned int i = 0; i < NUM_BUFFERS; i++) {
+		writeValue(m_file, static_cast<std::uint64_t>(m_changedBlocks[i].size()));
+		m_file.write(reinterpret_cast<const char*>(m_changedBlocks[i].data()),
+			m_changedBlocks[i].size() * sizeof(std::uint64_t));
+		for (const auto block : m_changedBlocks[i]) {
+			const std::size_t offset = block * BLOCK_SIZE;
+			const std::size_t length = blockLength(block, m_sizes[i]);
+			m_file.write(reinterpret_cast<const char*>(buffers[i] + offset), length * sizeof(real));
+			std::copy(buffers[i] + offset, buffers[i] + offset + length, &m_shadow[i][offset]);
+		}
+	}
+	writeValue(m_file, recordSize);
+	m_file.flush();
+	if (!m_file)
+		logError() << "Could not write delta checkpoint to" << deltaFile(m_filename.c_str(), m_rank);
+
+	m_deltasInChain++;
+
+	logInfo(m_rank) << "Checkpoint: Delta" << m_deltasInChain << "of" << m_numDeltas << "contains"
+		<< numChanged << "of" << numTotal << "blocks.";
+}
+
+void seissol::checkpoint::DeltaCheckpoint::close()
+{
+	if (m_file.is_open())
+		m_file.close();
+	for (unsigned int i = 0; i < NUM_BUFFERS; i++) {
+		m_shadow[i].clear();
+		m_shadow[i].shrink_to_fit();
+	}
+}
+
+bool seissol::checkpoint::DeltaCheckpoint::readHeader(std::ifstream &file,
+		const std::size_t sizes[NUM_BUFFERS], double &baseTime)
+{
+	char magic[sizeof(DELTA_MAGIC)];
+	file.read(magic, sizeof(magic));
+	if (!file || memcmp(magic, DELTA_MAGIC, sizeof(magic)) != 0)
+		return false;
+
+	std::uint64_t version, realSize, blockSize, numBuffers;
+	if (!readValue(file, version) || version != DELTA_VERSION
+			|| !readValue(file, realSize) || realSize != sizeof(real)
+			|| !readValue(file, blockSize) || blockSize != BLOCK_SIZE
+			|| !readValue(file, numBuffers) || numBuffers != NUM_BUFFERS)
+		return false;
+
+	for (unsigned int i = 0; i < NUM_BUFFERS; i++) {
+		std::uint64_t size;
+		if (!readValue(file, size) || size != sizes[i])
+			return false;
+	}
+
+	return readValue(file, baseTime);
+}
+
+unsigned int seissol::checkpoint::DeltaCheckpoint::countDeltas(const char* filename, int rank,
+		double baseTime, std::size_t headerSize, const std::size_t sizes[NUM_BUFFERS])
+{
+	std::ifstream file(deltaFile(filename, rank), std::ios::binary);
+	if (!file)
+		return 0;
+
+	double chainBaseTime;
+	if (!readHeader(file, sizes, chainBaseTime)) {
+		logWarning(rank) << "Ignoring incompatible delta checkpoint file" << deltaFile(filename, rank);
+		return 0;
+	}
+	if (chainBaseTime != baseTime)
+		// Chain of an older full checkpoint
+		return 0;
+
+	unsigned int numDeltas = 0;
+	std::uint64_t recordSize;
+	while (readValue(file, recordSize)) {
+		file.seekg(recordSize, std::ios::cur);
+		std::uint64_t trailer;
+		if (!readValue(file, trailer) || trailer != recordSize)
+			// Incomplete record
+			break;
+		numDeltas++;
+	}
+
+	return numDeltas;
+}
+
+void seissol::checkpoint::DeltaCheckpoint::replay(const char* filename, int rank,
+		unsigned int numDeltas, void* header, std::size_t headerSize,
+		real* const buffers[NUM_BUFFERS], const std::size_t sizes[NUM_BUFFERS],
+		int &faultTimeStep)
+{
+	if (numDeltas == 0)
+		return;
+
+	std::ifstream file(deltaFile(filename, rank), std::ios::binary);
+	double baseTime;
+	if (!file || !readHeader(file, sizes, baseTime))
+		logError() << "Could not read delta checkpoint file" << deltaFile(filename, rank);
+
+	for (unsigned int delta = 0; delta < numDeltas; delta++) {
+		std::uint64_t recordSize, recordHeaderSize;
+		double time;
+		std::int64_t recordFaultTimeStep;
+		readValue(file, recordSize);
+		readValue(file, time);
+		readValue(file, recordFaultTimeStep);
+		if (!readValue(file, recordHeaderSize) || recordHeaderSize != headerSize)
+			logError() << "Corrupt delta checkpoint file" << deltaFile(filename, rank);
+		file.read(static_cast<char*>(header), headerSize);
+
+		for (unsigned int i = 0; i < NUM_BUFFERS; i++) {
+			std::uint64_t numChanged;
+			readValue(file, numChanged);
+			std::vector<std::uint64_t> blocks(numChanged);
+			file.read(reinterpret_cast<char*>(blocks.data()), numChanged * sizeof(std::uint64_t));
+			for (const auto block : blocks) {
+				if (block >= numBlocks(sizes[i]))
+					logError() << "Corrupt delta checkpoint file" << deltaFile(filename, rank);
+				file.read(reinterpret_cast<char*>(buffers[i] + block * BLOCK_SIZE),
+					blockLength(block, sizes[i]) * sizeof(real));
+			}
+		}
+
+		std::uint64_t trailer;
+		if (!readValue(file, trailer) || trailer != recordSize)
+			logError() << "Corrupt delta checkpoint file" << deltaFile(filename, rank);
+
+		faultTimeStep = recordFaultTimeStep;
+
+		logInfo(rank) << "Checkpoint: Applied delta from time" << utils::nospace << time << '.';
+	}
+}
@@ -0,0 +1,158 @@
+#ifndef CHECKPOINT_DELTA_H
+#define CHECKPOINT_DELTA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Kernels/precision.hpp"
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+/**
+ * Incremental checkpoints on top of the regular (full) checkpoints.
+ *
+ * After every full checkpoint, a new delta chain is started. Each following
+ * delta only contains the blocks of the wave field and fault buffers that changed
+ * since the previous checkpoint. The chain is stored in one file per rank,
+ * <checkpoint file>-delta/<rank>, with the layout (native byte order)
+ *
+ * Header
+ *   char     magic[8]      "SSDELTA\0"
+ *   uint64_t version
+ *   uint64_t realSize
+ *   uint64_t blockSize     number of reals per block
+ *   uint64_t numBuffers
+ *   uint64_t sizes[numBuffers]
+ *   double   baseTime      time of the full checkpoint the chain belongs to
+ *
+ * Records (one per delta checkpoint)
+ *   uint64_t recordSize    number of bytes between the two size fields
+ *   double   time
+ *   int64_t  faultTimeStep
+ *   uint64_t headerSize
+ *   char     header[headerSize]
+ *   numBuffers x { uint64_t numBlocks; uint64_t blocks[numBlocks]; real data[...] }
+ *   uint64_t recordSize    marks the record as complete
+ */
+class DeltaCheckpoint
+{
+public:
+	/** Wave field dofs and the 8 fault buffers */
+	static constexpr unsigned int NUM_BUFFERS = 9;
+
+	/** Number of reals that are compared and written together */
+	static constexpr std::size_t BLOCK_SIZE = 1024;
+
+private:
+	std::string m_filename;
+
+	int m_rank;
+
+	/** Number of delta checkpoints between two full checkpoints */
+	unsigned int m_numDeltas;
+
+	/** Number of delta checkpoints written since the last full checkpoint */
+	unsigned int m_deltasInChain;
+
+	/** True if a full checkpoint was written (and the chain started) */
+	bool m_chainStarted;
+
+	std::size_t m_sizes[NUM_BUFFERS];
+
+	/** Data of the last written checkpoint */
+	std::vector<real> m_shadow[NUM_BUFFERS];
+
+	std::ofstream m_file;
+
+	/** Changed blocks of the current delta (reused between deltas) */
+	std::vector<std::uint64_t> m_changedBlocks[NUM_BUFFERS];
+
+public:
+	DeltaCheckpoint()
+		: m_rank(0), m_numDeltas(0), m_deltasInChain(0), m_chainStarted(false), m_sizes{}
+	{ }
+
+	/**
+	 * @param filename The checkpoint file name
+	 * @param rank The rank of the compute process
+	 * @param numDeltas Number of delta checkpoints between two full checkpoints
+	 * @param sizes The number of reals in each buffer
+	 */
+	void init(const char* filename, int rank, unsigned int numDeltas,
+			const std::size_t sizes[NUM_BUFFERS]);
+
+	bool isEnabled() const
+	{
+		return m_numDeltas > 0;
+	}
+
+	/**
+	 * @return True if the next checkpoint has to be a full checkpoint
+	 */
+	bool fullCheckpointDue() const
+	{
+		return !m_chainStarted || m_deltasInChain >= m_numDeltas;
+	}
+
+	/**
+	 * Starts a new chain. Call this after the full checkpoint was written completely.
+	 */
+	void startChain(double time, const real* const buffers[NUM_BUFFERS]);
+
+	/**
+	 * Appends a delta to the current chain
+	 */
+	void write(double time, int faultTimeStep, const void* header, std::size_t headerSize,
+			const real* const buffers[NUM_BUFFERS]);
+
+	void close();
+
+	/**
+	 * @return The number of complete deltas in the chain of the full checkpoint at baseTime
+	 */
+	static unsigned int countDeltas(const char* filename, int rank, double baseTime,
+			std::size_t headerSize, const std::size_t sizes[NUM_BUFFERS]);
+
+	/**
+	 * Applies the first numDeltas deltas of the chain to the loaded full checkpoint
+	 */
+	static void replay(const char* filename, int rank, unsigned int numDeltas,
+			void* header, std::size_t headerSize,
+			real* const buffers[NUM_BUFFERS], const std::size_t sizes[NUM_BUFFERS],
+			int &faultTimeStep);
+
+	/**
+	 * @return The directory containing the delta files
+	 */
+	static std::string directory(const char* filename)
+	{
+		return std::string(filename) + "-delta";
+	}
+
+private:
+	static std::string deltaFile(const char* filename, int rank)
+	{
+		return directory(filename) + "/" + std::to_string(rank);
+	}
+
+	/**
+	 * Reads and validates the header of a delta file
+	 *
+	 * @return True if the header matches the given sizes
+	 */
+	static bool readHeader(std::ifstream &file, const std::size_t sizes[NUM_BUFFERS],
+			double &baseTime);
+};
+
+}
+
+}
+
+#endif // CHECKPOINT_DELTA_H
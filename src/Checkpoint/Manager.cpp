@@ -40,13 +40,15 @@
 #include "utils/env.h"
 #include "utils/logger.h"
 
+#include <sys/stat.h>
+
 #include "Manager.h"
 #include "SeisSol.h"
 
 bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
-		real* mu, real* slipRate1, real* slipRate2, real* slip, real* slip1, real* slip2,
-		real* state, real* strength, unsigned int numSides, unsigned int numBndGP,
-		int &faultTimeStep)
+		realAcc* mu, realAcc* slipRate1, realAcc* slipRate2, realAcc* slip,
+		realAcc* slip1, realAcc* slip2, realAcc* state, realAcc* strength,
+		unsigned int numSides, unsigned int numBndGP, int &faultTimeStep)
 {
 		if (m_backend == DISABLED) {
 			// Always allocate the header struct because other still use it
@@ -55,6 +57,13 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 			return false;
 		}
 
+		if (m_numDeltas > 0) {
+			if (m_backend == MPIO_ASYNC)
+				logError() << "Delta checkpoints are not supported with the mpio_async backend.";
+			if (seissol::SeisSol::main.asyncIO().groupSize() != 1)
+				logError() << "Delta checkpoints require an asynchronous output group size of 1.";
+		}
+
 		// Initialize the asynchronous module
 		async::Module<ManagerExecutor, CheckpointInitParam, CheckpointParam>::init();
 
@@ -80,15 +89,18 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 
 		id = addBuffer(dofs, numDofs * sizeof(real));
 		assert(id == DOFS);
-		id = addBuffer(mu, m_numDRDofs * sizeof(real));
-		assert(id == DR_DOFS0);
-		addBuffer(slipRate1, m_numDRDofs * sizeof(real));
-		addBuffer(slipRate2, m_numDRDofs * sizeof(real));
-		addBuffer(slip, m_numDRDofs * sizeof(real));
-		addBuffer(slip1, m_numDRDofs * sizeof(real));
-		addBuffer(slip2, m_numDRDofs * sizeof(real));
-		addBuffer(state, m_numDRDofs * sizeof(real));
-		addBuffer(strength, m_numDRDofs * sizeof(real));
+
+		// The DR variables are accumulated in realAcc but checkpointed in real
+		realAcc* const drBuffers[8] = {
+			mu, slipRate1, slipRate2, slip, slip1, slip2, state, strength };
+		real* checkpointBuffers[8];
+		for (unsigned int i = 0; i < 8; i++) {
+			m_drBuffers[i] = drBuffers[i];
+			checkpointBuffers[i] = checkpointBuffer(drBuffers[i], m_drCheckpointBuffers[i],
+				m_numDRDofs);
+			id = addBuffer(checkpointBuffers[i], m_numDRDofs * sizeof(real));
+			assert(id == DR_DOFS0+i);
+		}
 
 		//
 		// Initialization for loading checkpoints
@@ -108,8 +120,30 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		// Load checkpoint?
 		if (exists) {
 			waveField->load(dofs);
-			fault->load(faultTimeStep, mu, slipRate1, slipRate2,
-				slip, slip1, slip2, state, strength);
+			fault->load(faultTimeStep, checkpointBuffers[0], checkpointBuffers[1],
+				checkpointBuffers[2], checkpointBuffers[3], checkpointBuffers[4],
+				checkpointBuffers[5], checkpointBuffers[6], checkpointBuffers[7]);
+
+			if (m_numDeltas > 0) {
+				real* const buffers[DeltaCheckpoint::NUM_BUFFERS] = {
+					dofs, checkpointBuffers[0], checkpointBuffers[1], checkpointBuffers[2],
+					checkpointBuffers[3], checkpointBuffers[4], checkpointBuffers[5],
+					checkpointBuffers[6], checkpointBuffers[7] };
+				const std::size_t sizes[DeltaCheckpoint::NUM_BUFFERS] = {
+					numDofs, m_numDRDofs, m_numDRDofs, m_numDRDofs, m_numDRDofs,
+					m_numDRDofs, m_numDRDofs, m_numDRDofs, m_numDRDofs };
+
+				// Only replay the deltas that were completed on all ranks
+				unsigned int numDeltas = DeltaCheckpoint::countDeltas(m_filename.c_str(),
+					seissol::MPI::mpi.rank(), m_header.time(), m_header.size(), sizes);
+#ifdef USE_MPI
+				MPI_Allreduce(MPI_IN_PLACE, &numDeltas, 1, MPI_UNSIGNED, MPI_MIN, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+				DeltaCheckpoint::replay(m_filename.c_str(), seissol::MPI::mpi.rank(), numDeltas,
+					m_header.data(), m_header.size(), buffers, sizes, faultTimeStep);
+			}
+
+			loadDRBuffers();
 		} else {
 			// Initialize header information (if not set from checkpoint)
 			m_header.clear();
@@ -122,6 +156,14 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		delete waveField;
 		delete fault;
 
+		if (m_numDeltas > 0) {
+			if (seissol::MPI::mpi.rank() == 0)
+				mkdir(DeltaCheckpoint::directory(m_filename.c_str()).c_str(), 0755);
+#ifdef USE_MPI
+			MPI_Barrier(seissol::MPI::mpi.comm());
+#endif // USE_MPI
+		}
+
 		sendBuffer(FILENAME,  m_filename.size()+1);
 
 		// Initialize the executor
@@ -129,6 +171,8 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		param.backend = m_backend;
 		param.numBndGP = numBndGP;
 		param.loaded = exists;
+		param.rank = seissol::MPI::mpi.rank();
+		param.numDeltas = m_numDeltas;
 		callInit(param);
 
 		removeBuffer(FILENAME);
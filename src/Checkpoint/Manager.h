@@ -45,8 +45,11 @@
 #include "Parallel/Pin.h"
 
 #include <cassert>
+#include <algorithm>
 #include <cstring>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "utils/logger.h"
 
@@ -57,6 +60,7 @@
 #include "Wavefield.h"
 #include "Fault.h"
 #include "WavefieldHeader.h"
+#include "Kernels/precision.hpp"
 #include "Monitoring/Stopwatch.h"
 
 namespace seissol
@@ -82,6 +86,15 @@ private:
 	/** Number of DR DOFs */
 	unsigned int m_numDRDofs;
 
+	/** Number of delta checkpoints between two full checkpoints */
+	unsigned int m_numDeltas;
+
+	/** The DR variables of the simulation (in accumulation precision) */
+	realAcc* m_drBuffers[8];
+
+	/** Copies of the DR variables in checkpoint precision (only if it differs) */
+	std::vector<real> m_drCheckpointBuffers[8];
+
 	/** Checkpoint header */
 	WavefieldHeader m_header;
 
@@ -91,7 +104,7 @@ private:
 public:
 	Manager()
 		: m_backend(DISABLED),
-		  m_numDofs(0), m_numDRDofs(0)
+		  m_numDofs(0), m_numDRDofs(0), m_numDeltas(0)
 	{
 	}
 
@@ -103,6 +116,16 @@ public:
 		m_backend = backend;
 	}
 
+	/**
+	 * Enables incremental checkpoints
+	 *
+	 * @param numDeltas Number of delta checkpoints between two full checkpoints
+	 */
+	void setNumDeltas(unsigned int numDeltas)
+	{
+		m_numDeltas = numDeltas;
+	}
+
 	/**
 	 * Set the filename prefix for checkpointing
 	 *
@@ -133,9 +156,9 @@ public:
 	 * @return True is a checkpoint was loaded, false otherwise
 	 */
 	bool init(real* dofs, unsigned int numDofs,
-			real* mu, real* slipRate1, real* slipRate2, real* slip, real* slip1, real* slip2,
-			real* state, real* strength, unsigned int numSides, unsigned int numBndGP,
-			int &faultTimeStep);
+			realAcc* mu, realAcc* slipRate1, realAcc* slipRate2, realAcc* slip,
+			realAcc* slip1, realAcc* slip2, realAcc* state, realAcc* strength,
+			unsigned int numSides, unsigned int numBndGP, int &faultTimeStep);
 
 	/**
 	 * Write a checkpoint for the current time
@@ -165,6 +188,8 @@ public:
 
 		logInfo(rank) << "Checkpoint: Writing at time" << utils::nospace << time << '.';
 
+		storeDRBuffers();
+
 		// Send buffers
 		sendBuffer(HEADER);
 		sendBuffer(DOFS, m_numDofs * sizeof(real));
@@ -211,6 +236,44 @@ public:
 	}
 
 private:
+	/**
+	 * @return The buffer written to the checkpoint for a DR variable; a copy
+	 *  in checkpoint precision if the variable is stored in a different one
+	 */
+	template<typename T>
+	static real* checkpointBuffer(T* buffer, std::vector<real> &copy, unsigned int size)
+	{
+		if constexpr (std::is_same_v<T, real>) {
+			return buffer;
+		} else {
+			copy.resize(size);
+			return copy.data();
+		}
+	}
+
+	/**
+	 * Copies the DR variables from the checkpoint buffers to the simulation
+	 */
+	void loadDRBuffers()
+	{
+		if constexpr (!std::is_same_v<real, realAcc>) {
+			for (unsigned int i = 0; i < 8; i++)
+				std::copy(m_drCheckpointBuffers[i].begin(), m_drCheckpointBuffers[i].end(),
+					m_drBuffers[i]);
+		}
+	}
+
+	/**
+	 * Copies the DR variables from the simulation to the checkpoint buffers
+	 */
+	void storeDRBuffers()
+	{
+		if constexpr (!std::is_same_v<real, realAcc>) {
+			for (unsigned int i = 0; i < 8; i++)
+				std::copy(m_drBuffers[i], m_drBuffers[i] + m_numDRDofs,
+					m_drCheckpointBuffers[i].begin());
+		}
+	}
 };
 
 }
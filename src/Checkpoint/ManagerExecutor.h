@@ -43,6 +43,7 @@
 #include "async/ExecInfo.h"
 
 #include "Backend.h"
+#include "Delta.h"
 #include "Monitoring/Stopwatch.h"
 
 namespace seissol
@@ -67,6 +68,10 @@ struct CheckpointInitParam
 	Backend backend;
 	unsigned int numBndGP;
 	bool loaded;
+	/** Rank of the compute process (used for the delta files) */
+	int rank;
+	/** Number of delta checkpoints between two full checkpoints */
+	unsigned int numDeltas;
 };
 
 /**
@@ -87,6 +92,9 @@ private:
 	/** The dynamic rupture checkpoint */
 	Fault *m_fault;
 
+	/** Incremental checkpoints between the full ones */
+	DeltaCheckpoint m_delta;
+
 	/** Stopwatch for checkpoint backend */
 	Stopwatch m_stopwatch;
 
@@ -127,6 +135,12 @@ public:
 		m_waveField->initLate(dofs);
 		m_fault->initLate(drDofs[0], drDofs[1], drDofs[2], drDofs[3], drDofs[4], drDofs[5],
 			drDofs[6], drDofs[7]);
+
+		std::size_t sizes[DeltaCheckpoint::NUM_BUFFERS];
+		sizes[0] = info.bufferSize(DOFS) / sizeof(real);
+		for (unsigned int i = 0; i < 8; i++)
+			sizes[i+1] = info.bufferSize(DR_DOFS0 + i) / sizeof(real);
+		m_delta.init(filename, param.rank, param.numDeltas, sizes);
 	}
 
 	/**
@@ -136,16 +150,30 @@ public:
 	{
 		m_stopwatch.start();
 
-		m_waveField->write(info.buffer(HEADER), info.bufferSize(HEADER));
-		m_fault->write(param.faultTimeStep);
-
-		// Update both links at the "same" time
-		m_waveField->updateLink();
-		m_fault->updateLink();
-
-		// Prepare next checkpoint (only for async checkpoints)
-		m_waveField->writePrepare(info.buffer(HEADER), info.bufferSize(HEADER));
-		m_fault->writePrepare(param.faultTimeStep);
+		const real* buffers[DeltaCheckpoint::NUM_BUFFERS];
+		buffers[0] = static_cast<const real*>(info.buffer(DOFS));
+		for (unsigned int i = 0; i < 8; i++)
+			buffers[i+1] = static_cast<const real*>(info.buffer(DR_DOFS0 + i));
+
+		if (m_delta.isEnabled() && !m_delta.fullCheckpointDue()) {
+			m_delta.write(param.time, param.faultTimeStep,
+				info.buffer(HEADER), info.bufferSize(HEADER), buffers);
+		} else {
+			m_waveField->write(info.buffer(HEADER), info.bufferSize(HEADER));
+			m_fault->write(param.faultTimeStep);
+
+			// Update both links at the "same" time
+			m_waveField->updateLink();
+			m_fault->updateLink();
+
+			// Prepare next checkpoint (only for async checkpoints)
+			m_waveField->writePrepare(info.buffer(HEADER), info.bufferSize(HEADER));
+			m_fault->writePrepare(param.faultTimeStep);
+
+			// The full checkpoint is complete, the old delta chain is no longer required
+			if (m_delta.isEnabled())
+				m_delta.startChain(param.time, buffers);
+		}
 
 		m_stopwatch.pause();
 	}
@@ -157,6 +185,7 @@ public:
 
 			m_waveField->close();
 			m_fault->close();
+			m_delta.close();
 
 			delete m_waveField;
 			m_waveField = 0L;
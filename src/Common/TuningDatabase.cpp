@@ -0,0 +1,179 @@
+#include "TuningDatabase.h"
+
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include "Common/filesystem.h"
+#include "Parallel/MPI.h"
+#include "utils/env.h"
+#include "utils/logger.h"
+
+#ifndef SEISSOL_BUILD_CONFIGURATION
+#define SEISSOL_BUILD_CONFIGURATION "unknown"
+#endif
+
+namespace {
+
+constexpr char Magic[] = "SeisSolTuningDatabase";
+
+bool readDatabase(const std::string& filename, std::map<std::string, double>& entries) {
+  std::ifstream file(filename);
+  if (!file) {
+    return true;
+  }
+
+  std::string magic;
+  int version = 0;
+  if (!(file >> magic >> version) || magic != Magic || version != seissol::TuningDatabase::Version) {
+    return false;
+  }
+
+  std::string key;
+  double value = 0;
+  while (file >> key >> value) {
+    entries[key] = value;
+  }
+  return true;
+}
+
+void writeEntries(std::ostream& stream, const std::map<std::string, double>& entries) {
+  stream.precision(std::numeric_limits<double>::max_digits10);
+  for (const auto& [key, value] : entries) {
+    stream << key << ' ' << value << '\n';
+  }
+}
+
+} // namespace
+
+namespace seissol {
+
+void TuningDatabase::load() {
+  filename = utils::Env::get<const char*>("SEISSOL_TUNING_DATABASE", "");
+  if (!isEnabled()) {
+    return;
+  }
+
+  const int rank = MPI::mpi.rank();
+  std::string serialized;
+  if (rank == 0) {
+    std::map<std::string, double> fileEntries;
+    if (readDatabase(filename, fileEntries)) {
+      std::ostringstream stream;
+      writeEntries(stream, fileEntries);
+      serialized = stream.str();
+    } else {
+      logWarning(rank) << "Ignoring the tuning database" << filename
+                       << "since it has an incompatible format. It will be overwritten.";
+    }
+  }
+#ifdef USE_MPI
+  MPI::mpi.broadcastContainer(serialized, 0);
+#endif // USE_MPI
+
+  std::istringstream stream(serialized);
+  std::string key;
+  double value = 0;
+  while (stream >> key >> value) {
+    entries[key] = value;
+  }
+  logInfo(rank) << "Read" << entries.size() << "entries from the tuning database" << filename;
+}
+
+void TuningDatabase::store() {
+  if (!isEnabled()) {
+    return;
+  }
+
+  std::ostringstream stream;
+  writeEntries(stream, updated);
+  const std::string serialized = stream.str();
+
+  const int rank = MPI::mpi.rank();
+#ifdef USE_MPI
+  const auto collected = MPI::mpi.collectContainer(serialized);
+#else
+  const std::vector<std::string> collected{serialized};
+#endif // USE_MPI
+  if (rank != 0) {
+    return;
+  }
+
+  std::map<std::string, std::pair<double, unsigned>> sums;
+  for (const auto& rankEntries : collected) {
+    std::istringstream rankStream(rankEntries);
+    std::string key;
+    double value = 0;
+    while (rankStream >> key >> value) {
+      auto& [sum, count] = sums[key];
+      sum += value;
+      ++count;
+    }
+  }
+  if (sums.empty()) {
+    return;
+  }
+
+  // Read the file again to keep the entries other runs stored in the meantime
+  std::map<std::string, double> fileEntries;
+  if (!readDatabase(filename, fileEntries)) {
+    fileEntries.clear();
+  }
+  for (const auto& [key, sum] : sums) {
+    fileEntries[key] = sum.first / sum.second;
+  }
+
+  // Write a temporary file first, such that concurrent readers never see a partial database
+  const std::string tmpFilename = filename + ".tmp" + std::to_string(::getpid());
+  {
+    std::ofstream file(tmpFilename);
+    file << Magic << ' ' << Version << '\n';
+    writeEntries(file, fileEntries);
+    if (!file) {
+      logWarning(rank) << "Could not write the tuning database" << filename;
+      return;
+    }
+  }
+  std::error_code error;
+  seissol::filesystem::rename(tmpFilename, filename, error);
+  if (error) {
+    seissol::filesystem::remove(tmpFilename, error);
+    logWarning(rank) << "Could not write the tuning database" << filename;
+    return;
+  }
+  logInfo(rank) << "Stored" << sums.size() << "tuning results in" << filename;
+}
+
+std::optional<double> TuningDatabase::get(const std::string& key) const {
+  std::lock_guard lock(mutex);
+  if (const auto it = entries.find(key); it != entries.end()) {
+    return it->second;
+  }
+  return {};
+}
+
+void TuningDatabase::set(const std::string& key, double value) {
+  std::lock_guard lock(mutex);
+  entries[key] = value;
+  updated[key] = value;
+}
+
+std::string TuningDatabase::makeKey(std::string_view tunable,
+                                    std::string_view parameters,
+                                    std::size_t size) {
+  unsigned sizeClass = 0;
+  while (size > 1) {
+    size /= 2;
+    ++sizeClass;
+  }
+
+  std::ostringstream key;
+  key << tunable << '/' << SEISSOL_BUILD_CONFIGURATION << '/' << parameters << "/2^" << sizeClass;
+  return key.str();
+}
+
+} // namespace seissol
@@ -0,0 +1,68 @@
+#ifndef SEISSOL_TUNINGDATABASE_H
+#define SEISSOL_TUNINGDATABASE_H
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace seissol {
+
+/**
+ * Persistent store for the results of auto-tuned parameters.
+ *
+ * The database is a small text file, given by the environment variable
+ * SEISSOL_TUNING_DATABASE. The first line contains the format version, all
+ * following lines one entry "<key> <value>". Keys are created with makeKey
+ * and contain the name of the tunable, the build configuration (host
+ * architecture, precision, order and equations), the problem parameters and
+ * the problem size. Results of a run seed all future runs with the same key;
+ * entries of other configurations are kept.
+ *
+ * The file is read by rank 0 and broadcast to all ranks. Values set on
+ * different ranks for the same key are averaged when storing.
+ */
+class TuningDatabase {
+  public:
+  static constexpr int Version = 1;
+
+  /**
+   * Reads the database given by SEISSOL_TUNING_DATABASE, if set. Collective.
+   */
+  void load();
+
+  /**
+   * Writes the values set during this run back to the file. Collective.
+   */
+  void store();
+
+  [[nodiscard]] bool isEnabled() const { return !filename.empty(); }
+
+  [[nodiscard]] std::optional<double> get(const std::string& key) const;
+
+  void set(const std::string& key, double value);
+
+  /**
+   * @param tunable The name of the tuned parameter (without whitespace)
+   * @param parameters Further parameters the result depends on, e.g. the friction law
+   * @param size The problem size; only its order of magnitude (base 2) is part of the key
+   */
+  static std::string makeKey(std::string_view tunable, std::string_view parameters, std::size_t size);
+
+  private:
+  std::string filename;
+
+  /** All entries, including the ones of other configurations */
+  std::map<std::string, double> entries;
+
+  /** Entries set during this run */
+  std::map<std::string, double> updated;
+
+  mutable std::mutex mutex;
+};
+
+} // namespace seissol
+
+#endif // SEISSOL_TUNINGDATABASE_H
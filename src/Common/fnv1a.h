@@ -4,18 +4,32 @@
 #ifndef FNV1A_H
 #define FNV1A_H
 
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
 
 namespace seissol {
 
+constexpr std::uint64_t Fnv1aBasis = 0xcbf29ce484222325;
+constexpr std::uint64_t Fnv1aPrime = 0x00000100000001b3;
+
 constexpr std::uint64_t fnv1a(char const* str, std::size_t n) {
-  constexpr std::uint64_t basis = 0xcbf29ce484222325;
-  constexpr std::uint64_t prime = 0x00000100000001b3;
-  return n > 0 ? (fnv1a(str, n - 1) ^ str[n - 1]) * prime : basis;
+  return n > 0 ? (fnv1a(str, n - 1) ^ str[n - 1]) * Fnv1aPrime : Fnv1aBasis;
 }
 constexpr std::uint64_t fnv1a(std::string_view str) { return fnv1a(str.data(), str.size()); }
 
+/**
+ * Continues the hash with the given bytes. Use this function for large (binary) data at runtime,
+ * starting with hash = Fnv1aBasis.
+ */
+inline std::uint64_t fnv1aUpdate(std::uint64_t hash, void const* data, std::size_t size) {
+  const auto* bytes = static_cast<unsigned char const*>(data);
+  for (std::size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * Fnv1aPrime;
+  }
+  return hash;
+}
+
 namespace literals {
 
 constexpr std::uint64_t operator""_fnv1a(char const* str, std::size_t n) {
@@ -19,61 +19,152 @@ class BaseFrictionLaw : public FrictionSolver {
   public:
   explicit BaseFrictionLaw(dr::DRParameters* drParameters) : FrictionSolver(drParameters){};
 
+  /**
+   * Friction laws which set this to true implement their hooks for tiles of
+   * misc::numFacesPerBatch consecutive faces, see evaluateTile.
+   */
+  static constexpr bool SupportsFaceBatching = false;
+
   /**
    * evaluates the current friction model
    */
   void evaluate(seissol::initializers::Layer& layerData,
                 seissol::initializers::DynamicRupture const* const dynRup,
-                real fullUpdateTime,
+                double fullUpdateTime,
                 const double timeWeights[CONVERGENCE_ORDER]) override {
-    SCOREP_USER_REGION_DEFINE(myRegionHandle)
+    evaluateBatch(
+        layerData, dynRup, fullUpdateTime, timeWeights, 0, layerData.getNumberOfCells());
+  }
+
+  /**
+   * evaluates the current friction model on a contiguous range of faces
+   */
+  void evaluateBatch(seissol::initializers::Layer& layerData,
+                     seissol::initializers::DynamicRupture const* const dynRup,
+                     double fullUpdateTime,
+                     const double timeWeights[CONVERGENCE_ORDER],
+                     unsigned startFace,
+                     unsigned numberOfFaces) override {
     BaseFrictionLaw::copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
     static_cast<Derived*>(this)->copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
 
-    // loop over all dynamic rupture faces, in this LTS layer
+    constexpr unsigned FacesPerTile = Derived::SupportsFaceBatching ? misc::numFacesPerBatch : 1;
+    const unsigned numberOfTiles = numberOfFaces / FacesPerTile;
+    // the remaining faces are processed one by one
+    const unsigned numberOfItems = numberOfTiles + numberOfFaces % FacesPerTile;
+
+    unsigned numberOfLockedFaces = 0;
+    this->iterationStatistics = {};
+
+    // loop over the given dynamic rupture faces, in this LTS layer
+#ifdef _OPENMP
+#pragma omp parallel reduction(+ : numberOfLockedFaces)
+#endif
+    {
+      auto& threadStatistics = FrictionSolver::threadIterationStatistics();
+      threadStatistics = {};
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (unsigned item = 0; item < numberOfItems; ++item) {
+        if (item < numberOfTiles) {
+          numberOfLockedFaces +=
+              evaluateTile<FacesPerTile>(startFace + item * FacesPerTile, timeWeights);
+        } else {
+          const unsigned ltsFace =
+              startFace + numberOfTiles * FacesPerTile + (item - numberOfTiles);
+          numberOfLockedFaces += evaluateTile<1>(ltsFace, timeWeights);
+        }
+      }
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp critical
 #endif
-    for (unsigned ltsFace = 0; ltsFace < layerData.getNumberOfCells(); ++ltsFace) {
-      alignas(ALIGNMENT) FaultStresses faultStresses{};
-      SCOREP_USER_REGION_BEGIN(
-          myRegionHandle, "computeDynamicRupturePrecomputeStress", SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePrecomputeStress");
-      common::precomputeStressFromQInterpolated(faultStresses,
-                                                impAndEta[ltsFace],
-                                                impedanceMatrices[ltsFace],
-                                                qInterpolatedPlus[ltsFace],
-                                                qInterpolatedMinus[ltsFace]);
-      LIKWID_MARKER_STOP("computeDynamicRupturePrecomputeStress");
-      SCOREP_USER_REGION_END(myRegionHandle)
-
-      SCOREP_USER_REGION_BEGIN(
-          myRegionHandle, "computeDynamicRupturePreHook", SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePreHook");
-      // define some temporary variables
-      std::array<real, misc::numPaddedPoints> stateVariableBuffer{0};
-      std::array<real, misc::numPaddedPoints> strengthBuffer{0};
-
-      static_cast<Derived*>(this)->preHook(stateVariableBuffer, ltsFace);
-      LIKWID_MARKER_STOP("computeDynamicRupturePreHook");
-      SCOREP_USER_REGION_END(myRegionHandle)
-
-      SCOREP_USER_REGION_BEGIN(myRegionHandle,
-                               "computeDynamicRuptureUpdateFrictionAndSlip",
-                               SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRuptureUpdateFrictionAndSlip");
-      TractionResults tractionResults = {};
-
-      // loop over sub time steps (i.e. quadrature points in time)
-      for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
-        common::adjustInitialStress(initialStressInFaultCS[ltsFace],
-                                    nucleationStressInFaultCS[ltsFace],
-                                    initialPressure[ltsFace],
-                                    nucleationPressure[ltsFace],
+      this->iterationStatistics.add(threadStatistics);
+    }
+
+    this->numberOfLockedFaces = numberOfLockedFaces;
+  }
+
+  /**
+   * Evaluates the friction law for the faces ltsFace, ..., ltsFace + NumFaces - 1.
+   * For NumFaces > 1, the hooks of the friction law operate on all points of the tile at once;
+   * the DR variables of consecutive faces are contiguous in memory, hence the hooks only need to
+   * extend their loops.
+   *
+   * @return the number of faces which stayed locked
+   */
+  template <unsigned NumFaces>
+  unsigned evaluateTile(unsigned ltsFace, const double timeWeights[CONVERGENCE_ORDER]) {
+    SCOREP_USER_REGION_DEFINE(myRegionHandle)
+    constexpr unsigned NumPoints = NumFaces * misc::numPaddedPoints;
+
+    alignas(ALIGNMENT) FaultStressesTile<NumFaces> faultStresses{};
+    SCOREP_USER_REGION_BEGIN(
+        myRegionHandle, "computeDynamicRupturePrecomputeStress", SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePrecomputeStress");
+    for (unsigned face = 0; face < NumFaces; ++face) {
+      if constexpr (NumFaces == 1) {
+        common::precomputeStressFromQInterpolated(faultStresses,
+                                                  impAndEta[ltsFace],
+                                                  impedanceMatrices[ltsFace],
+                                                  qInterpolatedPlus[ltsFace],
+                                                  qInterpolatedMinus[ltsFace]);
+      } else {
+        alignas(ALIGNMENT) FaultStresses faceStresses{};
+        common::precomputeStressFromQInterpolated(faceStresses,
+                                                  impAndEta[ltsFace + face],
+                                                  impedanceMatrices[ltsFace + face],
+                                                  qInterpolatedPlus[ltsFace + face],
+                                                  qInterpolatedMinus[ltsFace + face]);
+        copyToTile<NumFaces>(faceStresses.normalStress, faultStresses.normalStress, face);
+        copyToTile<NumFaces>(faceStresses.traction1, faultStresses.traction1, face);
+        copyToTile<NumFaces>(faceStresses.traction2, faultStresses.traction2, face);
+        copyToTile<NumFaces>(faceStresses.fluidPressure, faultStresses.fluidPressure, face);
+      }
+    }
+    LIKWID_MARKER_STOP("computeDynamicRupturePrecomputeStress");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    SCOREP_USER_REGION_BEGIN(
+        myRegionHandle, "computeDynamicRupturePreHook", SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePreHook");
+    // define some temporary variables
+    std::array<real, NumPoints> stateVariableBuffer{0};
+    std::array<real, NumPoints> strengthBuffer{0};
+
+    static_cast<Derived*>(this)->preHook(stateVariableBuffer, ltsFace);
+    LIKWID_MARKER_STOP("computeDynamicRupturePreHook");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    SCOREP_USER_REGION_BEGIN(myRegionHandle,
+                             "computeDynamicRuptureUpdateFrictionAndSlip",
+                             SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRuptureUpdateFrictionAndSlip");
+    TractionResultsTile<NumFaces> tractionResults = {};
+
+    // Faces which are locked at the beginning of the time step take the elastic path,
+    // as long as the stresses stay below the fault strength. Otherwise, they are
+    // reactivated and the friction update continues with the current sub time step.
+    // A tile takes the elastic path only if all of its faces are locked.
+    bool locked = static_cast<Derived*>(this)->isLocked(ltsFace, NumFaces);
+
+    // loop over sub time steps (i.e. quadrature points in time)
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+      for (unsigned face = ltsFace; face < ltsFace + NumFaces; ++face) {
+        common::adjustInitialStress(initialStressInFaultCS[face],
+                                    nucleationStressInFaultCS[face],
+                                    initialPressure[face],
+                                    nucleationPressure[face],
                                     this->mFullUpdateTime,
                                     this->drParameters->t0,
                                     this->deltaT[timeIndex]);
+      }
 
+      if (locked) {
+        locked = static_cast<Derived*>(this)->updateLockedFace(
+            faultStresses, tractionResults, ltsFace, timeIndex);
+      }
+      if (!locked) {
         static_cast<Derived*>(this)->updateFrictionAndSlip(faultStresses,
                                                            tractionResults,
                                                            stateVariableBuffer,
@@ -81,51 +172,141 @@ class BaseFrictionLaw : public FrictionSolver {
                                                            ltsFace,
                                                            timeIndex);
       }
-      LIKWID_MARKER_STOP("computeDynamicRuptureUpdateFrictionAndSlip");
-      SCOREP_USER_REGION_END(myRegionHandle)
+    }
+    LIKWID_MARKER_STOP("computeDynamicRuptureUpdateFrictionAndSlip");
+    SCOREP_USER_REGION_END(myRegionHandle)
 
-      SCOREP_USER_REGION_BEGIN(
-          myRegionHandle, "computeDynamicRupturePostHook", SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePostHook");
+    SCOREP_USER_REGION_BEGIN(
+        myRegionHandle, "computeDynamicRupturePostHook", SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePostHook");
+    // for locked faces, slip and slip rate are still zero, hence the output does not change
+    if (!locked) {
       static_cast<Derived*>(this)->postHook(stateVariableBuffer, ltsFace);
 
-      common::saveRuptureFrontOutput(ruptureTimePending[ltsFace],
-                                     ruptureTime[ltsFace],
-                                     slipRateMagnitude[ltsFace],
-                                     mFullUpdateTime);
-
-      static_cast<Derived*>(this)->saveDynamicStressOutput(ltsFace);
-
-      common::savePeakSlipRateOutput(slipRateMagnitude[ltsFace], peakSlipRate[ltsFace]);
-      LIKWID_MARKER_STOP("computeDynamicRupturePostHook");
-      SCOREP_USER_REGION_END(myRegionHandle)
-
-      SCOREP_USER_REGION_BEGIN(myRegionHandle,
-                               "computeDynamicRupturePostcomputeImposedState",
-                               SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePostcomputeImposedState");
-      common::postcomputeImposedStateFromNewStress(faultStresses,
-                                                   tractionResults,
-                                                   impAndEta[ltsFace],
-                                                   impedanceMatrices[ltsFace],
-                                                   imposedStatePlus[ltsFace],
-                                                   imposedStateMinus[ltsFace],
-                                                   qInterpolatedPlus[ltsFace],
-                                                   qInterpolatedMinus[ltsFace],
-                                                   timeWeights);
-      LIKWID_MARKER_STOP("computeDynamicRupturePostcomputeImposedState");
-      SCOREP_USER_REGION_END(myRegionHandle)
-
-      if (this->drParameters->isFrictionEnergyRequired) {
-        common::computeFrictionEnergy(energyData[ltsFace],
-                                      qInterpolatedPlus[ltsFace],
-                                      qInterpolatedMinus[ltsFace],
-                                      impAndEta[ltsFace],
+      for (unsigned face = ltsFace; face < ltsFace + NumFaces; ++face) {
+        common::saveRuptureFrontOutput(ruptureTimePending[face],
+                                       ruptureTime[face],
+                                       slipRateMagnitude[face],
+                                       mFullUpdateTime);
+
+        static_cast<Derived*>(this)->saveDynamicStressOutput(face);
+
+        common::savePeakSlipRateOutput(slipRateMagnitude[face], peakSlipRate[face]);
+      }
+    }
+    LIKWID_MARKER_STOP("computeDynamicRupturePostHook");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    SCOREP_USER_REGION_BEGIN(myRegionHandle,
+                             "computeDynamicRupturePostcomputeImposedState",
+                             SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePostcomputeImposedState");
+    for (unsigned face = 0; face < NumFaces; ++face) {
+      if constexpr (NumFaces == 1) {
+        common::postcomputeImposedStateFromNewStress(faultStresses,
+                                                     tractionResults,
+                                                     impAndEta[ltsFace],
+                                                     impedanceMatrices[ltsFace],
+                                                     imposedStatePlus[ltsFace],
+                                                     imposedStateMinus[ltsFace],
+                                                     qInterpolatedPlus[ltsFace],
+                                                     qInterpolatedMinus[ltsFace],
+                                                     timeWeights,
+                                                     0,
+                                                     accumulateImposedState);
+      } else {
+        alignas(ALIGNMENT) FaultStresses faceStresses{};
+        alignas(ALIGNMENT) TractionResults faceResults{};
+        copyFromTile<NumFaces>(faultStresses.normalStress, faceStresses.normalStress, face);
+        copyFromTile<NumFaces>(faultStresses.traction1, faceStresses.traction1, face);
+        copyFromTile<NumFaces>(faultStresses.traction2, faceStresses.traction2, face);
+        copyFromTile<NumFaces>(faultStresses.fluidPressure, faceStresses.fluidPressure, face);
+        copyFromTile<NumFaces>(tractionResults.traction1, faceResults.traction1, face);
+        copyFromTile<NumFaces>(tractionResults.traction2, faceResults.traction2, face);
+        common::postcomputeImposedStateFromNewStress(faceStresses,
+                                                     faceResults,
+                                                     impAndEta[ltsFace + face],
+                                                     impedanceMatrices[ltsFace + face],
+                                                     imposedStatePlus[ltsFace + face],
+                                                     imposedStateMinus[ltsFace + face],
+                                                     qInterpolatedPlus[ltsFace + face],
+                                                     qInterpolatedMinus[ltsFace + face],
+                                                     timeWeights,
+                                                     0,
+                                                     accumulateImposedState);
+      }
+    }
+    LIKWID_MARKER_STOP("computeDynamicRupturePostcomputeImposedState");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    if (this->drParameters->isFrictionEnergyRequired) {
+      for (unsigned face = ltsFace; face < ltsFace + NumFaces; ++face) {
+        common::computeFrictionEnergy(energyData[face],
+                                      qInterpolatedPlus[face],
+                                      qInterpolatedMinus[face],
+                                      impAndEta[face],
                                       timeWeights,
                                       spaceWeights,
-                                      godunovData[ltsFace]);
+                                      godunovData[face]);
       }
     }
+
+    return locked ? NumFaces : 0;
+  }
+
+  /**
+   * Returns true if the faces ltsFace, ..., ltsFace + numberOfFaces - 1 are provably locked at
+   * the beginning of the time step.
+   * Friction laws which support the elastic path for locked faces override this function.
+   */
+  bool isLocked(unsigned int ltsFace, unsigned int numberOfFaces) const { return false; }
+
+  /**
+   * Elastic path for locked faces: Sets the traction for the sub time step and
+   * returns true if the faces stay locked; returns false (without changing anything)
+   * if the faces need to be reactivated.
+   */
+  template <unsigned NumFaces>
+  bool updateLockedFace(FaultStressesTile<NumFaces> const& faultStresses,
+                        TractionResultsTile<NumFaces>& tractionResults,
+                        unsigned int ltsFace,
+                        unsigned int timeIndex) {
+    return false;
+  }
+
+  protected:
+  /**
+   * Returns a flat pointer to the points of the faces ltsFace, ltsFace + 1, ... of a DR variable,
+   * i.e. the point index relative to the first face of a tile runs up to
+   * NumFaces * misc::numPaddedPoints. The layer stores the variable as one contiguous array, so
+   * we address it from its start instead of indexing beyond the row variable[ltsFace].
+   */
+  template <typename T>
+  static T* tilePointer(T (*variable)[misc::numPaddedPoints], unsigned ltsFace) {
+    return &variable[0][0] + static_cast<std::size_t>(ltsFace) * misc::numPaddedPoints;
+  }
+
+  private:
+  template <unsigned NumFaces>
+  static void copyToTile(const real (&face)[CONVERGENCE_ORDER][misc::numPaddedPoints],
+                         real (&tile)[CONVERGENCE_ORDER][NumFaces * misc::numPaddedPoints],
+                         unsigned faceInTile) {
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+      std::copy_n(face[timeIndex],
+                  misc::numPaddedPoints,
+                  &tile[timeIndex][faceInTile * misc::numPaddedPoints]);
+    }
+  }
+
+  template <unsigned NumFaces>
+  static void copyFromTile(const real (&tile)[CONVERGENCE_ORDER][NumFaces * misc::numPaddedPoints],
+                           real (&face)[CONVERGENCE_ORDER][misc::numPaddedPoints],
+                           unsigned faceInTile) {
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+      std::copy_n(&tile[timeIndex][faceInTile * misc::numPaddedPoints],
+                  misc::numPaddedPoints,
+                  face[timeIndex]);
+    }
   }
 };
 } // namespace seissol::dr::friction_law
@@ -16,7 +16,7 @@ class FastVelocityWeakeningLaw
    */
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {
+                          double fullUpdateTime) {
     auto* concreteLts =
         dynamic_cast<seissol::initializers::LTSRateAndStateFastVelocityWeakening const* const>(
             dynRup);
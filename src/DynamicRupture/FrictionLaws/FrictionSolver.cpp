@@ -15,7 +15,7 @@ void FrictionSolver::computeDeltaT(const double timePoints[CONVERGENCE_ORDER]) {
 
 void FrictionSolver::copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                                         seissol::initializers::DynamicRupture const* const dynRup,
-                                        real fullUpdateTime) {
+                                        double fullUpdateTime) {
   impAndEta = layerData.var(dynRup->impAndEta);
   impedanceMatrices = layerData.var(dynRup->impedanceMatrices);
   initialStressInFaultCS = layerData.var(dynRup->initialStressInFaultCS);
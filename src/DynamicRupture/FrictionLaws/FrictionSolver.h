@@ -6,7 +6,32 @@
 #include "Initializer/DynamicRupture.h"
 #include "Kernels/DynamicRupture.h"
 
+#include <cassert>
+
 namespace seissol::dr::friction_law {
+/**
+ * Statistics of the iterative slip rate solvers, summed over one call to evaluate
+ */
+struct IterationStatistics {
+  static constexpr unsigned NumberOfBins = 16;
+
+  /** Number of friction updates (faces times sub time steps) */
+  unsigned long long numberOfUpdates = 0;
+  /** Number of slip rate inversions with the given number of Newton iterations, the last bin
+   * collects all inversions with NumberOfBins - 1 or more iterations */
+  unsigned long long histogram[NumberOfBins] = {};
+  /** Number of points which needed the bracketed fallback solver */
+  unsigned long long numberOfFallbackPoints = 0;
+
+  void add(IterationStatistics const& other) {
+    numberOfUpdates += other.numberOfUpdates;
+    for (unsigned bin = 0; bin < NumberOfBins; ++bin) {
+      histogram[bin] += other.histogram[bin];
+    }
+    numberOfFallbackPoints += other.numberOfFallbackPoints;
+  }
+};
+
 /**
  * Abstract Base for friction solver class with the public interface
  * Only needed to be able to store a shared_ptr<FrictionSolver> in MemoryManager and TimeCluster.
@@ -25,23 +50,71 @@ class FrictionSolver {
 
   virtual void evaluate(seissol::initializers::Layer& layerData,
                         seissol::initializers::DynamicRupture const* const dynRup,
-                        real fullUpdateTime,
+                        double fullUpdateTime,
                         const double timeWeights[CONVERGENCE_ORDER]) = 0;
 
+  /**
+   * evaluates the friction model on the faces startFace, ..., startFace + numberOfFaces - 1 of
+   * the layer only, e.g. on one batch of the host DR pipeline.
+   * The default implementation only supports the whole layer.
+   */
+  virtual void evaluateBatch(seissol::initializers::Layer& layerData,
+                             seissol::initializers::DynamicRupture const* const dynRup,
+                             double fullUpdateTime,
+                             const double timeWeights[CONVERGENCE_ORDER],
+                             unsigned startFace,
+                             unsigned numberOfFaces) {
+    assert(startFace == 0 && numberOfFaces == layerData.getNumberOfCells());
+    evaluate(layerData, dynRup, fullUpdateTime, timeWeights);
+  }
+
   /**
    * compute the DeltaT from the current timePoints call this function before evaluate
    * to set the correct DeltaT
    */
   void computeDeltaT(const double timePoints[CONVERGENCE_ORDER]);
 
+  /**
+   * If set, the following calls to evaluate (or evaluateBatch) add the time integrated imposed
+   * state to the one of the previous call instead of overwriting it. This is used to sub-cycle
+   * the friction law within one time step of the cluster.
+   * Only supported by the host implementation.
+   */
+  void setAccumulateImposedState(bool accumulate) { accumulateImposedState = accumulate; }
+
   /**
    * copies all common parameters from the DynamicRupture LTS to the local attributes
    */
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime);
+                          double fullUpdateTime);
+
+  /**
+   * @return the number of faces which stayed locked during the last call to evaluate (or
+   * evaluateBatch) and hence skipped the friction update
+   */
+  unsigned getNumberOfLockedFaces() const { return numberOfLockedFaces; }
+
+  /**
+   * @return the statistics of the iterative solver during the last call to evaluate (or
+   * evaluateBatch)
+   */
+  IterationStatistics const& getIterationStatistics() const { return iterationStatistics; }
 
   protected:
+  /**
+   * The statistics of the calling thread. The solvers count into them without synchronization;
+   * evaluateBatch merges them into iterationStatistics once per thread.
+   */
+  static IterationStatistics& threadIterationStatistics() {
+    static thread_local IterationStatistics statistics;
+    return statistics;
+  }
+
+  unsigned numberOfLockedFaces = 0;
+  IterationStatistics iterationStatistics;
+  bool accumulateImposedState = false;
+
   /**
    * Adjust initial stress by adding nucleation stress * nucleation function
    * For reference, see: https://strike.scec.org/cvws/download/SCEC_validation_slip_law.pdf.
@@ -51,19 +124,19 @@ class FrictionSolver {
   dr::DRParameters* drParameters;
   ImpedancesAndEta* impAndEta;
   ImpedanceMatrices* impedanceMatrices;
-  real mFullUpdateTime;
+  realAcc mFullUpdateTime;
   // CS = coordinate system
   real (*initialStressInFaultCS)[misc::numPaddedPoints][6];
   real (*nucleationStressInFaultCS)[misc::numPaddedPoints][6];
   real (*cohesion)[misc::numPaddedPoints];
-  real (*mu)[misc::numPaddedPoints];
-  real (*accumulatedSlipMagnitude)[misc::numPaddedPoints];
-  real (*slip1)[misc::numPaddedPoints];
-  real (*slip2)[misc::numPaddedPoints];
+  realAcc (*mu)[misc::numPaddedPoints];
+  realAcc (*accumulatedSlipMagnitude)[misc::numPaddedPoints];
+  realAcc (*slip1)[misc::numPaddedPoints];
+  realAcc (*slip2)[misc::numPaddedPoints];
   real (*slipRateMagnitude)[misc::numPaddedPoints];
-  real (*slipRate1)[misc::numPaddedPoints];
-  real (*slipRate2)[misc::numPaddedPoints];
-  real (*ruptureTime)[misc::numPaddedPoints];
+  realAcc (*slipRate1)[misc::numPaddedPoints];
+  realAcc (*slipRate2)[misc::numPaddedPoints];
+  realAcc (*ruptureTime)[misc::numPaddedPoints];
   bool (*ruptureTimePending)[misc::numPaddedPoints];
   real (*peakSlipRate)[misc::numPaddedPoints];
   real (*traction1)[misc::numPaddedPoints];
@@ -77,7 +150,7 @@ class FrictionSolver {
   real (*nucleationPressure)[misc::numPaddedPoints];
 
   // be careful only for some FLs initialized:
-  real (*dynStressTime)[misc::numPaddedPoints];
+  realAcc (*dynStressTime)[misc::numPaddedPoints];
   bool (*dynStressTimePending)[misc::numPaddedPoints];
 
   real (*qInterpolatedPlus)[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
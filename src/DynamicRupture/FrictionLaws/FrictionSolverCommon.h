@@ -229,6 +229,8 @@ inline void checkAlignmentPostCompute(
  * @param[in] timeWeights
  * @param[out] imposedStatePlus
  * @param[out] imposedStateMinus
+ * @param[in] accumulate If true, the time integral is added to the imposed state instead of
+ * overwriting it, e.g. for all but the first friction sub step of a time step
  */
 template <RangeType Type = RangeType::CPU>
 inline void postcomputeImposedStateFromNewStress(
@@ -241,15 +243,18 @@ inline void postcomputeImposedStateFromNewStress(
     const real qInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
     const real qInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
     const double timeWeights[CONVERGENCE_ORDER],
-    unsigned startIndex = 0) {
+    unsigned startIndex = 0,
+    bool accumulate = false) {
 
   // set imposed state to zero
-  using QInterpolatedRange = typename QInterpolated<Type>::Range;
-  for (auto index = QInterpolatedRange::start; index < QInterpolatedRange::end;
-       index += QInterpolatedRange::step) {
-    auto i{startIndex + index};
-    imposedStatePlus[i] = static_cast<real>(0.0);
-    imposedStateMinus[i] = static_cast<real>(0.0);
+  if (!accumulate) {
+    using QInterpolatedRange = typename QInterpolated<Type>::Range;
+    for (auto index = QInterpolatedRange::start; index < QInterpolatedRange::end;
+         index += QInterpolatedRange::step) {
+      auto i{startIndex + index};
+      imposedStatePlus[i] = static_cast<real>(0.0);
+      imposedStateMinus[i] = static_cast<real>(0.0);
+    }
   }
 #ifndef USE_POROELASTIC
   const auto invZs = impAndEta.invZs;
@@ -406,9 +411,9 @@ template <RangeType Type = RangeType::CPU>
 inline void saveRuptureFrontOutput(bool ruptureTimePending[misc::numPaddedPoints],
                                    // See https://github.com/llvm/llvm-project/issues/60163
                                    // NOLINTNEXTLINE
-                                   real ruptureTime[misc::numPaddedPoints],
+                                   realAcc ruptureTime[misc::numPaddedPoints],
                                    const real slipRateMagnitude[misc::numPaddedPoints],
-                                   real fullUpdateTime,
+                                   realAcc fullUpdateTime,
                                    unsigned startIndex = 0) {
 
   using Range = typename NumPoints<Type>::Range;
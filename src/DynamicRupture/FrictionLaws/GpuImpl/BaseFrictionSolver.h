@@ -17,7 +17,7 @@ class BaseFrictionSolver : public FrictionSolverDetails {
 
   void evaluate(seissol::initializers::Layer& layerData,
                 seissol::initializers::DynamicRupture const* const dynRup,
-                real fullUpdateTime,
+                double fullUpdateTime,
                 const double timeWeights[CONVERGENCE_ORDER]) override {
 
     FrictionSolver::copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
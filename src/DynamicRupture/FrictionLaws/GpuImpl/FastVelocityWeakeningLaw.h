@@ -13,11 +13,11 @@ class FastVelocityWeakeningLaw
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {}
+                          double fullUpdateTime) {}
 
   void copySpecificLtsDataTreeToLocal(seissol::initializers::Layer& layerData,
                                       seissol::initializers::DynamicRupture const* const dynRup,
-                                      real fullUpdateTime) override {
+                                      double fullUpdateTime) override {
     using SelfInitializerType = seissol::initializers::LTSRateAndStateFastVelocityWeakening;
     auto* concreteLts = dynamic_cast<SelfInitializerType const* const>(dynRup);
     this->srW = layerData.var(concreteLts->rsSrW);
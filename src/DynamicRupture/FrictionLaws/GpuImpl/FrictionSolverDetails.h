@@ -23,7 +23,7 @@ class FrictionSolverDetails : public FrictionSolverInterface {
   virtual void
       copySpecificLtsDataTreeToLocal(seissol::initializers::Layer& layerData,
                                      seissol::initializers::DynamicRupture const* const dynRup,
-                                     real fullUpdateTime) = 0;
+                                     double fullUpdateTime) = 0;
 
   protected:
   size_t currLayerSize{};
@@ -163,7 +163,7 @@ class LinearSlipWeakeningLaw
 
   void copySpecificLtsDataTreeToLocal(seissol::initializers::Layer& layerData,
                                       seissol::initializers::DynamicRupture const* const dynRup,
-                                      real fullUpdateTime) override {
+                                      double fullUpdateTime) override {
     auto* concreteLts =
         dynamic_cast<seissol::initializers::LTSLinearSlipWeakening const* const>(dynRup);
     this->dC = layerData.var(concreteLts->dC);
@@ -225,7 +225,7 @@ class LinearSlipWeakeningLaw
     auto* devDC{this->dC};
     auto* devResample{this->resampleMatrix};
     auto deltaT{this->deltaT[timeIndex]};
-    const real tn{this->mFullUpdateTime + deltaT};
+    const realAcc tn{this->mFullUpdateTime + deltaT};
     const auto t0{this->drParameters->t0};
 
     sycl::nd_range rng{{this->currLayerSize * misc::numPaddedPoints}, {misc::numPaddedPoints}};
@@ -249,15 +249,15 @@ class LinearSlipWeakeningLaw
         // Actually slip is already the stateVariable for this FL, but to simplify the next
         // equations we divide it here by the critical distance.
         const real localStateVariable =
-            std::min(std::fabs(devAccumulatedSlipMagnitude[ltsFace][pointIndex]) /
-                         devDC[ltsFace][pointIndex],
+            std::min(static_cast<real>(std::fabs(devAccumulatedSlipMagnitude[ltsFace][pointIndex]) /
+                                       devDC[ltsFace][pointIndex]),
                      static_cast<real>(1.0));
 
         real f2 = 0.0;
         if (t0 == 0) {
           f2 = 1.0 * (tn >= devForcedRuptureTime[ltsFace][pointIndex]);
         } else {
-          f2 = std::clamp((tn - devForcedRuptureTime[ltsFace][pointIndex]) / t0,
+          f2 = std::clamp(static_cast<real>((tn - devForcedRuptureTime[ltsFace][pointIndex]) / t0),
                           static_cast<real>(0.0),
                           static_cast<real>(1.0));
         }
@@ -276,7 +276,7 @@ class NoSpecialization {
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {}
+                          double fullUpdateTime) {}
 
   static real resampleSlipRate(real const* resampleMatrix,
                                real const (&slipRateMagnitude)[dr::misc::numPaddedPoints],
@@ -316,7 +316,7 @@ class BiMaterialFault {
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {
+                          double fullUpdateTime) {
     auto* concreteLts =
         dynamic_cast<seissol::initializers::LTSLinearSlipWeakeningBimaterial const* const>(dynRup);
     this->regularisedStrength = layerData.var(concreteLts->regularisedStrength);
@@ -329,7 +329,7 @@ class BiMaterialFault {
   };
 
   struct Details {
-    real (*regularisedStrength)[misc::numPaddedPoints];
+    realAcc (*regularisedStrength)[misc::numPaddedPoints];
   };
 
   Details getCurrentLayerDetails() {
@@ -360,7 +360,7 @@ class BiMaterialFault {
   };
 
   private:
-  real (*regularisedStrength)[misc::numPaddedPoints];
+  realAcc (*regularisedStrength)[misc::numPaddedPoints];
 };
 } // namespace seissol::dr::friction_law::gpu
 
@@ -52,7 +52,7 @@ class RateAndStateBase : public BaseFrictionSolver<RateAndStateBase<Derived, TPM
 
   void copySpecificLtsDataTreeToLocal(seissol::initializers::Layer& layerData,
                                       seissol::initializers::DynamicRupture const* const dynRup,
-                                      real fullUpdateTime) override {
+                                      double fullUpdateTime) override {
     auto* concreteLts = dynamic_cast<seissol::initializers::LTSRateAndState const* const>(dynRup);
     this->a = layerData.var(concreteLts->rsA);
     this->sl0 = layerData.var(concreteLts->rsSl0);
@@ -96,7 +96,7 @@ class RateAndStateBase : public BaseFrictionSolver<RateAndStateBase<Derived, TPM
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {
+                          double fullUpdateTime) {
     auto* concreteLts = dynamic_cast<seissol::initializers::LTSRateAndState const* const>(dynRup);
     a = layerData.var(concreteLts->rsA);
     sl0 = layerData.var(concreteLts->rsSl0);
@@ -398,7 +398,7 @@ class RateAndStateBase : public BaseFrictionSolver<RateAndStateBase<Derived, TPM
   protected:
   real (*a)[misc::numPaddedPoints];
   real (*sl0)[misc::numPaddedPoints];
-  real (*stateVariable)[misc::numPaddedPoints];
+  realAcc (*stateVariable)[misc::numPaddedPoints];
   bool* hasConverged{};
 
   TPMethod tpMethod;
@@ -12,7 +12,7 @@ class SlowVelocityWeakeningLaw
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {}
+                          double fullUpdateTime) {}
 
   // Note that we need double precision here, since single precision led to NaNs.
   void updateStateVariable(double timeIncrement) {
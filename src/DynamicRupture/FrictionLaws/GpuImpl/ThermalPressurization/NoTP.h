@@ -10,10 +10,10 @@ class NoTP {
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {}
+                          double fullUpdateTime) {}
 
   void calcFluidPressure(real (*normalStress)[misc::numPaddedPoints],
-                         real (*mu)[misc::numPaddedPoints],
+                         realAcc (*mu)[misc::numPaddedPoints],
                          real (*slipRateMagnitude)[misc::numPaddedPoints],
                          real deltaT,
                          bool saveTmpInTP) {}
@@ -14,7 +14,7 @@ class ImposedSlipRates : public BaseFrictionLaw<ImposedSlipRates<STF>> {
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {
+                          double fullUpdateTime) {
     auto* concreteLts =
         dynamic_cast<seissol::initializers::LTSImposedSlipRates const* const>(dynRup);
     imposedSlipDirection1 = layerData.var(concreteLts->imposedSlipDirection1);
@@ -29,7 +29,7 @@ class ImposedSlipRates : public BaseFrictionLaw<ImposedSlipRates<STF>> {
                              unsigned ltsFace,
                              unsigned timeIndex) {
     const real timeIncrement = this->deltaT[timeIndex];
-    real currentTime = this->mFullUpdateTime;
+    realAcc currentTime = this->mFullUpdateTime;
     for (unsigned i = 0; i <= timeIndex; i++) {
       currentTime += this->deltaT[i];
     }
@@ -12,7 +12,7 @@ void NoSpecialization::resampleSlipRate(
 }
 void BiMaterialFault::copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                                          seissol::initializers::DynamicRupture const* const dynRup,
-                                         real fullUpdateTime) {
+                                         double fullUpdateTime) {
   auto* concreteLts =
       dynamic_cast<seissol::initializers::LTSLinearSlipWeakeningBimaterial const* const>(dynRup);
   regularisedStrength = layerData.var(concreteLts->regularisedStrength);
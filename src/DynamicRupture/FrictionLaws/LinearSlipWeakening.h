@@ -18,10 +18,17 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
       : BaseFrictionLaw<LinearSlipWeakeningLaw<SpecializationT>>(drParameters),
         specialization(drParameters) {}
 
-  void updateFrictionAndSlip(FaultStresses const& faultStresses,
-                             TractionResults& tractionResults,
-                             std::array<real, misc::numPaddedPoints>& stateVariableBuffer,
-                             std::array<real, misc::numPaddedPoints>& strengthBuffer,
+  /**
+   * The hooks work on tiles of consecutive faces; the DR variables are indexed with the point
+   * index relative to the first face of the tile, through the flat pointers from tilePointer().
+   */
+  static constexpr bool SupportsFaceBatching = SpecializationT::SupportsFaceBatching;
+
+  template <unsigned NumFaces, std::size_t NumPoints>
+  void updateFrictionAndSlip(FaultStressesTile<NumFaces> const& faultStresses,
+                             TractionResultsTile<NumFaces>& tractionResults,
+                             std::array<real, NumPoints>& stateVariableBuffer,
+                             std::array<real, NumPoints>& strengthBuffer,
                              unsigned int ltsFace,
                              unsigned int timeIndex) {
     // computes fault strength, which is the critical value whether active slip exists.
@@ -41,7 +48,7 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {
+                          double fullUpdateTime) {
     auto* concreteLts =
         dynamic_cast<seissol::initializers::LTSLinearSlipWeakening const* const>(dynRup);
     this->dC = layerData.var(concreteLts->dC);
@@ -52,70 +59,168 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
     specialization.copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
   }
 
+  /**
+   * A face is locked if it has not slipped yet and the friction coefficient is still static.
+   */
+  bool isLocked(unsigned int ltsFace, unsigned int numberOfFaces) const {
+    if constexpr (!SpecializationT::AllowsLockedFaces) {
+      return false;
+    }
+    bool locked = true;
+    for (unsigned face = ltsFace; face < ltsFace + numberOfFaces; face++) {
+      for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints;
+           pointIndex++) {
+        locked &= this->slipRateMagnitude[face][pointIndex] == 0.0 &&
+                  this->accumulatedSlipMagnitude[face][pointIndex] == 0.0 &&
+                  this->ruptureTimePending[face][pointIndex] &&
+                  this->mu[face][pointIndex] == muS[face][pointIndex];
+      }
+    }
+    return locked;
+  }
+
+  /**
+   * If the shear traction stays below the fault strength and the forced rupture has not started,
+   * updateFrictionAndSlip yields zero slip rate, leaves slip and friction unchanged and passes
+   * the traction through. Hence, we only copy the traction in this case.
+   */
+  template <unsigned NumFaces>
+  bool updateLockedFace(FaultStressesTile<NumFaces> const& faultStresses,
+                        TractionResultsTile<NumFaces>& tractionResults,
+                        unsigned int ltsFace,
+                        unsigned int timeIndex) {
+    real (*initialStressInFaultCSTile)[6] =
+        this->tilePointer(this->initialStressInFaultCS, ltsFace);
+    real* initialPressureTile = this->tilePointer(this->initialPressure, ltsFace);
+    real* cohesionTile = this->tilePointer(this->cohesion, ltsFace);
+    realAcc* muTile = this->tilePointer(this->mu, ltsFace);
+    real* forcedRuptureTimeTile = this->tilePointer(this->forcedRuptureTime, ltsFace);
+    real* traction1Tile = this->tilePointer(this->traction1, ltsFace);
+    real* traction2Tile = this->tilePointer(this->traction2, ltsFace);
+    const realAcc time = this->mFullUpdateTime + this->deltaT[timeIndex];
+    bool locked = true;
+    for (unsigned face = 0; face < NumFaces; face++) {
+      for (unsigned pointIndex = face * misc::numPaddedPoints;
+           pointIndex < face * misc::numPaddedPoints + misc::numberOfBoundaryGaussPoints;
+           pointIndex++) {
+        const real totalNormalStress = initialStressInFaultCSTile[pointIndex][0] +
+                                       faultStresses.normalStress[timeIndex][pointIndex] +
+                                       initialPressureTile[pointIndex] +
+                                       faultStresses.fluidPressure[timeIndex][pointIndex];
+        const real strength =
+            -cohesionTile[pointIndex] -
+            muTile[pointIndex] * std::min(totalNormalStress, static_cast<real>(0.0));
+
+        const real totalTraction1 = initialStressInFaultCSTile[pointIndex][3] +
+                                    faultStresses.traction1[timeIndex][pointIndex];
+        const real totalTraction2 = initialStressInFaultCSTile[pointIndex][5] +
+                                    faultStresses.traction2[timeIndex][pointIndex];
+
+        locked &= misc::magnitude(totalTraction1, totalTraction2) < strength &&
+                  time < forcedRuptureTimeTile[pointIndex];
+      }
+    }
+    if (!locked) {
+      return false;
+    }
+
+#pragma omp simd
+    for (unsigned pointIndex = 0; pointIndex < NumFaces * misc::numPaddedPoints; pointIndex++) {
+      tractionResults.traction1[timeIndex][pointIndex] =
+          faultStresses.traction1[timeIndex][pointIndex];
+      tractionResults.traction2[timeIndex][pointIndex] =
+          faultStresses.traction2[timeIndex][pointIndex];
+      traction1Tile[pointIndex] = tractionResults.traction1[timeIndex][pointIndex];
+      traction2Tile[pointIndex] = tractionResults.traction2[timeIndex][pointIndex];
+    }
+    return true;
+  }
+
   /**
    *  compute the slip rate and the traction from the fault strength and fault stresses
    *  also updates the directional slip1 and slip2
    */
-  void calcSlipRateAndTraction(FaultStresses const& faultStresses,
-                               TractionResults& tractionResults,
-                               std::array<real, misc::numPaddedPoints>& strength,
+  template <unsigned NumFaces>
+  void calcSlipRateAndTraction(FaultStressesTile<NumFaces> const& faultStresses,
+                               TractionResultsTile<NumFaces>& tractionResults,
+                               std::array<real, NumFaces * misc::numPaddedPoints>& strength,
                                unsigned int timeIndex,
                                unsigned int ltsFace) {
+    real (*initialStressInFaultCSTile)[6] =
+        this->tilePointer(this->initialStressInFaultCS, ltsFace);
+    real* slipRateMagnitudeTile = this->tilePointer(this->slipRateMagnitude, ltsFace);
+    realAcc* slipRate1Tile = this->tilePointer(this->slipRate1, ltsFace);
+    realAcc* slipRate2Tile = this->tilePointer(this->slipRate2, ltsFace);
+    real* traction1Tile = this->tilePointer(this->traction1, ltsFace);
+    real* traction2Tile = this->tilePointer(this->traction2, ltsFace);
+    realAcc* slip1Tile = this->tilePointer(this->slip1, ltsFace);
+    realAcc* slip2Tile = this->tilePointer(this->slip2, ltsFace);
+    // impedances of the face of each point
+    alignas(ALIGNMENT) real etaS[NumFaces * misc::numPaddedPoints];
+    alignas(ALIGNMENT) real invEtaS[NumFaces * misc::numPaddedPoints];
+    for (unsigned face = 0; face < NumFaces; face++) {
+      std::fill_n(&etaS[face * misc::numPaddedPoints],
+                  misc::numPaddedPoints,
+                  this->impAndEta[ltsFace + face].etaS);
+      std::fill_n(&invEtaS[face * misc::numPaddedPoints],
+                  misc::numPaddedPoints,
+                  this->impAndEta[ltsFace + face].invEtaS);
+    }
+
 #pragma omp simd
-    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+    for (unsigned pointIndex = 0; pointIndex < NumFaces * misc::numPaddedPoints; pointIndex++) {
       // calculate absolute value of stress in Y and Z direction
-      const real totalTraction1 = this->initialStressInFaultCS[ltsFace][pointIndex][3] +
+      const real totalTraction1 = initialStressInFaultCSTile[pointIndex][3] +
                                   faultStresses.traction1[timeIndex][pointIndex];
-      const real totalTraction2 = this->initialStressInFaultCS[ltsFace][pointIndex][5] +
+      const real totalTraction2 = initialStressInFaultCSTile[pointIndex][5] +
                                   faultStresses.traction2[timeIndex][pointIndex];
       const real absoluteTraction = misc::magnitude(totalTraction1, totalTraction2);
 
       // calculate slip rates
-      this->slipRateMagnitude[ltsFace][pointIndex] =
+      slipRateMagnitudeTile[pointIndex] =
           std::max(static_cast<real>(0.0),
-                   (absoluteTraction - strength[pointIndex]) * this->impAndEta[ltsFace].invEtaS);
+                   (absoluteTraction - strength[pointIndex]) * invEtaS[pointIndex]);
 
-      const auto divisor = strength[pointIndex] + this->impAndEta[ltsFace].etaS *
-                                                      this->slipRateMagnitude[ltsFace][pointIndex];
-      this->slipRate1[ltsFace][pointIndex] =
-          this->slipRateMagnitude[ltsFace][pointIndex] * totalTraction1 / divisor;
-      this->slipRate2[ltsFace][pointIndex] =
-          this->slipRateMagnitude[ltsFace][pointIndex] * totalTraction2 / divisor;
+      const auto divisor =
+          strength[pointIndex] + etaS[pointIndex] * slipRateMagnitudeTile[pointIndex];
+      slipRate1Tile[pointIndex] = slipRateMagnitudeTile[pointIndex] * totalTraction1 / divisor;
+      slipRate2Tile[pointIndex] = slipRateMagnitudeTile[pointIndex] * totalTraction2 / divisor;
 
       // calculate traction
       tractionResults.traction1[timeIndex][pointIndex] =
           faultStresses.traction1[timeIndex][pointIndex] -
-          this->impAndEta[ltsFace].etaS * this->slipRate1[ltsFace][pointIndex];
+          etaS[pointIndex] * slipRate1Tile[pointIndex];
       tractionResults.traction2[timeIndex][pointIndex] =
           faultStresses.traction2[timeIndex][pointIndex] -
-          this->impAndEta[ltsFace].etaS * this->slipRate2[ltsFace][pointIndex];
-      this->traction1[ltsFace][pointIndex] = tractionResults.traction1[timeIndex][pointIndex];
-      this->traction2[ltsFace][pointIndex] = tractionResults.traction2[timeIndex][pointIndex];
+          etaS[pointIndex] * slipRate2Tile[pointIndex];
+      traction1Tile[pointIndex] = tractionResults.traction1[timeIndex][pointIndex];
+      traction2Tile[pointIndex] = tractionResults.traction2[timeIndex][pointIndex];
 
       // update directional slip
-      this->slip1[ltsFace][pointIndex] +=
-          this->slipRate1[ltsFace][pointIndex] * this->deltaT[timeIndex];
-      this->slip2[ltsFace][pointIndex] +=
-          this->slipRate2[ltsFace][pointIndex] * this->deltaT[timeIndex];
+      slip1Tile[pointIndex] += slipRate1Tile[pointIndex] * this->deltaT[timeIndex];
+      slip2Tile[pointIndex] += slipRate2Tile[pointIndex] * this->deltaT[timeIndex];
     }
   }
 
-  void preHook(std::array<real, misc::numPaddedPoints>& stateVariableBuffer,
-               unsigned int ltsFace){};
-  void postHook(std::array<real, misc::numPaddedPoints>& stateVariableBuffer,
-                unsigned int ltsFace){};
+  template <std::size_t NumPoints>
+  void preHook(std::array<real, NumPoints>& stateVariableBuffer, unsigned int ltsFace){};
+  template <std::size_t NumPoints>
+  void postHook(std::array<real, NumPoints>& stateVariableBuffer, unsigned int ltsFace){};
 
   /**
    * evaluate friction law: updated mu -> friction law
    * for example see Carsten Uphoff's thesis: Eq. 2.45
    */
-  void frictionFunctionHook(std::array<real, misc::numPaddedPoints>& stateVariable,
-                            unsigned int ltsFace) {
+  template <std::size_t NumPoints>
+  void frictionFunctionHook(std::array<real, NumPoints>& stateVariable, unsigned int ltsFace) {
+    realAcc* muTile = this->tilePointer(this->mu, ltsFace);
+    real* muSTile = this->tilePointer(this->muS, ltsFace);
+    real* muDTile = this->tilePointer(this->muD, ltsFace);
 #pragma omp simd
-    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
-      this->mu[ltsFace][pointIndex] =
-          muS[ltsFace][pointIndex] -
-          (muS[ltsFace][pointIndex] - muD[ltsFace][pointIndex]) * stateVariable[pointIndex];
+    for (unsigned pointIndex = 0; pointIndex < NumPoints; pointIndex++) {
+      muTile[pointIndex] =
+          muSTile[pointIndex] -
+          (muSTile[pointIndex] - muDTile[pointIndex]) * stateVariable[pointIndex];
     }
   }
 
@@ -134,60 +239,78 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
     }
   }
 
-  void calcStrengthHook(FaultStresses const& faultStresses,
-                        std::array<real, misc::numPaddedPoints>& strength,
+  template <unsigned NumFaces>
+  void calcStrengthHook(FaultStressesTile<NumFaces> const& faultStresses,
+                        std::array<real, NumFaces * misc::numPaddedPoints>& strength,
                         unsigned int timeIndex,
                         unsigned int ltsFace) {
+    real (*initialStressInFaultCSTile)[6] =
+        this->tilePointer(this->initialStressInFaultCS, ltsFace);
+    real* initialPressureTile = this->tilePointer(this->initialPressure, ltsFace);
+    real* cohesionTile = this->tilePointer(this->cohesion, ltsFace);
+    realAcc* muTile = this->tilePointer(this->mu, ltsFace);
+    real* slipRateMagnitudeTile = this->tilePointer(this->slipRateMagnitude, ltsFace);
 #pragma omp simd
-    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+    for (unsigned pointIndex = 0; pointIndex < NumFaces * misc::numPaddedPoints; pointIndex++) {
       // calculate fault strength (Uphoff eq 2.44) with addition cohesion term
-      const real totalNormalStress = this->initialStressInFaultCS[ltsFace][pointIndex][0] +
+      const real totalNormalStress = initialStressInFaultCSTile[pointIndex][0] +
                                      faultStresses.normalStress[timeIndex][pointIndex] +
-                                     this->initialPressure[ltsFace][pointIndex] +
+                                     initialPressureTile[pointIndex] +
                                      faultStresses.fluidPressure[timeIndex][pointIndex];
 
       strength[pointIndex] =
-          -cohesion[ltsFace][pointIndex] -
-          this->mu[ltsFace][pointIndex] * std::min(totalNormalStress, static_cast<real>(0.0));
+          -cohesionTile[pointIndex] -
+          muTile[pointIndex] * std::min(totalNormalStress, static_cast<real>(0.0));
 
       strength[pointIndex] =
           specialization.strengthHook(strength[pointIndex],
-                                      this->slipRateMagnitude[ltsFace][pointIndex],
+                                      slipRateMagnitudeTile[pointIndex],
                                       this->deltaT[timeIndex],
-                                      ltsFace,
-                                      pointIndex);
+                                      ltsFace + pointIndex / misc::numPaddedPoints,
+                                      pointIndex % misc::numPaddedPoints);
     }
   }
 
-  void calcStateVariableHook(std::array<real, misc::numPaddedPoints>& stateVariable,
+  template <std::size_t NumPoints>
+  void calcStateVariableHook(std::array<real, NumPoints>& stateVariable,
                              unsigned int timeIndex,
                              unsigned int ltsFace) {
-    alignas(ALIGNMENT) real resampledSlipRate[misc::numPaddedPoints]{};
-    specialization.resampleSlipRate(resampledSlipRate, this->slipRateMagnitude[ltsFace]);
+    realAcc* accumulatedSlipMagnitudeTile =
+        this->tilePointer(this->accumulatedSlipMagnitude, ltsFace);
+    real* dCTile = this->tilePointer(this->dC, ltsFace);
+    real* forcedRuptureTimeTile = this->tilePointer(this->forcedRuptureTime, ltsFace);
+    constexpr unsigned NumFaces = NumPoints / misc::numPaddedPoints;
+    alignas(ALIGNMENT) real resampledSlipRate[NumFaces][misc::numPaddedPoints]{};
+    for (unsigned face = 0; face < NumFaces; face++) {
+      specialization.resampleSlipRate(resampledSlipRate[face],
+                                      this->slipRateMagnitude[ltsFace + face]);
+    }
+    const real* tileSlipRate = resampledSlipRate[0];
 
-    const real time = this->mFullUpdateTime + this->deltaT[timeIndex];
+    const realAcc time = this->mFullUpdateTime + this->deltaT[timeIndex];
 #pragma omp simd
-    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+    for (unsigned pointIndex = 0; pointIndex < NumPoints; pointIndex++) {
       // integrate slip rate to get slip = state variable
 
-      const auto update = resampledSlipRate[pointIndex] * this->deltaT[timeIndex];
-      this->accumulatedSlipMagnitude[ltsFace][pointIndex] += update;
+      const auto update = tileSlipRate[pointIndex] * this->deltaT[timeIndex];
+      accumulatedSlipMagnitudeTile[pointIndex] += update;
 
       // Actually slip is already the stateVariable for this FL, but to simplify the next equations
       // we divide it here by the critical distance.
-      stateVariable[pointIndex] = std::min(
-          std::fabs(this->accumulatedSlipMagnitude[ltsFace][pointIndex]) / dC[ltsFace][pointIndex],
-          static_cast<real>(1.0));
+      stateVariable[pointIndex] =
+          std::min(static_cast<real>(std::fabs(accumulatedSlipMagnitudeTile[pointIndex]) /
+                                     dCTile[pointIndex]),
+                   static_cast<real>(1.0));
 
       // Forced rupture time
       real f2 = 0.0;
       if (this->drParameters->t0 == 0) {
         // avoid branching
         // if time > forcedRuptureTime, then f2 = 1.0, else f2 = 0.0
-        f2 = 1.0 * (time >= this->forcedRuptureTime[ltsFace][pointIndex]);
+        f2 = 1.0 * (time >= forcedRuptureTimeTile[pointIndex]);
       } else {
-        f2 = std::clamp((time - this->forcedRuptureTime[ltsFace][pointIndex]) /
-                            this->drParameters->t0,
+        f2 = std::clamp(static_cast<real>((time - forcedRuptureTimeTile[pointIndex]) /
+                                          this->drParameters->t0),
                         static_cast<real>(0.0),
                         static_cast<real>(1.0));
       }
@@ -206,11 +329,15 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
 
 class NoSpecialization {
   public:
+  /** The strength only depends on the current stresses */
+  static constexpr bool AllowsLockedFaces = true;
+  static constexpr bool SupportsFaceBatching = true;
+
   explicit NoSpecialization(DRParameters* parameters){};
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime){};
+                          double fullUpdateTime){};
   /**
    * Resample slip-rate, such that the state increment (slip) lies in the same polynomial space as
    * the degrees of freedom resampleMatrix first projects LocSR on the two-dimensional basis on
@@ -234,11 +361,16 @@ class NoSpecialization {
  */
 class BiMaterialFault {
   public:
+  /** The regularised strength evolves even if the fault does not slip */
+  static constexpr bool AllowsLockedFaces = false;
+  /** strengthHook needs the face and point index */
+  static constexpr bool SupportsFaceBatching = false;
+
   explicit BiMaterialFault(DRParameters* parameters) : drParameters(parameters){};
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime);
+                          double fullUpdateTime);
   /**
    * Resampling of the sliprate introduces artificial oscillations into the solution, if we use it
    * together with Prakash-Clifton regularization, so for the BiMaterialFault specialization, we
@@ -257,7 +389,7 @@ class BiMaterialFault {
 
   protected:
   DRParameters* drParameters;
-  real (*regularisedStrength)[misc::numPaddedPoints];
+  realAcc (*regularisedStrength)[misc::numPaddedPoints];
 };
 
 } // namespace seissol::dr::friction_law
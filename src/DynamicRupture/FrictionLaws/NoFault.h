@@ -13,7 +13,7 @@ class NoFault : public BaseFrictionLaw<NoFault> {
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {}
+                          double fullUpdateTime) {}
 
   void updateFrictionAndSlip(FaultStresses const& faultStresses,
                              TractionResults& tractionResults,
@@ -80,7 +80,7 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {
+                          double fullUpdateTime) {
     auto* concreteLts = dynamic_cast<seissol::initializers::LTSRateAndState const* const>(dynRup);
     a = layerData.var(concreteLts->rsA);
     sl0 = layerData.var(concreteLts->rsSl0);
@@ -148,6 +148,8 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
       unsigned int timeIndex,
       unsigned int ltsFace) {
     std::array<real, misc::numPaddedPoints> testSlipRate{0};
+    const bool adaptive = this->drParameters->rsAdaptiveSolver;
+    this->threadIterationStatistics().numberOfUpdates++;
     for (unsigned j = 0; j < settings.numberStateVariableUpdates; j++) {
 #pragma omp simd
       for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
@@ -171,8 +173,30 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
       updateNormalStress(normalStress, faultStresses, timeIndex, ltsFace);
 
       // solve for new slip rate
-      hasConverged = this->invertSlipRateIterative(
-          ltsFace, localStateVariable, normalStress, absoluteShearStress, testSlipRate);
+      if (adaptive) {
+        hasConverged = this->invertSlipRateMasked(
+            ltsFace, localStateVariable, normalStress, absoluteShearStress, testSlipRate);
+      } else {
+        hasConverged = this->invertSlipRateIterative(
+            ltsFace, localStateVariable, normalStress, absoluteShearStress, testSlipRate);
+      }
+
+      // the remaining state variable updates are skipped once the slip rate does not change
+      // anymore, i.e. they would reproduce the current solution up to the Newton tolerance
+      unsigned numberOfChangedPoints = 0;
+      if (adaptive) {
+#pragma omp simd reduction(+ : numberOfChangedPoints)
+        for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints;
+             pointIndex++) {
+          const real newSlipRate = std::fabs(testSlipRate[pointIndex]);
+          const real newLocalSlipRate =
+              0.5 * (this->slipRateMagnitude[ltsFace][pointIndex] + newSlipRate);
+          numberOfChangedPoints +=
+              std::fabs(newSlipRate - this->slipRateMagnitude[ltsFace][pointIndex]) >=
+                  settings.newtonTolerance ||
+              std::fabs(newLocalSlipRate - localSlipRate[pointIndex]) >= settings.newtonTolerance;
+        }
+      }
 
 #pragma omp simd
       for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
@@ -192,6 +216,10 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
                                                   this->slipRateMagnitude[ltsFace][pointIndex],
                                                   localStateVariable[pointIndex]);
       } // End of pointIndex-loop
+
+      if (adaptive && hasConverged && numberOfChangedPoints == 0) {
+        break;
+      }
     }
   }
 
@@ -319,6 +347,7 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
         return std::fabs(val) < settings.newtonTolerance;
       });
       if (hasConverged) {
+        recordSlipRateInversion(i);
         return hasConverged;
       }
 #pragma omp simd
@@ -333,9 +362,144 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
         slipRateTest[pointIndex] = std::max(rs::almostZero(), slipRateTest[pointIndex] - tmp3);
       }
     }
+    recordSlipRateInversion(settings.maxNumberSlipRateUpdates);
     return false;
   }
 
+  /**
+   * Adaptive variant of invertSlipRateIterative: Converged points are masked out of the Newton
+   * iteration, and the iteration stops as soon as all points of the face have converged.
+   * Points which did not converge within settings.maxNumberSlipRateUpdatesAdaptive iterations
+   * are solved with the bracketed solver, see invertSlipRateBracketed.
+   */
+  bool invertSlipRateMasked(unsigned int ltsFace,
+                            std::array<real, misc::numPaddedPoints> const& localStateVariable,
+                            std::array<real, misc::numPaddedPoints> const& normalStress,
+                            std::array<real, misc::numPaddedPoints> const& absoluteShearStress,
+                            std::array<real, misc::numPaddedPoints>& slipRateTest) {
+    // padded points do not take part in the iteration
+    bool converged[misc::numPaddedPoints];
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+      // first guess = sliprate value of the previous step
+      slipRateTest[pointIndex] = this->slipRateMagnitude[ltsFace][pointIndex];
+      converged[pointIndex] = pointIndex >= misc::numberOfBoundaryGaussPoints;
+    }
+
+    unsigned numberOfActivePoints = 0;
+    unsigned iteration = 0;
+    while (true) {
+      // the last pass only checks the convergence
+      const bool update = iteration < settings.maxNumberSlipRateUpdatesAdaptive;
+      numberOfActivePoints = 0;
+#pragma omp simd reduction(+ : numberOfActivePoints)
+      for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints;
+           pointIndex++) {
+        if (!converged[pointIndex]) {
+          // Note that we need double precision here, since single precision led to NaNs.
+          const double g =
+              -this->impAndEta[ltsFace].invEtaS *
+                  (std::fabs(normalStress[pointIndex]) *
+                       static_cast<Derived*>(this)->updateMu(ltsFace,
+                                                             pointIndex,
+                                                             slipRateTest[pointIndex],
+                                                             localStateVariable[pointIndex]) -
+                   absoluteShearStress[pointIndex]) -
+              slipRateTest[pointIndex];
+          converged[pointIndex] = std::fabs(g) < settings.newtonTolerance;
+          if (!converged[pointIndex] && update) {
+            const double dG = -this->impAndEta[ltsFace].invEtaS *
+                                  (std::fabs(normalStress[pointIndex]) *
+                                   static_cast<Derived*>(this)->updateMuDerivative(
+                                       ltsFace,
+                                       pointIndex,
+                                       slipRateTest[pointIndex],
+                                       localStateVariable[pointIndex])) -
+                              1.0;
+            slipRateTest[pointIndex] =
+                std::max(rs::almostZero(), static_cast<real>(slipRateTest[pointIndex] - g / dG));
+          }
+          numberOfActivePoints += !converged[pointIndex];
+        }
+      }
+      if (numberOfActivePoints == 0 || !update) {
+        break;
+      }
+      iteration++;
+    }
+    recordSlipRateInversion(iteration);
+
+    bool hasConverged = true;
+    if (numberOfActivePoints > 0) {
+      this->threadIterationStatistics().numberOfFallbackPoints += numberOfActivePoints;
+      for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints;
+           pointIndex++) {
+        if (!converged[pointIndex]) {
+          hasConverged &= invertSlipRateBracketed(ltsFace,
+                                                  pointIndex,
+                                                  localStateVariable[pointIndex],
+                                                  normalStress[pointIndex],
+                                                  absoluteShearStress[pointIndex],
+                                                  slipRateTest[pointIndex]);
+        }
+      }
+    }
+    return hasConverged;
+  }
+
+  /**
+   * Safeguarded Newton-Raphson for a single point. As the friction coefficient increases with the
+   * slip rate, g is strictly decreasing and its root lies in
+   * \f$[0, \Theta / \eta_s]\f$. A Newton step which leaves the current bracket is replaced by
+   * bisection, hence the bracket shrinks in every iteration. slipRate holds the initial guess on
+   * entry and the root on exit. Returns false if neither the residual nor the bracket dropped
+   * below the tolerance within settings.maxNumberBracketedUpdates iterations.
+   */
+  bool invertSlipRateBracketed(unsigned int ltsFace,
+                               unsigned int pointIndex,
+                               real localStateVariable,
+                               real normalStress,
+                               real absoluteShearStress,
+                               real& slipRateTest) {
+    double lower = rs::almostZero();
+    double upper = std::max(
+        lower, static_cast<double>(absoluteShearStress * this->impAndEta[ltsFace].invEtaS));
+    double slipRate = std::clamp(static_cast<double>(slipRateTest), lower, upper);
+    bool hasConverged = false;
+    for (unsigned i = 0; i < settings.maxNumberBracketedUpdates; i++) {
+      const double g =
+          -this->impAndEta[ltsFace].invEtaS *
+              (std::fabs(normalStress) * static_cast<Derived*>(this)->updateMu(
+                                             ltsFace, pointIndex, slipRate, localStateVariable) -
+               absoluteShearStress) -
+          slipRate;
+      if (std::fabs(g) < settings.newtonTolerance ||
+          upper - lower <= std::numeric_limits<double>::epsilon() * upper) {
+        hasConverged = true;
+        break;
+      }
+      if (g > 0.0) {
+        lower = slipRate;
+      } else {
+        upper = slipRate;
+      }
+      const double dG = -this->impAndEta[ltsFace].invEtaS *
+                            (std::fabs(normalStress) *
+                             static_cast<Derived*>(this)->updateMuDerivative(
+                                 ltsFace, pointIndex, slipRate, localStateVariable)) -
+                        1.0;
+      const double newtonSlipRate = slipRate - g / dG;
+      slipRate = (newtonSlipRate > lower && newtonSlipRate < upper) ? newtonSlipRate
+                                                                     : 0.5 * (lower + upper);
+    }
+    slipRateTest = slipRate;
+    return hasConverged;
+  }
+
+  void recordSlipRateInversion(unsigned numberOfIterations) {
+    const unsigned bin = std::min(numberOfIterations, IterationStatistics::NumberOfBins - 1);
+    this->threadIterationStatistics().histogram[bin]++;
+  }
+
   void updateNormalStress(std::array<real, misc::numPaddedPoints>& normalStress,
                           FaultStresses const& faultStresses,
                           size_t timeIndex,
@@ -356,7 +520,7 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
   // Attributes
   real (*a)[misc::numPaddedPoints];
   real (*sl0)[misc::numPaddedPoints];
-  real (*stateVariable)[misc::numPaddedPoints];
+  realAcc (*stateVariable)[misc::numPaddedPoints];
 
   TPMethod tpMethod;
   rs::Settings settings{};
@@ -29,6 +29,13 @@ struct Settings {
   const unsigned int maxNumberSlipRateUpdates{60};
   const unsigned int numberStateVariableUpdates{2};
   const double newtonTolerance{1e-8};
+
+  /**
+   * Adaptive solver: Newton iterations before the remaining points switch to the bracketed
+   * solver, and maximal number of iterations of the bracketed solver
+   */
+  const unsigned int maxNumberSlipRateUpdatesAdaptive{10};
+  const unsigned int maxNumberBracketedUpdates{200};
 };
 } // namespace seissol::dr::friction_law::rs
 
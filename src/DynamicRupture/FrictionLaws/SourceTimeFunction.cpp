@@ -3,7 +3,7 @@
 namespace seissol::dr::friction_law {
 void YoffeSTF::copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                                   seissol::initializers::DynamicRupture const* const dynRup,
-                                  real fullUpdateTime) {
+                                  double fullUpdateTime) {
   auto* concreteLts =
       dynamic_cast<seissol::initializers::LTSImposedSlipRatesYoffe const* const>(dynRup);
   onsetTime = layerData.var(concreteLts->onsetTime);
@@ -22,7 +22,7 @@ real YoffeSTF::evaluate(real currentTime,
 
 void GaussianSTF::copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                                      seissol::initializers::DynamicRupture const* const dynRup,
-                                     real fullUpdateTime) {
+                                     double fullUpdateTime) {
   auto* concreteLts =
       dynamic_cast<seissol::initializers::LTSImposedSlipRatesGaussian const* const>(dynRup);
   onsetTime = layerData.var(concreteLts->onsetTime);
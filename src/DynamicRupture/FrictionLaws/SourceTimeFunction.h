@@ -16,7 +16,7 @@ class YoffeSTF {
   public:
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime);
+                          double fullUpdateTime);
 
   real evaluate(real currentTime,
                 [[maybe_unused]] real timeIncrement,
@@ -32,7 +32,7 @@ class GaussianSTF {
   public:
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime);
+                          double fullUpdateTime);
 
   real evaluate(real currentTime, real timeIncrement, size_t ltsFace, size_t pointIndex);
 };
@@ -8,10 +8,10 @@ class NoTP {
 
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime) {}
+                          double fullUpdateTime) {}
 
   void calcFluidPressure(std::array<real, misc::numPaddedPoints>& normalStress,
-                         real (*mu)[misc::numPaddedPoints],
+                         realAcc (*mu)[misc::numPaddedPoints],
                          std::array<real, misc::numPaddedPoints>& slipRateMagnitude,
                          real deltaT,
                          bool saveTmpInTP,
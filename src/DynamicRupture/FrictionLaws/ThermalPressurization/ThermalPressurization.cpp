@@ -2,14 +2,14 @@
 
 namespace seissol::dr::friction_law {
 
-static const GridPoints<misc::numberOfTPGridPoints> tpGridPoints;
+static const SquaredGridPoints<misc::numberOfTPGridPoints> tpSquaredGridPoints;
 static const InverseFourierCoefficients<misc::numberOfTPGridPoints> tpInverseFourierCoefficients;
-static const GaussianHeatSource<misc::numberOfTPGridPoints> heatSource;
+static const ScaledGaussianHeatSource<misc::numberOfTPGridPoints> scaledHeatSource;
 
 void ThermalPressurization::copyLtsTreeToLocal(
     seissol::initializers::Layer& layerData,
     seissol::initializers::DynamicRupture const* const dynRup,
-    real fullUpdateTime) {
+    double fullUpdateTime) {
   auto* concreteLts =
       dynamic_cast<seissol::initializers::LTSRateAndStateThermalPressurization const* const>(
           dynRup);
@@ -17,8 +17,9 @@ void ThermalPressurization::copyLtsTreeToLocal(
   pressure = layerData.var(concreteLts->pressure);
   theta = layerData.var(concreteLts->theta);
   sigma = layerData.var(concreteLts->sigma);
-  thetaTmpBuffer = layerData.var(concreteLts->thetaTmpBuffer);
-  sigmaTmpBuffer = layerData.var(concreteLts->sigmaTmpBuffer);
+  thetaDecay = layerData.var(concreteLts->thetaDecay);
+  sigmaDecay = layerData.var(concreteLts->sigmaDecay);
+  decayTimeStepWidth = layerData.var(concreteLts->decayTimeStepWidth);
   faultStrength = layerData.var(concreteLts->faultStrength);
   halfWidthShearZone = layerData.var(concreteLts->halfWidthShearZone);
   hydraulicDiffusivity = layerData.var(concreteLts->hydraulicDiffusivity);
@@ -26,43 +27,48 @@ void ThermalPressurization::copyLtsTreeToLocal(
 
 void ThermalPressurization::calcFluidPressure(
     std::array<real, misc::numPaddedPoints> const& normalStress,
-    real const (*mu)[misc::numPaddedPoints],
+    realAcc const (*mu)[misc::numPaddedPoints],
     std::array<real, misc::numPaddedPoints> const& slipRateMagnitude,
     real deltaT,
     bool saveTPinLTS,
     unsigned int timeIndex,
     unsigned int ltsFace) {
+  if (decayTimeStepWidth[ltsFace] != deltaT) {
+    updateDecayFactors(deltaT, ltsFace);
+  }
+
   for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
     // compute fault strength
     faultStrength[ltsFace][pointIndex] = -mu[ltsFace][pointIndex] * normalStress[pointIndex];
 
-    std::copy(&theta[ltsFace][pointIndex][0],
-              &theta[ltsFace][pointIndex][misc::numberOfTPGridPoints],
-              &thetaTmpBuffer[ltsFace][pointIndex][0]);
-    std::copy(&sigma[ltsFace][pointIndex][0],
-              &sigma[ltsFace][pointIndex][misc::numberOfTPGridPoints],
-              &sigmaTmpBuffer[ltsFace][pointIndex][0]);
-
-    // use Theta/Sigma from last timestep
-    updateTemperatureAndPressure(
-        slipRateMagnitude[pointIndex], deltaT, pointIndex, timeIndex, ltsFace);
-
-    // copy back to LTS tree, if necessary
-    if (saveTPinLTS) {
-      std::copy(&thetaTmpBuffer[ltsFace][pointIndex][0],
-                &thetaTmpBuffer[ltsFace][pointIndex][misc::numberOfTPGridPoints],
-                &theta[ltsFace][pointIndex][0]);
-      std::copy(&sigmaTmpBuffer[ltsFace][pointIndex][0],
-                &sigmaTmpBuffer[ltsFace][pointIndex][misc::numberOfTPGridPoints],
-                &sigma[ltsFace][pointIndex][0]);
+    // use Theta/Sigma from last timestep and only overwrite them with the final values
+    updateTemperatureAndPressure(slipRateMagnitude[pointIndex], saveTPinLTS, pointIndex, ltsFace);
+  }
+}
+
+void ThermalPressurization::updateDecayFactors(real deltaT, unsigned int ltsFace) {
+  for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+    const real invSquaredHalfWidth =
+        1.0 / misc::power<2>(halfWidthShearZone[ltsFace][pointIndex]);
+    // This is -A dt in Noda & Lapusta (2010) equation (10), without the squared grid point
+    const real thetaExponent = -drParameters->thermalDiffusivity * deltaT * invSquaredHalfWidth;
+    const real sigmaExponent =
+        -hydraulicDiffusivity[ltsFace][pointIndex] * deltaT * invSquaredHalfWidth;
+#pragma omp simd
+    for (unsigned int tpGridPointIndex = 0; tpGridPointIndex < misc::numberOfTPGridPoints;
+         tpGridPointIndex++) {
+      thetaDecay[ltsFace][pointIndex][tpGridPointIndex] =
+          std::exp(thetaExponent * tpSquaredGridPoints[tpGridPointIndex]);
+      sigmaDecay[ltsFace][pointIndex][tpGridPointIndex] =
+          std::exp(sigmaExponent * tpSquaredGridPoints[tpGridPointIndex]);
     }
   }
+  decayTimeStepWidth[ltsFace] = deltaT;
 }
 
 void ThermalPressurization::updateTemperatureAndPressure(real slipRateMagnitude,
-                                                         real deltaT,
+                                                         bool updateSpectralCoefficients,
                                                          unsigned int pointIndex,
-                                                         unsigned int timeIndex,
                                                          unsigned int ltsFace) {
   real temperatureUpdate = 0.0;
   real pressureUpdate = 0.0;
@@ -72,51 +78,56 @@ void ThermalPressurization::updateTemperatureAndPressure(real slipRateMagnitude,
       drParameters->undrainedTPResponse * drParameters->thermalDiffusivity /
       (hydraulicDiffusivity[ltsFace][pointIndex] - drParameters->thermalDiffusivity);
 
-#pragma omp simd
+  // B/A in Noda & Lapusta (2010) equation (10), without the grid point dependent factor
+  // \exp(-\hat{l}^2 / 2) / (\sqrt{2 \pi} \hat{l}^2) stored in scaledHeatSource
+  const real squaredHalfWidth = misc::power<2>(halfWidthShearZone[ltsFace][pointIndex]);
+  const real thetaGenerationFactor =
+      tauV * squaredHalfWidth / (drParameters->heatCapacity * drParameters->thermalDiffusivity);
+  const real sigmaGenerationFactor =
+      tauV * squaredHalfWidth * (drParameters->undrainedTPResponse + lambdaPrime) /
+      (drParameters->heatCapacity * hydraulicDiffusivity[ltsFace][pointIndex]);
+
+  real* localTheta = theta[ltsFace][pointIndex];
+  real* localSigma = sigma[ltsFace][pointIndex];
+  const real* localThetaDecay = thetaDecay[ltsFace][pointIndex];
+  const real* localSigmaDecay = sigmaDecay[ltsFace][pointIndex];
+
+#pragma omp simd reduction(+ : temperatureUpdate, pressureUpdate)
   for (unsigned int tpGridPointIndex = 0; tpGridPointIndex < misc::numberOfTPGridPoints;
        tpGridPointIndex++) {
-    // Gaussian shear zone in spectral domain, normalized by w
-    // \hat{l} / w
-    const real squaredNormalizedTPGrid =
-        misc::power<2>(tpGridPoints[tpGridPointIndex] / halfWidthShearZone[ltsFace][pointIndex]);
-
-    // This is exp(-A dt) in Noda & Lapusta (2010) equation (10)
-    const real expTheta =
-        std::exp(-drParameters->thermalDiffusivity * deltaT * squaredNormalizedTPGrid);
-    const real expSigma =
-        std::exp(-hydraulicDiffusivity[ltsFace][pointIndex] * deltaT * squaredNormalizedTPGrid);
+    const real expTheta = localThetaDecay[tpGridPointIndex];
+    const real expSigma = localSigmaDecay[tpGridPointIndex];
 
     // Temperature and pressure diffusion in spectral domain over timestep
     // This is + F(t) exp(-A dt) in equation (10)
-    const real thetaDiffusion = thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] * expTheta;
-    const real sigmaDiffusion = sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] * expSigma;
+    const real thetaDiffusion = localTheta[tpGridPointIndex] * expTheta;
+    const real sigmaDiffusion = localSigma[tpGridPointIndex] * expSigma;
 
     // Heat generation during timestep
     // This is B/A * (1 - exp(-A dt)) in Noda & Lapusta (2010) equation (10)
-    // heatSource stores \exp(-\hat{l}^2 / 2) / \sqrt{2 \pi}
-    const real omega = tauV * heatSource[tpGridPointIndex];
     const real thetaGeneration =
-        omega /
-        (drParameters->heatCapacity * squaredNormalizedTPGrid * drParameters->thermalDiffusivity) *
-        (1.0 - expTheta);
-    const real sigmaGeneration = omega * (drParameters->undrainedTPResponse + lambdaPrime) /
-                                 (drParameters->heatCapacity * squaredNormalizedTPGrid *
-                                  hydraulicDiffusivity[ltsFace][pointIndex]) *
-                                 (1.0 - expSigma);
+        thetaGenerationFactor * scaledHeatSource[tpGridPointIndex] * (1.0 - expTheta);
+    const real sigmaGeneration =
+        sigmaGenerationFactor * scaledHeatSource[tpGridPointIndex] * (1.0 - expSigma);
 
     // Sum both contributions up
-    thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] = thetaDiffusion + thetaGeneration;
-    sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] = sigmaDiffusion + sigmaGeneration;
+    const real updatedTheta = thetaDiffusion + thetaGeneration;
+    const real updatedSigma = sigmaDiffusion + sigmaGeneration;
+    if (updateSpectralCoefficients) {
+      localTheta[tpGridPointIndex] = updatedTheta;
+      localSigma[tpGridPointIndex] = updatedSigma;
+    }
 
     // Recover temperature and altered pressure using inverse Fourier transformation from the new
     // contribution
-    const real scaledInverseFourierCoefficient =
-        tpInverseFourierCoefficients[tpGridPointIndex] / halfWidthShearZone[ltsFace][pointIndex];
-    temperatureUpdate +=
-        scaledInverseFourierCoefficient * thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex];
-    pressureUpdate +=
-        scaledInverseFourierCoefficient * sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex];
+    temperatureUpdate += tpInverseFourierCoefficients[tpGridPointIndex] * updatedTheta;
+    pressureUpdate += tpInverseFourierCoefficients[tpGridPointIndex] * updatedSigma;
   }
+  // The inverse Fourier coefficients are scaled by 1 / w
+  const real invHalfWidth = 1.0 / halfWidthShearZone[ltsFace][pointIndex];
+  temperatureUpdate *= invHalfWidth;
+  pressureUpdate *= invHalfWidth;
+
   // Update pore pressure change: sigma = pore pressure + lambda' * temperature
   pressureUpdate -= lambdaPrime * temperatureUpdate;
 
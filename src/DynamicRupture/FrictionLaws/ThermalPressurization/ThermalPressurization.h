@@ -71,6 +71,44 @@ class GaussianHeatSource {
   std::array<real, N> values;
 };
 
+/**
+ * Stores the squared gridpoints \f$\hat{l}^2\f$.
+ */
+template <size_t N>
+class SquaredGridPoints {
+  public:
+  SquaredGridPoints() {
+    const GridPoints<N> localGridPoints;
+    for (size_t i = 0; i < N; ++i) {
+      values[i] = misc::power<2>(localGridPoints[i]);
+    }
+  }
+  real const& operator[](size_t i) const { return values[i]; };
+
+  private:
+  std::array<real, N> values;
+};
+
+/**
+ * Stores the heat generation divided by the squared gridpoints
+ * \f$\exp\left(-\hat{l}^2/2\right) / \left(\sqrt{2 \pi} \hat{l}^2\right)\f$.
+ */
+template <size_t N>
+class ScaledGaussianHeatSource {
+  public:
+  ScaledGaussianHeatSource() {
+    const GaussianHeatSource<N> localHeatSource;
+    const SquaredGridPoints<N> localSquaredGridPoints;
+    for (size_t i = 0; i < N; ++i) {
+      values[i] = localHeatSource[i] / localSquaredGridPoints[i];
+    }
+  }
+  real const& operator[](size_t i) const { return values[i]; };
+
+  private:
+  std::array<real, N> values;
+};
+
 /**
  * We follow Noda&Lapusta (2010) doi:10.1029/2010JB007780.
  * Define: \f$p, T\f$ pressure and temperature, \f$\Pi, \Theta\f$ fourier transform of pressure and
@@ -97,6 +135,11 @@ class GaussianHeatSource {
  * + \Sigma(t)\exp\left(-\left(\hat{l}/w\right)^2\alpha_{th} \Delta t\right)\\\end{aligned}\f]
  * We then compute the pressure and temperature update with an inverse Fourier transform from
  * \f$\Pi, \Theta\f$.
+ *
+ * The decay factors \f$\exp\left(-\left(\hat{l}/w\right)^2 \alpha \Delta t\right)\f$ only depend
+ * on the fault point and on \f$\Delta t\f$. They are stored per face and only recomputed if the
+ * time step width changes, i.e. once per sub time step instead of once per state variable
+ * iteration. All other factors are either constant over the fault or constant over one point.
  */
 class ThermalPressurization {
   public:
@@ -107,14 +150,14 @@ class ThermalPressurization {
    */
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
-                          real fullUpdateTime);
+                          double fullUpdateTime);
 
   /**
    * Compute thermal pressure according to Noda&Lapusta (2010) at all Gauss Points within one face
    * bool saveTmpInTP is used to save final values for Theta and Sigma in the LTS tree
    */
   void calcFluidPressure(std::array<real, misc::numPaddedPoints> const& normalStress,
-                         real const (*mu)[misc::numPaddedPoints],
+                         realAcc const (*mu)[misc::numPaddedPoints],
                          std::array<real, misc::numPaddedPoints> const& slipRateMagnitude,
                          real deltaT,
                          bool saveTPinLTS,
@@ -130,8 +173,9 @@ class ThermalPressurization {
   real (*pressure)[misc::numPaddedPoints];
   real (*theta)[misc::numPaddedPoints][misc::numberOfTPGridPoints];
   real (*sigma)[misc::numPaddedPoints][misc::numberOfTPGridPoints];
-  real (*thetaTmpBuffer)[misc::numPaddedPoints][misc::numberOfTPGridPoints];
-  real (*sigmaTmpBuffer)[misc::numPaddedPoints][misc::numberOfTPGridPoints];
+  real (*thetaDecay)[misc::numPaddedPoints][misc::numberOfTPGridPoints];
+  real (*sigmaDecay)[misc::numPaddedPoints][misc::numberOfTPGridPoints];
+  real* decayTimeStepWidth;
   real (*halfWidthShearZone)[misc::numPaddedPoints];
   real (*hydraulicDiffusivity)[misc::numPaddedPoints];
   real (*faultStrength)[misc::numPaddedPoints];
@@ -139,13 +183,18 @@ class ThermalPressurization {
   private:
   DRParameters* drParameters;
 
+  /**
+   * Recomputes the decay factors of one face for the time step width deltaT
+   */
+  void updateDecayFactors(real deltaT, unsigned int ltsFace);
+
   /**
    * Compute temperature and pressure update according to Noda&Lapusta (2010) on one Gaus point.
+   * Theta and Sigma are only overwritten if updateSpectralCoefficients is true.
    */
   void updateTemperatureAndPressure(real slipRateMagnitude,
-                                    real deltaT,
+                                    bool updateSpectralCoefficients,
                                     unsigned int pointIndex,
-                                    unsigned int timeIndex,
                                     unsigned int ltsFace);
 };
 } // namespace seissol::dr::friction_law
@@ -245,12 +245,12 @@ void BaseDRInitializer::initializeOtherVariables(
 
   // initialize all other variables to zero
   real(*peakSlipRate)[misc::numPaddedPoints] = it->var(dynRup->peakSlipRate);
-  real(*ruptureTime)[misc::numPaddedPoints] = it->var(dynRup->ruptureTime);
-  real(*dynStressTime)[misc::numPaddedPoints] = it->var(dynRup->dynStressTime);
-  real(*accumulatedSlipMagnitude)[misc::numPaddedPoints] =
+  realAcc(*ruptureTime)[misc::numPaddedPoints] = it->var(dynRup->ruptureTime);
+  realAcc(*dynStressTime)[misc::numPaddedPoints] = it->var(dynRup->dynStressTime);
+  realAcc(*accumulatedSlipMagnitude)[misc::numPaddedPoints] =
       it->var(dynRup->accumulatedSlipMagnitude);
-  real(*slip1)[misc::numPaddedPoints] = it->var(dynRup->slip1);
-  real(*slip2)[misc::numPaddedPoints] = it->var(dynRup->slip2);
+  realAcc(*slip1)[misc::numPaddedPoints] = it->var(dynRup->slip1);
+  realAcc(*slip2)[misc::numPaddedPoints] = it->var(dynRup->slip2);
   real(*slipRateMagnitude)[misc::numPaddedPoints] = it->var(dynRup->slipRateMagnitude);
   real(*traction1)[misc::numPaddedPoints] = it->var(dynRup->traction1);
   real(*traction2)[misc::numPaddedPoints] = it->var(dynRup->traction2);
@@ -16,9 +16,9 @@ void LinearSlipWeakeningInitializer::initializeFault(
        it != dynRupTree->endLeaf();
        ++it) {
     bool(*dynStressTimePending)[misc::numPaddedPoints] = it->var(concreteLts->dynStressTimePending);
-    real(*slipRate1)[misc::numPaddedPoints] = it->var(concreteLts->slipRate1);
-    real(*slipRate2)[misc::numPaddedPoints] = it->var(concreteLts->slipRate2);
-    real(*mu)[misc::numPaddedPoints] = it->var(concreteLts->mu);
+    realAcc(*slipRate1)[misc::numPaddedPoints] = it->var(concreteLts->slipRate1);
+    realAcc(*slipRate2)[misc::numPaddedPoints] = it->var(concreteLts->slipRate2);
+    realAcc(*mu)[misc::numPaddedPoints] = it->var(concreteLts->mu);
     real(*muS)[misc::numPaddedPoints] = it->var(concreteLts->muS);
     real(*forcedRuptureTime)[misc::numPaddedPoints] = it->var(concreteLts->forcedRuptureTime);
     const bool providesForcedRuptureTime = this->faultProvides("forced_rupture_time");
@@ -69,8 +69,8 @@ void LinearSlipWeakeningBimaterialInitializer::initializeFault(
            dynRupTree->beginLeaf(seissol::initializers::LayerMask(Ghost));
        it != dynRupTree->endLeaf();
        ++it) {
-    real(*regularisedStrength)[misc::numPaddedPoints] = it->var(concreteLts->regularisedStrength);
-    real(*mu)[misc::numPaddedPoints] = it->var(concreteLts->mu);
+    realAcc(*regularisedStrength)[misc::numPaddedPoints] = it->var(concreteLts->regularisedStrength);
+    realAcc(*mu)[misc::numPaddedPoints] = it->var(concreteLts->mu);
     real(*cohesion)[misc::numPaddedPoints] = it->var(concreteLts->cohesion);
     real(*initialStressInFaultCS)[misc::numPaddedPoints][6] =
         it->var(concreteLts->initialStressInFaultCS);
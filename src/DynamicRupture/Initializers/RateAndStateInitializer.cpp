@@ -15,11 +15,11 @@ void RateAndStateInitializer::initializeFault(
        ++it) {
 
     bool(*dynStressTimePending)[misc::numPaddedPoints] = it->var(concreteLts->dynStressTimePending);
-    real(*slipRate1)[misc::numPaddedPoints] = it->var(concreteLts->slipRate1);
-    real(*slipRate2)[misc::numPaddedPoints] = it->var(concreteLts->slipRate2);
-    real(*mu)[misc::numPaddedPoints] = it->var(concreteLts->mu);
+    realAcc(*slipRate1)[misc::numPaddedPoints] = it->var(concreteLts->slipRate1);
+    realAcc(*slipRate2)[misc::numPaddedPoints] = it->var(concreteLts->slipRate2);
+    realAcc(*mu)[misc::numPaddedPoints] = it->var(concreteLts->mu);
 
-    real(*stateVariable)[misc::numPaddedPoints] = it->var(concreteLts->stateVariable);
+    realAcc(*stateVariable)[misc::numPaddedPoints] = it->var(concreteLts->stateVariable);
     real(*rsSl0)[misc::numPaddedPoints] = it->var(concreteLts->rsSl0);
     real(*rsA)[misc::numPaddedPoints] = it->var(concreteLts->rsA);
     real(*initialStressInFaultCS)[misc::numPaddedPoints][6] =
@@ -145,12 +145,15 @@ void RateAndStateThermalPressurizationInitializer::initializeFault(
     real(*pressure)[misc::numPaddedPoints] = it->var(concreteLts->pressure);
     real(*theta)[misc::numPaddedPoints][misc::numberOfTPGridPoints] = it->var(concreteLts->theta);
     real(*sigma)[misc::numPaddedPoints][misc::numberOfTPGridPoints] = it->var(concreteLts->sigma);
-    real(*thetaTmpBuffer)[misc::numPaddedPoints][misc::numberOfTPGridPoints] =
-        it->var(concreteLts->thetaTmpBuffer);
-    real(*sigmaTmpBuffer)[misc::numPaddedPoints][misc::numberOfTPGridPoints] =
-        it->var(concreteLts->sigmaTmpBuffer);
+    real(*thetaDecay)[misc::numPaddedPoints][misc::numberOfTPGridPoints] =
+        it->var(concreteLts->thetaDecay);
+    real(*sigmaDecay)[misc::numPaddedPoints][misc::numberOfTPGridPoints] =
+        it->var(concreteLts->sigmaDecay);
+    real* decayTimeStepWidth = it->var(concreteLts->decayTimeStepWidth);
 
     for (unsigned ltsFace = 0; ltsFace < it->getNumberOfCells(); ++ltsFace) {
+      // the decay factors are computed in the first time step
+      decayTimeStepWidth[ltsFace] = -1.0;
       for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; ++pointIndex) {
         temperature[ltsFace][pointIndex] = drParameters->initialTemperature;
         pressure[ltsFace][pointIndex] = drParameters->initialPressure;
@@ -158,8 +161,8 @@ void RateAndStateThermalPressurizationInitializer::initializeFault(
              ++tpGridPointIndex) {
           theta[ltsFace][pointIndex][tpGridPointIndex] = 0.0;
           sigma[ltsFace][pointIndex][tpGridPointIndex] = 0.0;
-          thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] = 0.0;
-          sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] = 0.0;
+          thetaDecay[ltsFace][pointIndex][tpGridPointIndex] = 0.0;
+          sigmaDecay[ltsFace][pointIndex][tpGridPointIndex] = 0.0;
         }
       }
     }
@@ -40,6 +40,13 @@ static constexpr real tpMaxWaveNumber = 10.0;
  */
 static constexpr unsigned int numberOfBoundaryGaussPoints = init::QInterpolated::Shape[0];
 
+/**
+ * Number of faces which the CPU friction solvers process together if the friction law supports
+ * it, such that the vectorised loops run over at least 64 points (one face at high orders).
+ */
+static constexpr unsigned int numFacesPerBatch =
+    numPaddedPoints >= 64 ? 1 : (64 + numPaddedPoints - 1) / numPaddedPoints;
+
 template <class TupleT, class F, std::size_t... I>
 constexpr F forEachImpl(TupleT&& tuple, F&& functor, std::index_sequence<I...>) {
   return (void)std::initializer_list<int>{
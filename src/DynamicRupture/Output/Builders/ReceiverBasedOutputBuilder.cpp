@@ -1,4 +1,6 @@
 #include "DynamicRupture/Output/Builders/ReceiverBasedOutputBuilder.hpp"
+#include "Numerical_aux/BasisFunction.h"
+#include <algorithm>
 #include <map>
 #include <set>
 
@@ -25,9 +27,11 @@ void ReceiverBasedOutputBuilder::initBasisFunctions() {
   std::set<std::size_t> elementIndices;
   std::map<std::pair<int, std::size_t>, std::pair<std::size_t, int>> elementIndicesGhost;
   std::size_t foundPoints = 0;
+  std::vector<PlusMinusBasisFunctions> basisFunctions(outputData->receiverPoints.size());
 
   constexpr size_t numVertices{4};
-  for (const auto& point : outputData->receiverPoints) {
+  for (std::size_t i = 0; i < outputData->receiverPoints.size(); ++i) {
+    const auto& point = outputData->receiverPoints[i];
     if (point.isInside) {
       ++foundPoints;
       const auto elementIndex = faultInfo[point.faultFaceIndex].element;
@@ -68,8 +72,66 @@ void ReceiverBasedOutputBuilder::initBasisFunctions() {
         }
       }
 
-      outputData->basisFunctions.emplace_back(
-          getPlusMinusBasisFunctions(point.global.coords, elemCoords, neighborElemCoords));
+      basisFunctions[i] =
+          getPlusMinusBasisFunctions(point.global.coords, elemCoords, neighborElemCoords);
+    }
+  }
+
+  // Group the receivers by fault face, such that the DOFs of a face are only fetched once
+  // and all receivers of the face are evaluated together
+  auto& faceReceivers = outputData->faceReceivers;
+  faceReceivers.clear();
+  for (std::size_t i = 0; i < outputData->receiverPoints.size(); ++i) {
+    if (outputData->receiverPoints[i].isInside) {
+      faceReceivers.push_back(i);
+    }
+  }
+  std::stable_sort(faceReceivers.begin(), faceReceivers.end(), [&](std::size_t a, std::size_t b) {
+    return outputData->receiverPoints[a].faultFaceIndex <
+           outputData->receiverPoints[b].faultFaceIndex;
+  });
+
+  auto& faceReceiverOffsets = outputData->faceReceiverOffsets;
+  faceReceiverOffsets.clear();
+  for (std::size_t k = 0; k < faceReceivers.size(); ++k) {
+    if (k == 0 || outputData->receiverPoints[faceReceivers[k]].faultFaceIndex !=
+                      outputData->receiverPoints[faceReceivers[k - 1]].faultFaceIndex) {
+      faceReceiverOffsets.push_back(k);
+    }
+  }
+  faceReceiverOffsets.push_back(faceReceivers.size());
+
+  constexpr auto numberOfBasisFunctions = tensor::basisFunctionsAtFaceReceivers::Shape[0];
+  constexpr auto receiversPerBlock = tensor::basisFunctionsAtFaceReceivers::Shape[1];
+  const auto numberOfFaces = faceReceiverOffsets.size() - 1;
+  auto& faceReceiverBlockOffsets = outputData->faceReceiverBlockOffsets;
+  faceReceiverBlockOffsets.resize(numberOfFaces + 1);
+  faceReceiverBlockOffsets[0] = 0;
+  for (std::size_t face = 0; face < numberOfFaces; ++face) {
+    const auto numberOfReceivers = faceReceiverOffsets[face + 1] - faceReceiverOffsets[face];
+    faceReceiverBlockOffsets[face + 1] = faceReceiverBlockOffsets[face] +
+                                         (numberOfReceivers + receiversPerBlock - 1) / receiversPerBlock;
+  }
+
+  auto& faceBasisFunctions = outputData->faceBasisFunctions;
+  const auto numberOfBlocks = faceReceiverBlockOffsets[numberOfFaces];
+  faceBasisFunctions.plusSide.assign(numberOfBlocks * tensor::basisFunctionsAtFaceReceivers::size(), 0.0);
+  faceBasisFunctions.minusSide.assign(numberOfBlocks * tensor::basisFunctionsAtFaceReceivers::size(), 0.0);
+  for (std::size_t face = 0; face < numberOfFaces; ++face) {
+    const auto begin = faceReceiverOffsets[face];
+    const auto numberOfReceivers = faceReceiverOffsets[face + 1] - begin;
+    for (std::size_t k = 0; k < numberOfReceivers; ++k) {
+      const auto blockOffset = (faceReceiverBlockOffsets[face] + k / receiversPerBlock) *
+                               tensor::basisFunctionsAtFaceReceivers::size();
+      auto plusSide = init::basisFunctionsAtFaceReceivers::view::create(
+          &faceBasisFunctions.plusSide[blockOffset]);
+      auto minusSide = init::basisFunctionsAtFaceReceivers::view::create(
+          &faceBasisFunctions.minusSide[blockOffset]);
+      const auto& receiverBasisFunctions = basisFunctions[faceReceivers[begin + k]];
+      for (std::size_t l = 0; l < numberOfBasisFunctions; ++l) {
+        plusSide(l, k % receiversPerBlock) = receiverBasisFunctions.plusSide[l];
+        minusSide(l, k % receiversPerBlock) = receiverBasisFunctions.minusSide[l];
+      }
     }
   }
 
@@ -217,7 +279,28 @@ void ReceiverBasedOutputBuilder::initJacobian2dMatrices() {
   const auto& elementsInfo = meshReader->getElements();
 
   const size_t nReceiverPoints = outputData->receiverPoints.size();
-  outputData->jacobianT2d.resize(nReceiverPoints);
+  outputData->ruptureTimeGradient.resize(nReceiverPoints);
+
+  // The rupture time gradient at a receiver is computed from the projection of the rupture times
+  // at the Gauss points onto the 2D basis. Both steps are linear, hence they are combined into
+  // one matrix per receiver.
+  constexpr int numPoly = CONVERGENCE_ORDER - 1;
+  constexpr int numDegFr2d = (numPoly + 1) * (numPoly + 2) / 2;
+  constexpr auto numGaussPoints = misc::numberOfBoundaryGaussPoints;
+  auto chiTau2dPoints = init::quadpoints::view::create(const_cast<real*>(init::quadpoints::Values));
+  auto weights = init::quadweights::view::create(const_cast<real*>(init::quadweights::Values));
+  auto m2inv = init::M2inv::view::create(const_cast<real*>(init::M2inv::Values));
+
+  // projection[d][j]: contribution of the rupture time at Gauss point j to the d-th coefficient
+  std::vector<std::array<double, numGaussPoints>> projection(numDegFr2d);
+  for (size_t jBndGP = 0; jBndGP < numGaussPoints; ++jBndGP) {
+    std::array<double, numDegFr2d> phiAtPoint{};
+    basisFunction::tri_dubiner::evaluatePolynomials(
+        phiAtPoint.data(), chiTau2dPoints(jBndGP, 0), chiTau2dPoints(jBndGP, 1), numPoly);
+    for (int d = 0; d < numDegFr2d; ++d) {
+      projection[d][jBndGP] = weights(jBndGP) * phiAtPoint[d] * m2inv(d, d);
+    }
+  }
 
   for (size_t receiverId = 0; receiverId < nReceiverPoints; ++receiverId) {
     const auto side = outputData->receiverPoints[receiverId].localFaceSideId;
@@ -249,7 +332,27 @@ void ReceiverBasedOutputBuilder::initJacobian2dMatrices() {
     matrix(0, 1) = MeshTools::dot(tangent2, xab);
     matrix(1, 0) = MeshTools::dot(tangent1, xac);
     matrix(1, 1) = MeshTools::dot(tangent2, xac);
-    outputData->jacobianT2d[receiverId] = matrix.inverse();
+    const Eigen::Matrix<real, 2, 2> jacobiT2d = matrix.inverse();
+
+    const auto nearestInternalGpIndex =
+        outputData->receiverPoints[receiverId].nearestInternalGpIndex;
+    std::array<double, 2 * numDegFr2d> gradPhiAtPoint{};
+    basisFunction::tri_dubiner::evaluateGradPolynomials(gradPhiAtPoint.data(),
+                                                        chiTau2dPoints(nearestInternalGpIndex, 0),
+                                                        chiTau2dPoints(nearestInternalGpIndex, 1),
+                                                        numPoly);
+
+    auto& gradient = outputData->ruptureTimeGradient[receiverId];
+    for (size_t jBndGP = 0; jBndGP < numGaussPoints; ++jBndGP) {
+      double dChi = 0.0;
+      double dTau = 0.0;
+      for (int d = 0; d < numDegFr2d; ++d) {
+        dChi += projection[d][jBndGP] * gradPhiAtPoint[2 * d];
+        dTau += projection[d][jBndGP] * gradPhiAtPoint[2 * d + 1];
+      }
+      gradient[jBndGP] = jacobiT2d(0, 0) * dChi + jacobiT2d(0, 1) * dTau;
+      gradient[numGaussPoints + jBndGP] = jacobiT2d(1, 0) * dChi + jacobiT2d(1, 1) * dTau;
+    }
   }
 }
 
@@ -1,6 +1,7 @@
 #ifndef SEISSOL_DR_OUTPUT_DATA_TYPES_HPP
 #define SEISSOL_DR_OUTPUT_DATA_TYPES_HPP
 
+#include "DynamicRupture/Misc.h"
 #include "Geometry.hpp"
 #include "Initializer/tree/Layer.hpp"
 #include "Kernels/precision.hpp"
@@ -150,16 +151,27 @@ struct PlusMinusBasisFunctions {
 
 struct ReceiverOutputData {
   output::DrVarsT vars;
-  std::vector<PlusMinusBasisFunctions> basisFunctions;
   std::vector<ReceiverPoint> receiverPoints;
+
+  // The receivers are processed face by face: the receivers of the k-th fault face are
+  // faceReceivers[faceReceiverOffsets[k]], ..., faceReceivers[faceReceiverOffsets[k + 1] - 1]
+  std::vector<std::size_t> faceReceiverOffsets;
+  std::vector<std::size_t> faceReceivers;
+  // Basis functions at the receivers of each face, in blocks of
+  // tensor::basisFunctionsAtFaceReceivers::Shape[1] receivers padded with zeros. The blocks of
+  // the k-th face start at faceReceiverBlockOffsets[k] * tensor::basisFunctionsAtFaceReceivers::size().
+  std::vector<std::size_t> faceReceiverBlockOffsets;
+  PlusMinusBasisFunctions faceBasisFunctions;
+
   std::vector<std::array<real, seissol::tensor::stressRotationMatrix::size()>>
       stressGlbToDipStrikeAligned;
   std::vector<std::array<real, seissol::tensor::stressRotationMatrix::size()>>
       stressFaceAlignedToGlb;
   std::vector<std::array<real, seissol::tensor::T::size()>> faceAlignedToGlbData;
   std::vector<std::array<real, seissol::tensor::Tinv::size()>> glbToFaceAlignedData;
-  std::vector<Eigen::Matrix<real, 2, 2>, Eigen::aligned_allocator<Eigen::Matrix<real, 2, 2>>>
-      jacobianT2d;
+  // Maps the rupture times at the Gauss points of the fault face to the gradient (along the
+  // tangents) of the rupture time at the receiver, stored as (tangent, Gauss point) matrix
+  std::vector<std::array<real, 2 * misc::numberOfBoundaryGaussPoints>> ruptureTimeGradient;
 
   std::vector<FaultDirections> faultDirections{};
   std::vector<double> cachedTime{};
@@ -4,6 +4,7 @@
 #include "ReceiverBasedOutput.hpp"
 #include "generated_code/kernel.h"
 #include "generated_code/tensor.h"
+#include <algorithm>
 #include <cstring>
 
 using namespace seissol::dr::misc::quantity_indices;
@@ -21,29 +22,41 @@ void ReceiverOutput::setLtsData(seissol::initializers::LTSTree* userWpTree,
   drDescr = userDrDescr;
 }
 
-void ReceiverOutput::getDofs(real dofs[tensor::Q::size()], int meshId) {
+#ifndef ACL_DEVICE
+const real* ReceiverOutput::getDofs(int meshId) {
   // get DOFs from 0th derivatives
   assert((wpLut->lookup(wpDescr->cellInformation, meshId).ltsSetup >> 9) % 2 == 1);
 
-  real* derivatives = wpLut->lookup(wpDescr->derivatives, meshId);
-#ifdef ACL_DEVICE
-  device::DeviceInstance::getInstance().api->copyFrom(
-      &dofs[0], &derivatives[0], sizeof(real) * tensor::dQ::Size[0]);
-#else
-  std::copy(&derivatives[0], &derivatives[tensor::dQ::Size[0]], &dofs[0]);
-#endif
+  return wpLut->lookup(wpDescr->derivatives, meshId);
 }
 
-void ReceiverOutput::getNeighbourDofs(real dofs[tensor::Q::size()], int meshId, int side) {
-  real* derivatives = wpLut->lookup(wpDescr->faceNeighbors, meshId)[side];
+const real* ReceiverOutput::getNeighbourDofs(int meshId, int side) {
+  const real* derivatives = wpLut->lookup(wpDescr->faceNeighbors, meshId)[side];
   assert(derivatives != nullptr);
 
-#ifdef ACL_DEVICE
-  device::DeviceInstance::getInstance().api->copyFrom(
-      &dofs[0], &derivatives[0], sizeof(real) * tensor::dQ::Size[0]);
-#else
-  std::copy(&derivatives[0], &derivatives[tensor::dQ::Size[0]], &dofs[0]);
+  return derivatives;
+}
 #endif
+
+void ReceiverOutput::evaluateFaceAlignedDofs(const real* dofs,
+                                             const real* glbToFaceAligned,
+                                             const real* basisFunctions,
+                                             std::size_t numberOfReceivers,
+                                             real* faceAlignedValues) {
+  constexpr auto receiversPerBlock = tensor::basisFunctionsAtFaceReceivers::Shape[1];
+  static_assert(tensor::QAtFaceReceivers::size() == receiversPerBlock * tensor::QAtPoint::size(),
+                "the receivers of a block have to be stored contiguously");
+  const auto numberOfBlocks = (numberOfReceivers + receiversPerBlock - 1) / receiversPerBlock;
+
+  seissol::dynamicRupture::kernel::evaluateFaceAlignedDOFSAtFaceReceivers krnl;
+  krnl.Q = dofs;
+  krnl.Tinv = glbToFaceAligned;
+  for (std::size_t block = 0; block < numberOfBlocks; ++block) {
+    krnl.basisFunctionsAtFaceReceivers =
+        basisFunctions + block * tensor::basisFunctionsAtFaceReceivers::size();
+    krnl.QAtFaceReceivers = faceAlignedValues + block * tensor::QAtFaceReceivers::size();
+    krnl.execute();
+  }
 }
 
 void ReceiverOutput::allocateMemory(
@@ -91,224 +104,253 @@ void ReceiverOutput::calcFaultOutput(const OutputType type,
   }
 #endif
 
+  const auto& faceReceiverOffsets = outputData->faceReceiverOffsets;
+  const auto& faceReceivers = outputData->faceReceivers;
+  const size_t numberOfFaces = faceReceiverOffsets.empty() ? 0 : faceReceiverOffsets.size() - 1;
+
 #if defined(_OPENMP) && !NVHPC_AVOID_OMP
-#pragma omp parallel for
+#pragma omp parallel
 #endif
-  for (size_t i = 0; i < outputData->receiverPoints.size(); ++i) {
-    alignas(ALIGNMENT) real dofsPlus[tensor::Q::size()]{};
-    alignas(ALIGNMENT) real dofsMinus[tensor::Q::size()]{};
-
-    assert(outputData->receiverPoints[i].isInside == true &&
-           "a receiver is not within any tetrahedron adjacent to a fault");
-
-    const auto faceIndex = outputData->receiverPoints[i].faultFaceIndex;
-    assert(faceIndex != -1 && "receiver is not initialized");
-    LocalInfo local{};
-
-    auto [layer, ltsId] = (*faceToLtsMap)[faceIndex];
-    local.layer = layer;
-    local.ltsId = ltsId;
+  {
+    std::vector<real> faceAlignedValuesPlus;
+    std::vector<real> faceAlignedValuesMinus;
 
-    local.nearestGpIndex = outputData->receiverPoints[i].nearestGpIndex;
-    local.nearestInternalGpIndex = outputData->receiverPoints[i].nearestInternalGpIndex;
-
-    local.waveSpeedsPlus = &((local.layer->var(drDescr->waveSpeedsPlus))[local.ltsId]);
-    local.waveSpeedsMinus = &((local.layer->var(drDescr->waveSpeedsMinus))[local.ltsId]);
+#if defined(_OPENMP) && !NVHPC_AVOID_OMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+    for (size_t face = 0; face < numberOfFaces; ++face) {
+      const auto firstReceiver = faceReceiverOffsets[face];
+      const auto numberOfReceivers = faceReceiverOffsets[face + 1] - firstReceiver;
 
-    const auto faultInfo = faultInfos[faceIndex];
+      // All receivers of a face share the DOFs, the face index and the rotation matrices
+      const auto firstReceiverId = faceReceivers[firstReceiver];
+      const auto faceIndex = outputData->receiverPoints[firstReceiverId].faultFaceIndex;
+      assert(faceIndex != -1 && "receiver is not initialized");
+      const auto faultInfo = faultInfos[faceIndex];
 
 #ifdef ACL_DEVICE
-    {
-      real* dofsPlusData = deviceCopyMemory + tensor::Q::size() * outputData->deviceDataPlus[i];
-      real* dofsMinusData = deviceCopyMemory + tensor::Q::size() * outputData->deviceDataMinus[i];
-
-      std::memcpy(dofsPlus, dofsPlusData, sizeof(dofsPlus));
-      std::memcpy(dofsMinus, dofsMinusData, sizeof(dofsMinus));
-    }
+      const real* dofsPlus =
+          deviceCopyMemory + tensor::Q::size() * outputData->deviceDataPlus[firstReceiverId];
+      const real* dofsMinus =
+          deviceCopyMemory + tensor::Q::size() * outputData->deviceDataMinus[firstReceiverId];
 #else
-    getDofs(dofsPlus, faultInfo.element);
-    if (faultInfo.neighborElement >= 0) {
-      getDofs(dofsMinus, faultInfo.neighborElement);
-    } else {
-      getNeighbourDofs(dofsMinus, faultInfo.element, faultInfo.side);
-    }
+      const real* dofsPlus = getDofs(faultInfo.element);
+      const real* dofsMinus = (faultInfo.neighborElement >= 0)
+                                  ? getDofs(faultInfo.neighborElement)
+                                  : getNeighbourDofs(faultInfo.element, faultInfo.side);
 #endif
 
-    const auto* initStresses = local.layer->var(drDescr->initialStressInFaultCS);
-    const auto* initStress = initStresses[local.ltsId][local.nearestGpIndex];
-
-    local.frictionCoefficient = (local.layer->var(drDescr->mu))[local.ltsId][local.nearestGpIndex];
-    local.stateVariable = this->computeStateVariable(local);
-
-    local.iniTraction1 = initStress[QuantityIndices::XY];
-    local.iniTraction2 = initStress[QuantityIndices::XZ];
-    local.iniNormalTraction = initStress[QuantityIndices::XX];
-    local.fluidPressure = this->computeFluidPressure(local);
-
-    const auto& normal = outputData->faultDirections[i].faceNormal;
-    const auto& tangent1 = outputData->faultDirections[i].tangent1;
-    const auto& tangent2 = outputData->faultDirections[i].tangent2;
-    const auto& strike = outputData->faultDirections[i].strike;
-    const auto& dip = outputData->faultDirections[i].dip;
-
-    auto* phiPlusSide = outputData->basisFunctions[i].plusSide.data();
-    auto* phiMinusSide = outputData->basisFunctions[i].minusSide.data();
-
-    seissol::dynamicRupture::kernel::evaluateFaceAlignedDOFSAtPoint kernel;
-    kernel.Tinv = outputData->glbToFaceAlignedData[i].data();
-
-    kernel.Q = dofsPlus;
-    kernel.basisFunctionsAtPoint = phiPlusSide;
-    kernel.QAtPoint = local.faceAlignedValuesPlus;
-    kernel.execute();
-
-    kernel.Q = dofsMinus;
-    kernel.basisFunctionsAtPoint = phiMinusSide;
-    kernel.QAtPoint = local.faceAlignedValuesMinus;
-    kernel.execute();
-
-    this->computeLocalStresses(local);
-    const real strength = this->computeLocalStrength(local);
-    this->updateLocalTractions(local, strength);
-
-    seissol::dynamicRupture::kernel::rotateInitStress alignAlongDipAndStrikeKernel;
-    alignAlongDipAndStrikeKernel.stressRotationMatrix =
-        outputData->stressGlbToDipStrikeAligned[i].data();
-    alignAlongDipAndStrikeKernel.reducedFaceAlignedMatrix =
-        outputData->stressFaceAlignedToGlb[i].data();
-
-    std::array<real, 6> updatedStress{};
-    updatedStress[QuantityIndices::XX] = local.transientNormalTraction;
-    updatedStress[QuantityIndices::YY] = local.faceAlignedStress22;
-    updatedStress[QuantityIndices::ZZ] = local.faceAlignedStress33;
-    updatedStress[QuantityIndices::XY] = local.updatedTraction1;
-    updatedStress[QuantityIndices::YZ] = local.faceAlignedStress23;
-    updatedStress[QuantityIndices::XZ] = local.updatedTraction2;
-
-    alignAlongDipAndStrikeKernel.initialStress = updatedStress.data();
-    std::array<real, 6> rotatedUpdatedStress{};
-    alignAlongDipAndStrikeKernel.rotatedStress = rotatedUpdatedStress.data();
-    alignAlongDipAndStrikeKernel.execute();
-
-    std::array<real, 6> stress{};
-    stress[QuantityIndices::XX] = local.transientNormalTraction;
-    stress[QuantityIndices::YY] = local.faceAlignedStress22;
-    stress[QuantityIndices::ZZ] = local.faceAlignedStress33;
-    stress[QuantityIndices::XY] = local.faceAlignedStress12;
-    stress[QuantityIndices::YZ] = local.faceAlignedStress23;
-    stress[QuantityIndices::XZ] = local.faceAlignedStress13;
-
-    alignAlongDipAndStrikeKernel.initialStress = stress.data();
-    std::array<real, 6> rotatedStress{};
-    alignAlongDipAndStrikeKernel.rotatedStress = rotatedStress.data();
-    alignAlongDipAndStrikeKernel.execute();
-
-    switch (generalParams.slipRateOutputType) {
-    case SlipRateOutputType::TractionsAndFailure: {
-      this->computeSlipRate(local, rotatedUpdatedStress, rotatedStress);
-      break;
-    }
-    case SlipRateOutputType::VelocityDifference: {
-      this->computeSlipRate(local, tangent1, tangent2, strike, dip);
-      break;
-    }
-    }
-
-    adjustRotatedUpdatedStress(rotatedUpdatedStress, rotatedStress);
-
-    auto& slipRate = std::get<VariableID::SlipRate>(outputData->vars);
-    if (slipRate.isActive) {
-      slipRate(DirectionID::Strike, level, i) = local.slipRateStrike;
-      slipRate(DirectionID::Dip, level, i) = local.slipRateDip;
-    }
-
-    auto& transientTractions = std::get<VariableID::TransientTractions>(outputData->vars);
-    if (transientTractions.isActive) {
-      transientTractions(DirectionID::Strike, level, i) = rotatedUpdatedStress[QuantityIndices::XY];
-      transientTractions(DirectionID::Dip, level, i) = rotatedUpdatedStress[QuantityIndices::XZ];
-      transientTractions(DirectionID::Normal, level, i) =
-          local.transientNormalTraction - local.fluidPressure;
-    }
-
-    auto& frictionAndState = std::get<VariableID::FrictionAndState>(outputData->vars);
-    if (frictionAndState.isActive) {
-      frictionAndState(ParamID::FrictionCoefficient, level, i) = local.frictionCoefficient;
-      frictionAndState(ParamID::State, level, i) = local.stateVariable;
-    }
-
-    auto& ruptureTime = std::get<VariableID::RuptureTime>(outputData->vars);
-    if (ruptureTime.isActive) {
-      auto* rt = local.layer->var(drDescr->ruptureTime);
-      ruptureTime(level, i) = rt[local.ltsId][local.nearestGpIndex];
-    }
-
-    auto& normalVelocity = std::get<VariableID::NormalVelocity>(outputData->vars);
-    if (normalVelocity.isActive) {
-      normalVelocity(level, i) = local.faultNormalVelocity;
-    }
-
-    auto& accumulatedSlip = std::get<VariableID::AccumulatedSlip>(outputData->vars);
-    if (accumulatedSlip.isActive) {
-      auto* slip = local.layer->var(drDescr->accumulatedSlipMagnitude);
-      accumulatedSlip(level, i) = slip[local.ltsId][local.nearestGpIndex];
-    }
-
-    auto& totalTractions = std::get<VariableID::TotalTractions>(outputData->vars);
-    if (totalTractions.isActive) {
-      std::array<real, tensor::rotatedStress::size()> rotatedInitStress{};
-      alignAlongDipAndStrikeKernel.initialStress = initStress;
-      alignAlongDipAndStrikeKernel.rotatedStress = rotatedInitStress.data();
-      alignAlongDipAndStrikeKernel.execute();
-
-      totalTractions(DirectionID::Strike, level, i) =
-          rotatedUpdatedStress[QuantityIndices::XY] + rotatedInitStress[QuantityIndices::XY];
-      totalTractions(DirectionID::Dip, level, i) =
-          rotatedUpdatedStress[QuantityIndices::XZ] + rotatedInitStress[QuantityIndices::XZ];
-      totalTractions(DirectionID::Normal, level, i) = local.transientNormalTraction -
-                                                      local.fluidPressure +
-                                                      rotatedInitStress[QuantityIndices::XX];
-    }
-
-    auto& ruptureVelocity = std::get<VariableID::RuptureVelocity>(outputData->vars);
-    if (ruptureVelocity.isActive) {
-      auto& jacobiT2d = outputData->jacobianT2d[i];
-      ruptureVelocity(level, i) = this->computeRuptureVelocity(jacobiT2d, local);
-    }
-
-    auto& peakSlipsRate = std::get<VariableID::PeakSlipRate>(outputData->vars);
-    if (peakSlipsRate.isActive) {
-      auto* peakSR = local.layer->var(drDescr->peakSlipRate);
-      peakSlipsRate(level, i) = peakSR[local.ltsId][local.nearestGpIndex];
-    }
-
-    auto& dynamicStressTime = std::get<VariableID::DynamicStressTime>(outputData->vars);
-    if (dynamicStressTime.isActive) {
-      auto* dynStressTime = (local.layer->var(drDescr->dynStressTime));
-      dynamicStressTime(level, i) = dynStressTime[local.ltsId][local.nearestGpIndex];
-    }
-
-    auto& slipVectors = std::get<VariableID::Slip>(outputData->vars);
-    if (slipVectors.isActive) {
-      VrtxCoords crossProduct = {0.0, 0.0, 0.0};
-      MeshTools::cross(strike.data(), tangent1.data(), crossProduct);
-
-      const double cos1 = MeshTools::dot(strike.data(), tangent1.data());
-      const double scalarProd = MeshTools::dot(crossProduct, normal.data());
-
-      // Note: cos1**2 can be greater than 1.0 because of rounding errors -> min
-      double sin1 = std::sqrt(1.0 - std::min(1.0, cos1 * cos1));
-      sin1 = (scalarProd > 0) ? sin1 : -sin1;
-
-      auto* slip1 = local.layer->var(drDescr->slip1);
-      auto* slip2 = local.layer->var(drDescr->slip2);
-
-      slipVectors(DirectionID::Strike, level, i) = cos1 * slip1[local.ltsId][local.nearestGpIndex] -
-                                                   sin1 * slip2[local.ltsId][local.nearestGpIndex];
-
-      slipVectors(DirectionID::Dip, level, i) = sin1 * slip1[local.ltsId][local.nearestGpIndex] +
-                                                cos1 * slip2[local.ltsId][local.nearestGpIndex];
+      // the receivers of a face are evaluated in blocks, padded with zero basis functions
+      const auto firstBlock = outputData->faceReceiverBlockOffsets[face];
+      const auto numberOfBlocks = outputData->faceReceiverBlockOffsets[face + 1] - firstBlock;
+      faceAlignedValuesPlus.resize(numberOfBlocks * tensor::QAtFaceReceivers::size());
+      faceAlignedValuesMinus.resize(numberOfBlocks * tensor::QAtFaceReceivers::size());
+      const real* glbToFaceAligned = outputData->glbToFaceAlignedData[firstReceiverId].data();
+      evaluateFaceAlignedDofs(dofsPlus,
+                              glbToFaceAligned,
+                              &outputData->faceBasisFunctions
+                                   .plusSide[firstBlock * tensor::basisFunctionsAtFaceReceivers::size()],
+                              numberOfReceivers,
+                              faceAlignedValuesPlus.data());
+      evaluateFaceAlignedDofs(dofsMinus,
+                              glbToFaceAligned,
+                              &outputData->faceBasisFunctions
+                                   .minusSide[firstBlock * tensor::basisFunctionsAtFaceReceivers::size()],
+                              numberOfReceivers,
+                              faceAlignedValuesMinus.data());
+
+      auto [layer, ltsId] = (*faceToLtsMap)[faceIndex];
+
+      for (size_t k = 0; k < numberOfReceivers; ++k) {
+        const size_t i = faceReceivers[firstReceiver + k];
+        assert(outputData->receiverPoints[i].isInside == true &&
+               "a receiver is not within any tetrahedron adjacent to a fault");
+
+        LocalInfo local{};
+
+        local.layer = layer;
+        local.ltsId = ltsId;
+
+        local.nearestGpIndex = outputData->receiverPoints[i].nearestGpIndex;
+        local.nearestInternalGpIndex = outputData->receiverPoints[i].nearestInternalGpIndex;
+
+        local.waveSpeedsPlus = &((local.layer->var(drDescr->waveSpeedsPlus))[local.ltsId]);
+        local.waveSpeedsMinus = &((local.layer->var(drDescr->waveSpeedsMinus))[local.ltsId]);
+
+        // the values of the k-th receiver are stored contiguously, in the layout of QAtPoint
+        std::copy_n(&faceAlignedValuesPlus[k * tensor::QAtPoint::size()],
+                    tensor::QAtPoint::size(),
+                    local.faceAlignedValuesPlus);
+        std::copy_n(&faceAlignedValuesMinus[k * tensor::QAtPoint::size()],
+                    tensor::QAtPoint::size(),
+                    local.faceAlignedValuesMinus);
+
+        const auto* initStresses = local.layer->var(drDescr->initialStressInFaultCS);
+        const auto* initStress = initStresses[local.ltsId][local.nearestGpIndex];
+
+        local.frictionCoefficient =
+            (local.layer->var(drDescr->mu))[local.ltsId][local.nearestGpIndex];
+        local.stateVariable = this->computeStateVariable(local);
+
+        local.iniTraction1 = initStress[QuantityIndices::XY];
+        local.iniTraction2 = initStress[QuantityIndices::XZ];
+        local.iniNormalTraction = initStress[QuantityIndices::XX];
+        local.fluidPressure = this->computeFluidPressure(local);
+
+        const auto& normal = outputData->faultDirections[i].faceNormal;
+        const auto& tangent1 = outputData->faultDirections[i].tangent1;
+        const auto& tangent2 = outputData->faultDirections[i].tangent2;
+        const auto& strike = outputData->faultDirections[i].strike;
+        const auto& dip = outputData->faultDirections[i].dip;
+
+        this->computeLocalStresses(local);
+        const real strength = this->computeLocalStrength(local);
+        this->updateLocalTractions(local, strength);
+
+        seissol::dynamicRupture::kernel::rotateInitStress alignAlongDipAndStrikeKernel;
+        alignAlongDipAndStrikeKernel.stressRotationMatrix =
+            outputData->stressGlbToDipStrikeAligned[i].data();
+        alignAlongDipAndStrikeKernel.reducedFaceAlignedMatrix =
+            outputData->stressFaceAlignedToGlb[i].data();
+
+        std::array<real, 6> updatedStress{};
+        updatedStress[QuantityIndices::XX] = local.transientNormalTraction;
+        updatedStress[QuantityIndices::YY] = local.faceAlignedStress22;
+        updatedStress[QuantityIndices::ZZ] = local.faceAlignedStress33;
+        updatedStress[QuantityIndices::XY] = local.updatedTraction1;
+        updatedStress[QuantityIndices::YZ] = local.faceAlignedStress23;
+        updatedStress[QuantityIndices::XZ] = local.updatedTraction2;
+
+        alignAlongDipAndStrikeKernel.initialStress = updatedStress.data();
+        std::array<real, 6> rotatedUpdatedStress{};
+        alignAlongDipAndStrikeKernel.rotatedStress = rotatedUpdatedStress.data();
+        alignAlongDipAndStrikeKernel.execute();
+
+        std::array<real, 6> stress{};
+        stress[QuantityIndices::XX] = local.transientNormalTraction;
+        stress[QuantityIndices::YY] = local.faceAlignedStress22;
+        stress[QuantityIndices::ZZ] = local.faceAlignedStress33;
+        stress[QuantityIndices::XY] = local.faceAlignedStress12;
+        stress[QuantityIndices::YZ] = local.faceAlignedStress23;
+        stress[QuantityIndices::XZ] = local.faceAlignedStress13;
+
+        alignAlongDipAndStrikeKernel.initialStress = stress.data();
+        std::array<real, 6> rotatedStress{};
+        alignAlongDipAndStrikeKernel.rotatedStress = rotatedStress.data();
+        alignAlongDipAndStrikeKernel.execute();
+
+        switch (generalParams.slipRateOutputType) {
+        case SlipRateOutputType::TractionsAndFailure: {
+          this->computeSlipRate(local, rotatedUpdatedStress, rotatedStress);
+          break;
+        }
+        case SlipRateOutputType::VelocityDifference: {
+          this->computeSlipRate(local, tangent1, tangent2, strike, dip);
+          break;
+        }
+        }
+
+        adjustRotatedUpdatedStress(rotatedUpdatedStress, rotatedStress);
+
+        auto& slipRate = std::get<VariableID::SlipRate>(outputData->vars);
+        if (slipRate.isActive) {
+          slipRate(DirectionID::Strike, level, i) = local.slipRateStrike;
+          slipRate(DirectionID::Dip, level, i) = local.slipRateDip;
+        }
+
+        auto& transientTractions = std::get<VariableID::TransientTractions>(outputData->vars);
+        if (transientTractions.isActive) {
+          transientTractions(DirectionID::Strike, level, i) =
+              rotatedUpdatedStress[QuantityIndices::XY];
+          transientTractions(DirectionID::Dip, level, i) =
+              rotatedUpdatedStress[QuantityIndices::XZ];
+          transientTractions(DirectionID::Normal, level, i) =
+              local.transientNormalTraction - local.fluidPressure;
+        }
+
+        auto& frictionAndState = std::get<VariableID::FrictionAndState>(outputData->vars);
+        if (frictionAndState.isActive) {
+          frictionAndState(ParamID::FrictionCoefficient, level, i) = local.frictionCoefficient;
+          frictionAndState(ParamID::State, level, i) = local.stateVariable;
+        }
+
+        auto& ruptureTime = std::get<VariableID::RuptureTime>(outputData->vars);
+        if (ruptureTime.isActive) {
+          auto* rt = local.layer->var(drDescr->ruptureTime);
+          ruptureTime(level, i) = rt[local.ltsId][local.nearestGpIndex];
+        }
+
+        auto& normalVelocity = std::get<VariableID::NormalVelocity>(outputData->vars);
+        if (normalVelocity.isActive) {
+          normalVelocity(level, i) = local.faultNormalVelocity;
+        }
+
+        auto& accumulatedSlip = std::get<VariableID::AccumulatedSlip>(outputData->vars);
+        if (accumulatedSlip.isActive) {
+          auto* slip = local.layer->var(drDescr->accumulatedSlipMagnitude);
+          accumulatedSlip(level, i) = slip[local.ltsId][local.nearestGpIndex];
+        }
+
+        auto& totalTractions = std::get<VariableID::TotalTractions>(outputData->vars);
+        if (totalTractions.isActive) {
+          std::array<real, tensor::rotatedStress::size()> rotatedInitStress{};
+          alignAlongDipAndStrikeKernel.initialStress = initStress;
+          alignAlongDipAndStrikeKernel.rotatedStress = rotatedInitStress.data();
+          alignAlongDipAndStrikeKernel.execute();
+
+          totalTractions(DirectionID::Strike, level, i) =
+              rotatedUpdatedStress[QuantityIndices::XY] + rotatedInitStress[QuantityIndices::XY];
+          totalTractions(DirectionID::Dip, level, i) =
+              rotatedUpdatedStress[QuantityIndices::XZ] + rotatedInitStress[QuantityIndices::XZ];
+          totalTractions(DirectionID::Normal, level, i) = local.transientNormalTraction -
+                                                          local.fluidPressure +
+                                                          rotatedInitStress[QuantityIndices::XX];
+        }
+
+        auto& ruptureVelocity = std::get<VariableID::RuptureVelocity>(outputData->vars);
+        if (ruptureVelocity.isActive) {
+          ruptureVelocity(level, i) =
+              this->computeRuptureVelocity(outputData->ruptureTimeGradient[i].data(), local);
+        }
+
+        auto& peakSlipsRate = std::get<VariableID::PeakSlipRate>(outputData->vars);
+        if (peakSlipsRate.isActive) {
+          auto* peakSR = local.layer->var(drDescr->peakSlipRate);
+          peakSlipsRate(level, i) = peakSR[local.ltsId][local.nearestGpIndex];
+        }
+
+        auto& dynamicStressTime = std::get<VariableID::DynamicStressTime>(outputData->vars);
+        if (dynamicStressTime.isActive) {
+          auto* dynStressTime = (local.layer->var(drDescr->dynStressTime));
+          dynamicStressTime(level, i) = dynStressTime[local.ltsId][local.nearestGpIndex];
+        }
+
+        auto& slipVectors = std::get<VariableID::Slip>(outputData->vars);
+        if (slipVectors.isActive) {
+          VrtxCoords crossProduct = {0.0, 0.0, 0.0};
+          MeshTools::cross(strike.data(), tangent1.data(), crossProduct);
+
+          const double cos1 = MeshTools::dot(strike.data(), tangent1.data());
+          const double scalarProd = MeshTools::dot(crossProduct, normal.data());
+
+          // Note: cos1**2 can be greater than 1.0 because of rounding errors -> min
+          double sin1 = std::sqrt(1.0 - std::min(1.0, cos1 * cos1));
+          sin1 = (scalarProd > 0) ? sin1 : -sin1;
+
+          auto* slip1 = local.layer->var(drDescr->slip1);
+          auto* slip2 = local.layer->var(drDescr->slip2);
+
+          slipVectors(DirectionID::Strike, level, i) =
+              cos1 * slip1[local.ltsId][local.nearestGpIndex] -
+              sin1 * slip2[local.ltsId][local.nearestGpIndex];
+
+          slipVectors(DirectionID::Dip, level, i) =
+              sin1 * slip1[local.ltsId][local.nearestGpIndex] +
+              cos1 * slip2[local.ltsId][local.nearestGpIndex];
+        }
+        this->outputSpecifics(outputData, local, level, i);
+      }
     }
-    this->outputSpecifics(outputData, local, level, i);
   }
 
   if (type == OutputType::AtPickpoint) {
@@ -408,9 +450,9 @@ void ReceiverOutput::computeSlipRate(LocalInfo& local,
   }
 }
 
-real ReceiverOutput::computeRuptureVelocity(Eigen::Matrix<real, 2, 2>& jacobiT2d,
+real ReceiverOutput::computeRuptureVelocity(const real* ruptureTimeGradient,
                                             const LocalInfo& local) {
-  auto* ruptureTime = (local.layer->var(drDescr->ruptureTime))[local.ltsId];
+  const auto* ruptureTime = (local.layer->var(drDescr->ruptureTime))[local.ltsId];
   real ruptureVelocity = 0.0;
 
   bool needsUpdate{true};
@@ -421,48 +463,12 @@ real ReceiverOutput::computeRuptureVelocity(Eigen::Matrix<real, 2, 2>& jacobiT2d
   }
 
   if (needsUpdate) {
-    constexpr int numPoly = CONVERGENCE_ORDER - 1;
-    constexpr int numDegFr2d = (numPoly + 1) * (numPoly + 2) / 2;
-    std::array<double, numDegFr2d> projectedRT{};
-    projectedRT.fill(0.0);
-
-    std::array<double, 2 * numDegFr2d> phiAtPoint{};
-    phiAtPoint.fill(0.0);
-
-    auto chiTau2dPoints =
-        init::quadpoints::view::create(const_cast<real*>(init::quadpoints::Values));
-    auto weights = init::quadweights::view::create(const_cast<real*>(init::quadweights::Values));
-
-    auto* rt = local.layer->var(drDescr->ruptureTime);
+    real dTdX{0.0};
+    real dTdY{0.0};
     for (size_t jBndGP = 0; jBndGP < misc::numberOfBoundaryGaussPoints; ++jBndGP) {
-      real chi = chiTau2dPoints(jBndGP, 0);
-      real tau = chiTau2dPoints(jBndGP, 1);
-      basisFunction::tri_dubiner::evaluatePolynomials(phiAtPoint.data(), chi, tau, numPoly);
-
-      for (size_t d = 0; d < numDegFr2d; ++d) {
-        projectedRT[d] += weights(jBndGP) * rt[local.ltsId][jBndGP] * phiAtPoint[d];
-      }
-    }
-
-    auto m2inv =
-        seissol::init::M2inv::view::create(const_cast<real*>(seissol::init::M2inv::Values));
-    for (size_t d = 0; d < numDegFr2d; ++d) {
-      projectedRT[d] *= m2inv(d, d);
-    }
-
-    const real chi = chiTau2dPoints(local.nearestInternalGpIndex, 0);
-    const real tau = chiTau2dPoints(local.nearestInternalGpIndex, 1);
-
-    basisFunction::tri_dubiner::evaluateGradPolynomials(phiAtPoint.data(), chi, tau, numPoly);
-
-    real dTdChi{0.0};
-    real dTdTau{0.0};
-    for (size_t d = 0; d < numDegFr2d; ++d) {
-      dTdChi += projectedRT[d] * phiAtPoint[2 * d];
-      dTdTau += projectedRT[d] * phiAtPoint[2 * d + 1];
+      dTdX += ruptureTimeGradient[jBndGP] * ruptureTime[jBndGP];
+      dTdY += ruptureTimeGradient[misc::numberOfBoundaryGaussPoints + jBndGP] * ruptureTime[jBndGP];
     }
-    const real dTdX = jacobiT2d(0, 0) * dTdChi + jacobiT2d(0, 1) * dTdTau;
-    const real dTdY = jacobiT2d(1, 0) * dTdChi + jacobiT2d(1, 1) * dTdTau;
 
     const real slowness = misc::magnitude(dTdX, dTdY);
     ruptureVelocity = (slowness == 0.0) ? 0.0 : 1.0 / slowness;
@@ -29,6 +29,19 @@ class ReceiverOutput {
                        const GeneralParams& generalParams,
                        double time = 0.0);
 
+  /**
+   * Evaluates the face-aligned quantities at all receivers of a fault face, one block of
+   * tensor::basisFunctionsAtFaceReceivers::Shape[1] receivers at a time.
+   * basisFunctions holds the zero-padded blocks of the face (see ReceiverOutputData), and
+   * faceAlignedValues receives one tensor::QAtFaceReceivers per block, i.e. the values of the
+   * k-th receiver start at k * tensor::QAtPoint::size().
+   */
+  static void evaluateFaceAlignedDofs(const real* dofs,
+                                      const real* glbToFaceAligned,
+                                      const real* basisFunctions,
+                                      std::size_t numberOfReceivers,
+                                      real* faceAlignedValues);
+
   protected:
   seissol::initializers::LTS* wpDescr{nullptr};
   seissol::initializers::LTSTree* wpTree{nullptr};
@@ -76,14 +89,17 @@ class ReceiverOutput {
     model::IsotropicWaveSpeeds* waveSpeedsMinus{};
   };
 
-  void getDofs(real dofs[tensor::Q::size()], int meshId);
-  void getNeighbourDofs(real dofs[tensor::Q::size()], int meshId, int side);
+#ifndef ACL_DEVICE
+  const real* getDofs(int meshId);
+  const real* getNeighbourDofs(int meshId, int side);
+#endif
+
   void computeLocalStresses(LocalInfo& local);
   virtual real computeLocalStrength(LocalInfo& local) = 0;
   virtual real computeFluidPressure(LocalInfo& local) { return 0.0; }
   virtual real computeStateVariable(LocalInfo& local) { return 0.0; }
   void updateLocalTractions(LocalInfo& local, real strength);
-  real computeRuptureVelocity(Eigen::Matrix<real, 2, 2>& jacobiT2d, const LocalInfo& local);
+  real computeRuptureVelocity(const real* ruptureTimeGradient, const LocalInfo& local);
   virtual void
       computeSlipRate(LocalInfo& local, const std::array<real, 6>&, const std::array<real, 6>&);
   void computeSlipRate(LocalInfo& local,
@@ -33,6 +33,10 @@ struct DRParameters {
   real rsSr0{0.0};
   real rsInitialSlipRate1{0.0};
   real rsInitialSlipRate2{0.0};
+  bool rsAdaptiveSolver{false};
+  bool hostPipeline{false};
+  // number of sub steps of the friction law in each time step of the DR faces
+  unsigned frictionSubSteps{1};
   real muW{0.0};
   real thermalDiffusivity{0.0};
   real heatCapacity{0.0};
@@ -73,6 +77,23 @@ inline std::unique_ptr<DRParameters> readParametersFromYaml(std::shared_ptr<YAML
     drParameters->backgroundType = getWithDefault(yamlDrParams, "backgroundtype", 0);
     drParameters->isThermalPressureOn = getWithDefault(yamlDrParams, "thermalpress", false);
     drParameters->t0 = getWithDefault(yamlDrParams, "t_0", 0.0);
+    drParameters->hostPipeline = getWithDefault(yamlDrParams, "hostpipeline", false);
+    drParameters->frictionSubSteps = getWithDefault(yamlDrParams, "frictionsubsteps", 1u);
+    if (drParameters->frictionSubSteps == 0) {
+      logError() << "FrictionSubSteps has to be at least 1.";
+    }
+#ifdef ACL_DEVICE
+    if (drParameters->frictionSubSteps > 1) {
+      logWarning(seissol::MPI::mpi.rank())
+          << "Friction sub steps are not supported on GPUs, using FrictionSubSteps=1.";
+      drParameters->frictionSubSteps = 1;
+    }
+#endif
+    if (drParameters->hostPipeline && drParameters->frictionSubSteps > 1) {
+      logWarning(seissol::MPI::mpi.rank())
+          << "The host pipeline does not support friction sub steps, switching it off.";
+      drParameters->hostPipeline = false;
+    }
 
     if ((drParameters->frictionLawType == FrictionLawType::RateAndStateAgingLaw) or
         (drParameters->frictionLawType == FrictionLawType::RateAndStateSlipLaw) or
@@ -83,6 +104,7 @@ inline std::unique_ptr<DRParameters> readParametersFromYaml(std::shared_ptr<YAML
       drParameters->rsSr0 = getOrFail<double>(yamlDrParams, "rs_sr0");
       drParameters->rsInitialSlipRate1 = getOrFail<double>(yamlDrParams, "rs_inisliprate1");
       drParameters->rsInitialSlipRate2 = getOrFail<double>(yamlDrParams, "rs_inisliprate2");
+      drParameters->rsAdaptiveSolver = getWithDefault(yamlDrParams, "rs_adaptivesolver", false);
     }
     if (drParameters->frictionLawType == FrictionLawType::RateAndStateFastVelocityWeakening) {
       drParameters->muW = getOrFail<double>(yamlDrParams, "rs_muw");
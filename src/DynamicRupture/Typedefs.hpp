@@ -45,22 +45,28 @@ struct ImpedanceMatrices {
  * Struct that contains all input stresses
  * normalStress in direction of the face normal, traction1, traction2 in the direction of the
  * respective tangential vectors
+ * For NumFaces > 1, the points of consecutive faces are stored contiguously for each time index
+ * (see misc::numFacesPerBatch).
  */
-struct FaultStresses {
-  alignas(ALIGNMENT) real normalStress[CONVERGENCE_ORDER][misc::numPaddedPoints] = {{}};
-  alignas(ALIGNMENT) real traction1[CONVERGENCE_ORDER][misc::numPaddedPoints] = {{}};
-  alignas(ALIGNMENT) real traction2[CONVERGENCE_ORDER][misc::numPaddedPoints] = {{}};
-  alignas(ALIGNMENT) real fluidPressure[CONVERGENCE_ORDER][misc::numPaddedPoints] = {{}};
+template <unsigned NumFaces>
+struct FaultStressesTile {
+  alignas(ALIGNMENT) real normalStress[CONVERGENCE_ORDER][NumFaces * misc::numPaddedPoints] = {{}};
+  alignas(ALIGNMENT) real traction1[CONVERGENCE_ORDER][NumFaces * misc::numPaddedPoints] = {{}};
+  alignas(ALIGNMENT) real traction2[CONVERGENCE_ORDER][NumFaces * misc::numPaddedPoints] = {{}};
+  alignas(ALIGNMENT) real fluidPressure[CONVERGENCE_ORDER][NumFaces * misc::numPaddedPoints] = {{}};
 };
+using FaultStresses = FaultStressesTile<1>;
 
 /**
  * Struct that contains all traction results
  * traction1, traction2 in the direction of the respective tangential vectors
  */
-struct TractionResults {
-  alignas(ALIGNMENT) real traction1[CONVERGENCE_ORDER][misc::numPaddedPoints] = {{}};
-  alignas(ALIGNMENT) real traction2[CONVERGENCE_ORDER][misc::numPaddedPoints] = {{}};
+template <unsigned NumFaces>
+struct TractionResultsTile {
+  alignas(ALIGNMENT) real traction1[CONVERGENCE_ORDER][NumFaces * misc::numPaddedPoints] = {{}};
+  alignas(ALIGNMENT) real traction2[CONVERGENCE_ORDER][NumFaces * misc::numPaddedPoints] = {{}};
 };
+using TractionResults = TractionResultsTile<1>;
 
 } // namespace seissol::dr
 
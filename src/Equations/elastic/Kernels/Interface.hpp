@@ -51,7 +51,12 @@ namespace seissol::kernels {
     };
 #ifndef ACL_DEVICE
     LTSTREE_GENERATE_INTERFACE(LocalData, initializers::LTS, cellInformation, localIntegration, neighboringIntegration, dofs, faceDisplacements, boundaryMapping, material)
+#ifdef USE_COMPRESSED_CELL_MATRICES
+    // the neighboring flux solvers are computed from the geometry in localIntegration
+    LTSTREE_GENERATE_INTERFACE(NeighborData, initializers::LTS, cellInformation, localIntegration, neighboringIntegration, dofs)
+#else
     LTSTREE_GENERATE_INTERFACE(NeighborData, initializers::LTS, cellInformation, neighboringIntegration, dofs)
+#endif
 #else
     LTSTREE_GENERATE_INTERFACE(LocalData, initializers::LTS, cellInformation, localIntegration, neighboringIntegration, dofs, faceDisplacements, localIntegrationOnDevice, neighIntegrationOnDevice, plasticity, boundaryMapping, material)
     LTSTREE_GENERATE_INTERFACE(NeighborData, initializers::LTS, cellInformation, neighboringIntegration, dofs, neighIntegrationOnDevice)
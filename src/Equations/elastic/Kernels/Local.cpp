@@ -55,6 +55,7 @@
 #pragma GCC diagnostic pop
 
 #include <Kernels/common.hpp>
+#include <Kernels/CompressedCellMatrices.h>
 GENERATE_HAS_MEMBER(ET)
 GENERATE_HAS_MEMBER(sourceMatrix)
 
@@ -80,6 +81,10 @@ void seissol::kernels::Local::setHostGlobalData(GlobalData const* global) {
 
   m_projectKrnlPrototype.V3mTo2nFace = global->V3mTo2nFace;
   m_projectRotatedKrnlPrototype.V3mTo2nFace = global->V3mTo2nFace;
+
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  m_cellMatrixTable = global->cellMatrixTable;
+#endif
 }
 
 void seissol::kernels::Local::setGlobalData(const CompoundGlobalData& global) {
@@ -146,8 +151,14 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   kernel::volume volKrnl = m_volumeKernelPrototype;
   volKrnl.Q = data.dofs;
   volKrnl.I = i_timeIntegratedDegreesOfFreedom;
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  alignas(ALIGNMENT) real starMatrices[3][tensor::star::size(0)];
+  assembleStarMatrices(*m_cellMatrixTable, data.localIntegration, starMatrices);
+#else
+  auto* starMatrices = data.localIntegration.starMatrices;
+#endif
   for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
-    volKrnl.star(i) = data.localIntegration.starMatrices[i];
+    volKrnl.star(i) = starMatrices[i];
   }
 
   // Optional source term
@@ -164,7 +175,13 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   for (int face = 0; face < 4; ++face) {
     // no element local contribution in the case of dynamic rupture boundary conditions
     if (data.cellInformation.faceTypes[face] != FaceType::dynamicRupture) {
+#ifdef USE_COMPRESSED_CELL_MATRICES
+      alignas(ALIGNMENT) real AplusT[tensor::AplusT::size()];
+      computeLocalFluxSolver(*m_cellMatrixTable, data.localIntegration, face, AplusT);
+      lfKrnl.AplusT = AplusT;
+#else
       lfKrnl.AplusT = data.localIntegration.nApNm1[face];
+#endif
       lfKrnl.execute(face);
     }
 
@@ -174,7 +191,18 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
     nodalLfKrnl.INodal = dofsFaceBoundaryNodal;
     nodalLfKrnl._prefetch.I = i_timeIntegratedDegreesOfFreedom + tensor::I::size();
     nodalLfKrnl._prefetch.Q = data.dofs + tensor::Q::size();
+#ifdef USE_COMPRESSED_CELL_MATRICES
+    // only needed for the boundary conditions below
+    alignas(ALIGNMENT) real AminusT[tensor::AminusT::size()];
+    const auto faceType = data.cellInformation.faceTypes[face];
+    if (faceType == FaceType::freeSurfaceGravity || faceType == FaceType::dirichlet ||
+        faceType == FaceType::analytical) {
+      computeNeighborFluxSolver(*m_cellMatrixTable, data.localIntegration, faceType, face, AminusT);
+    }
+    nodalLfKrnl.AminusT = AminusT;
+#else
     nodalLfKrnl.AminusT = data.neighboringIntegration.nAmNm1[face];
+#endif
 
     // Include some boundary conditions here.
     switch (data.cellInformation.faceTypes[face]) {
@@ -428,12 +456,23 @@ void seissol::kernels::Local::flopsIntegral(FaceType const i_faceTypes[4],
     if (i_faceTypes[face] != FaceType::dynamicRupture) {
       o_nonZeroFlops += seissol::kernel::localFlux::nonZeroFlops(face);
       o_hardwareFlops += seissol::kernel::localFlux::hardwareFlops(face);
+#ifdef USE_COMPRESSED_CELL_MATRICES
+      o_nonZeroFlops += seissol::kernel::rotateFluxSolverLocal::NonZeroFlops;
+      o_hardwareFlops += seissol::kernel::rotateFluxSolverLocal::HardwareFlops;
+#endif
     }
 
     // Take boundary condition flops into account.
     // Note that this only includes the flops of the kernels but not of the
     // boundary condition implementation.
     // The (probably incorrect) assumption is that they are negligible.
+#ifdef USE_COMPRESSED_CELL_MATRICES
+    if (i_faceTypes[face] == FaceType::freeSurfaceGravity ||
+        i_faceTypes[face] == FaceType::dirichlet || i_faceTypes[face] == FaceType::analytical) {
+      o_nonZeroFlops += seissol::kernel::rotateFluxSolverNeighbor::NonZeroFlops;
+      o_hardwareFlops += seissol::kernel::rotateFluxSolverNeighbor::HardwareFlops;
+    }
+#endif
     switch (i_faceTypes[face]) {
     case FaceType::freeSurfaceGravity:
       o_nonZeroFlops += seissol::kernel::localFluxNodal::nonZeroFlops(face) +
@@ -463,10 +502,15 @@ unsigned seissol::kernels::Local::bytesIntegral()
 {
   unsigned reals = 0;
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  // geometry and indices load; the table is small enough to stay in the cache
+  reals += sizeof(LocalIntegrationData) / sizeof(real);
+#else
   // star matrices load
   reals += yateto::computeFamilySize<tensor::star>();
   // flux solvers
   reals += 4 * tensor::AplusT::size();
+#endif
 
   // DOFs write
   reals += tensor::Q::size();
@@ -59,6 +59,7 @@ namespace seissol {
   }
 }
 struct GlobalData;
+struct CellMatrixTable;
 
 class seissol::kernels::LocalBase {
   protected:
@@ -72,6 +73,10 @@ class seissol::kernels::LocalBase {
 
     kernels::DirichletBoundary dirichletBoundary;
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+    CellMatrixTable const* m_cellMatrixTable{nullptr};
+#endif
+
 #ifdef ACL_DEVICE
     kernel::gpu_volume deviceVolumeKernelPrototype;
     kernel::gpu_localFlux deviceLocalFluxKernelPrototype;
@@ -70,6 +70,7 @@
  **/
 
 #include "Kernels/Neighbor.h"
+#include "Kernels/CompressedCellMatrices.h"
 
 #include <cassert>
 #include <stdint.h>
@@ -100,6 +101,10 @@ void seissol::kernels::Neighbor::setHostGlobalData(GlobalData const* global) {
   m_nfKrnlPrototype.rT = global->neighbourChangeOfBasisMatricesTransposed;
   m_nfKrnlPrototype.fP = global->neighbourFluxMatrices;
   m_drKrnlPrototype.V3mTo2nTWDivM = global->nodalFluxMatrices;
+
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  m_cellMatrixTable = global->cellMatrixTable;
+#endif
 }
 
 void seissol::kernels::Neighbor::setGlobalData(const CompoundGlobalData& global) {
@@ -141,7 +146,17 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(NeighborData& data,
       kernel::neighboringFlux nfKrnl = m_nfKrnlPrototype;
       nfKrnl.Q = data.dofs;
       nfKrnl.I = i_timeIntegrated[l_face];
+#ifdef USE_COMPRESSED_CELL_MATRICES
+      alignas(ALIGNMENT) real AminusT[tensor::AminusT::size()];
+      computeNeighborFluxSolver(*m_cellMatrixTable,
+                                data.localIntegration,
+                                data.cellInformation.faceTypes[l_face],
+                                l_face,
+                                AminusT);
+      nfKrnl.AminusT = AminusT;
+#else
       nfKrnl.AminusT = data.neighboringIntegration.nAmNm1[l_face];
+#endif
       nfKrnl._prefetch.I = faceNeighbors_prefetch[l_face];
       nfKrnl.execute(data.cellInformation.faceRelations[l_face][1],
 		     data.cellInformation.faceRelations[l_face][0],
@@ -271,6 +286,10 @@ void seissol::kernels::Neighbor::flopsNeighborsIntegral(const FaceType i_faceTyp
       assert(i_neighboringIndices[face][0] < 4 && i_neighboringIndices[face][1] < 3);
       o_nonZeroFlops += kernel::neighboringFlux::nonZeroFlops(i_neighboringIndices[face][1], i_neighboringIndices[face][0], face);
       o_hardwareFlops += kernel::neighboringFlux::hardwareFlops(i_neighboringIndices[face][1], i_neighboringIndices[face][0], face);
+#ifdef USE_COMPRESSED_CELL_MATRICES
+      o_nonZeroFlops += kernel::rotateFluxSolverNeighbor::NonZeroFlops;
+      o_hardwareFlops += kernel::rotateFluxSolverNeighbor::HardwareFlops;
+#endif
       break;
     case FaceType::dynamicRupture:
       o_drNonZeroFlops += dynamicRupture::kernel::nodalFlux::nonZeroFlops(cellDrMapping[face].side, cellDrMapping[face].faceRelation);
@@ -291,7 +310,11 @@ unsigned seissol::kernels::Neighbor::bytesNeighborsIntegral()
   // 4 * tElasticDOFS load, DOFs load, DOFs write
   reals += 4 * tensor::I::size() + 2 * tensor::Q::size();
   // flux solvers load
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  reals += sizeof(LocalIntegrationData) / sizeof(real);
+#else
   reals += 4 * tensor::AminusT::size();
+#endif
   
   return reals * sizeof(real);
 }
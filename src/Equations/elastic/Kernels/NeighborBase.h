@@ -82,6 +82,7 @@ namespace seissol {
   }
 }
 struct GlobalData;
+struct CellMatrixTable;
 
 class seissol::kernels::NeighborBase {
   protected:
@@ -89,6 +90,10 @@ class seissol::kernels::NeighborBase {
     kernel::neighboringFlux m_nfKrnlPrototype;
     dynamicRupture::kernel::nodalFlux m_drKrnlPrototype;
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+    CellMatrixTable const* m_cellMatrixTable{nullptr};
+#endif
+
 #ifdef ACL_DEVICE
   kernel::gpu_neighboringFlux deviceNfKrnlPrototype;
   dynamicRupture::kernel::gpu_nodalFlux deviceDrKrnlPrototype;
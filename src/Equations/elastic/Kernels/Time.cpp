@@ -83,6 +83,7 @@ extern long long libxsmm_num_total_flops;
 #endif
 
 #include <Kernels/common.hpp>
+#include <Kernels/CompressedCellMatrices.h>
 #include <Kernels/denseMatrixOps.hpp>
 
 #include <cstring>
@@ -133,6 +134,9 @@ void seissol::kernels::Time::setHostGlobalData(GlobalData const* global) {
   projectDerivativeToNodalBoundaryRotated.V3mTo2nFace = global->V3mTo2nFace;
 
 #endif //USE_STP
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  m_cellMatrixTable = global->cellMatrixTable;
+#endif
 }
 
 void seissol::kernels::Time::setGlobalData(const CompoundGlobalData& global) {
@@ -172,8 +176,14 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
   alignas(PAGESIZE_STACK) real stpRhs[tensor::spaceTimePredictor::size()];
   alignas(PAGESIZE_STACK) real stp[tensor::spaceTimePredictor::size()]{};
   kernel::spaceTimePredictor krnl = m_krnlPrototype;
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  alignas(ALIGNMENT) real starMatrices[3][tensor::star::size(0)];
+  assembleStarMatrices(*m_cellMatrixTable, data.localIntegration, starMatrices);
+#else
+  auto* starMatrices = data.localIntegration.starMatrices;
+#endif
   for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
-    krnl.star(i) = data.localIntegration.starMatrices[i];
+    krnl.star(i) = starMatrices[i];
   }
   krnl.Q = const_cast<real*>(data.dofs);
   krnl.I = o_timeIntegrated;
@@ -186,8 +196,14 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
   auto* derivativesBuffer = (o_timeDerivatives != nullptr) ? o_timeDerivatives : temporaryBuffer;
 
   kernel::derivative krnl = m_krnlPrototype;
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  alignas(ALIGNMENT) real starMatrices[3][tensor::star::size(0)];
+  assembleStarMatrices(*m_cellMatrixTable, data.localIntegration, starMatrices);
+#else
+  auto* starMatrices = data.localIntegration.starMatrices;
+#endif
   for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
-    krnl.star(i) = data.localIntegration.starMatrices[i];
+    krnl.star(i) = starMatrices[i];
   }
 
   // Optional source term
@@ -361,7 +377,11 @@ unsigned seissol::kernels::Time::bytesAder()
   // DOFs load, tDOFs load, tDOFs write
   reals += tensor::Q::size() + 2 * tensor::I::size();
   // star matrices, source matrix
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  reals += sizeof(LocalIntegrationData::gradients) / sizeof(real);
+#else
   reals += yateto::computeFamilySize<tensor::star>();
+#endif
            
   /// \todo incorporate derivatives
 
@@ -83,6 +83,7 @@ namespace seissol {
   }
 }
 struct GlobalData;
+struct CellMatrixTable;
 
 class seissol::kernels::TimeBase {
   protected:
@@ -94,6 +95,9 @@ class seissol::kernels::TimeBase {
 #endif
     kernel::projectDerivativeToNodalBoundaryRotated projectDerivativeToNodalBoundaryRotated;
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+    CellMatrixTable const* m_cellMatrixTable{nullptr};
+#endif
 
   /*
    *! Offsets of the derivatives.
@@ -41,7 +41,10 @@
 
 #include "CellLocalMatrices.h"
 
+#include <array>
 #include <cassert>
+#include <map>
+#include <tuple>
 
 #include <Initializer/ParameterDB.h>
 #include "Initializer/MemoryManager.h"
@@ -52,15 +55,16 @@
 #include <generated_code/tensor.h>
 #include <generated_code/kernel.h>
 #include <utils/logger.h>
+#include <Parallel/MPI.h>
 #ifdef ACL_DEVICE
 #include <device.h>
 #endif
 
-void setStarMatrix( real* i_AT,
-                    real* i_BT,
-                    real* i_CT,
-                    real  i_grad[3],
-                    real* o_starMatrix )
+void seissol::initializers::setStarMatrix( real* i_AT,
+                                           real* i_BT,
+                                           real* i_CT,
+                                           real  i_grad[3],
+                                           real* o_starMatrix )
 {
   for (unsigned idx = 0; idx < seissol::tensor::star::size(0); ++idx) {
     o_starMatrix[idx] = i_grad[0] * i_AT[idx];
@@ -151,12 +155,21 @@ void seissol::initializers::initializeCellLocalMatrices( seissol::geometry::Mesh
 
       seissol::transformations::tetrahedronGlobalToReferenceJacobian( x, y, z, gradXi, gradEta, gradZeta );
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+      // the star matrices are assembled from the Jacobians in the cell matrix table
+      for (unsigned dim = 0; dim < 3; ++dim) {
+        localIntegration[cell].gradients[0][dim] = gradXi[dim];
+        localIntegration[cell].gradients[1][dim] = gradEta[dim];
+        localIntegration[cell].gradients[2][dim] = gradZeta[dim];
+      }
+#else
       seissol::model::getTransposedCoefficientMatrix( material[cell].local, 0, AT );
       seissol::model::getTransposedCoefficientMatrix( material[cell].local, 1, BT );
       seissol::model::getTransposedCoefficientMatrix( material[cell].local, 2, CT );
       setStarMatrix(ATData, BTData, CTData, gradXi, localIntegration[cell].starMatrices[0]);
       setStarMatrix(ATData, BTData, CTData, gradEta, localIntegration[cell].starMatrices[1]);
       setStarMatrix(ATData, BTData, CTData, gradZeta, localIntegration[cell].starMatrices[2]);
+#endif
 
       double volume = MeshTools::volume(elements[meshId], vertices);
 
@@ -170,6 +183,15 @@ void seissol::initializers::initializeCellLocalMatrices( seissol::geometry::Mesh
         MeshTools::normalize(tangent1, tangent1);
         MeshTools::normalize(tangent2, tangent2);
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+        // the flux solvers in the face-aligned frame are part of the cell matrix table
+        for (unsigned dim = 0; dim < 3; ++dim) {
+          localIntegration[cell].faceFrames[side][0][dim] = normal[dim];
+          localIntegration[cell].faceFrames[side][1][dim] = tangent1[dim];
+          localIntegration[cell].faceFrames[side][2][dim] = tangent2[dim];
+        }
+        localIntegration[cell].fluxScales[side] = -2.0 * surface / (6.0 * volume);
+#else
         real NLocalData[6*6];
         seissol::model::getBondMatrix(normal, tangent1, tangent2, NLocalData);
         if (material[cell].local.getMaterialType() == seissol::model::MaterialType::anisotropic) {
@@ -217,6 +239,7 @@ void seissol::initializers::initializeCellLocalMatrices( seissol::geometry::Mesh
           neighKrnl.Tinv = init::identityT::Values;
         }
         neighKrnl.execute();
+#endif
       }
 
       seissol::model::initializeSpecificLocalData(  material[cell].local,
@@ -234,6 +257,110 @@ void seissol::initializers::initializeCellLocalMatrices( seissol::geometry::Mesh
   }
 }
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+seissol::initializers::CellMatrixTableBuilder::CellMatrixTableBuilder( CellMatrixTable& io_table )
+  : m_table(io_table)
+{
+  m_table.jacobians.clear();
+  m_table.fluxSolvers.clear();
+}
+
+unsigned seissol::initializers::CellMatrixTableBuilder::addMaterial( seissol::model::ElasticMaterial const& i_material )
+{
+  auto const [entry, inserted] = m_materialIds.emplace(std::array<double, 3>{i_material.rho, i_material.mu, i_material.lambda},
+                                                       m_materials.size());
+  if (inserted) {
+    m_materials.push_back(i_material);
+    auto& jacobians = m_table.jacobians.emplace_back();
+    auto AT = init::star::view<0>::create(jacobians.AT);
+    auto BT = init::star::view<0>::create(jacobians.BT);
+    auto CT = init::star::view<0>::create(jacobians.CT);
+    seissol::model::getTransposedCoefficientMatrix( i_material, 0, AT );
+    seissol::model::getTransposedCoefficientMatrix( i_material, 1, BT );
+    seissol::model::getTransposedCoefficientMatrix( i_material, 2, CT );
+  }
+  return entry->second;
+}
+
+// same as in initializeCellLocalMatrices, but without the rotation into the face-aligned frame
+unsigned seissol::initializers::CellMatrixTableBuilder::addFluxSolvers( unsigned i_localId,
+                                                                        unsigned i_neighborId,
+                                                                        FaceType i_faceType )
+{
+  assert(i_localId < m_materials.size() && i_neighborId < m_materials.size());
+  auto const [entry, inserted] = m_fluxSolverIds.emplace(std::make_tuple(i_localId, i_neighborId, i_faceType),
+                                                         m_table.fluxSolvers.size());
+  if (inserted) {
+    auto& fluxSolvers = m_table.fluxSolvers.emplace_back();
+
+    real ATtildeData[tensor::star::size(0)];
+    real QgodLocalData[tensor::QgodLocal::size()];
+    real QgodNeighborData[tensor::QgodNeighbor::size()];
+    auto ATtilde = init::star::view<0>::create(ATtildeData);
+    auto QgodLocal = init::QgodLocal::view::create(QgodLocalData);
+    auto QgodNeighbor = init::QgodNeighbor::view::create(QgodNeighborData);
+
+    seissol::model::getTransposedGodunovState( m_materials[i_localId],
+                                               m_materials[i_neighborId],
+                                               i_faceType,
+                                               QgodLocal,
+                                               QgodNeighbor );
+    seissol::model::getTransposedCoefficientMatrix( m_materials[i_localId], 0, ATtilde );
+
+    kernel::computeFaceAlignedFluxSolverLocal localKrnl;
+    localKrnl.faceAlignedFluxSolver = fluxSolvers.local;
+    localKrnl.QgodLocal = QgodLocalData;
+    localKrnl.star(0) = ATtildeData;
+    localKrnl.execute();
+
+    kernel::computeFaceAlignedFluxSolverNeighbor neighKrnl;
+    neighKrnl.faceAlignedFluxSolver = fluxSolvers.neighbor;
+    neighKrnl.QgodNeighbor = QgodNeighborData;
+    neighKrnl.star(0) = ATtildeData;
+    neighKrnl.execute();
+  }
+  return entry->second;
+}
+
+void seissol::initializers::initializeCellMatrixTable( LTSTree*           io_ltsTree,
+                                                       LTS*               i_lts,
+                                                       CellMatrixTable&   o_table )
+{
+  CellMatrixTableBuilder builder(o_table);
+
+  // serial, such that the table does not depend on the number of threads
+  unsigned numberOfCells = 0;
+  for (LTSTree::leaf_iterator it = io_ltsTree->beginLeaf(LayerMask(Ghost)); it != io_ltsTree->endLeaf(); ++it) {
+    CellMaterialData*       material          = it->var(i_lts->material);
+    LocalIntegrationData*   localIntegration  = it->var(i_lts->localIntegration);
+    CellLocalInformation*   cellInformation   = it->var(i_lts->cellInformation);
+
+    for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
+      unsigned localId = builder.addMaterial(material[cell].local);
+      localIntegration[cell].jacobianId = localId;
+      for (unsigned side = 0; side < 4; ++side) {
+        unsigned neighborId = builder.addMaterial(material[cell].neighbor[side]);
+        localIntegration[cell].fluxSolverIds[side] = builder.addFluxSolvers(localId, neighborId, cellInformation[cell].faceTypes[side]);
+      }
+    }
+    numberOfCells += it->getNumberOfCells();
+  }
+
+  std::size_t tableSize = o_table.jacobians.size() * sizeof(CellMatrixTable::Jacobians)
+                        + o_table.fluxSolvers.size() * sizeof(CellMatrixTable::FluxSolvers);
+  std::size_t uncompressedSize = numberOfCells * sizeof(real)
+    * (yateto::computeFamilySize<tensor::star>() + 4 * tensor::AplusT::size() + 4 * tensor::AminusT::size());
+  logInfo(seissol::MPI::mpi.rank()) << "Compressed the cell-local matrices to" << o_table.jacobians.size()
+                                    << "materials and" << o_table.fluxSolvers.size() << "flux solvers:"
+                                    << tableSize / (1024 * 1024) << "MiB instead of"
+                                    << uncompressedSize / (1024 * 1024) << "MiB.";
+  if (2 * tableSize > uncompressedSize) {
+    logWarning(seissol::MPI::mpi.rank()) << "The material differs between most cells; the compressed cell-local"
+                                         << "matrices save little memory.";
+  }
+}
+#endif
+
 void surfaceAreaAndVolume(  seissol::geometry::MeshReader const&      i_meshReader,
                             unsigned               meshId,
                             unsigned               side,
@@ -41,6 +41,11 @@
 #ifndef CELLLOCALMATRICES_H_
 #define CELLLOCALMATRICES_H_
 
+#include <array>
+#include <map>
+#include <tuple>
+#include <vector>
+
 #include <Initializer/typedefs.hpp>
 #include <Geometry/MeshReader.h>
 #include <Initializer/LTS.h>
@@ -52,6 +57,17 @@
 namespace seissol {
   namespace initializers {
       class EasiBoundary;
+
+      /**
+       * Assembles a star matrix as the linear combination of the transposed Jacobians A^T, B^T,
+       * and C^T with the gradient of one reference coordinate.
+       **/
+     void setStarMatrix( real* i_AT,
+                         real* i_BT,
+                         real* i_CT,
+                         real  i_grad[3],
+                         real* o_starMatrix );
+
       /**
       * Computes the star matrices A*, B*, and C*, and solves the Riemann problems at the interfaces.
       **/
@@ -60,6 +76,39 @@ namespace seissol {
                                        LTS*                   i_lts,
                                        Lut*                   i_ltsLut,
                                        TimeStepping const&    timeStepping );
+
+#ifdef USE_COMPRESSED_CELL_MATRICES
+     /**
+      * Adds the material-dependent parts of the cell-local matrices to a table, once per material
+      * and once per pair of materials and face type.
+      **/
+     class CellMatrixTableBuilder {
+     public:
+       explicit CellMatrixTableBuilder( CellMatrixTable& io_table );
+
+       //! Returns the index of the Jacobians of the material, which are added if the material is new.
+       unsigned addMaterial( seissol::model::ElasticMaterial const& i_material );
+
+       //! Returns the index of the flux solvers in the face-aligned frame, which are added if the
+       //! combination is new. The material ids are the ones returned by addMaterial.
+       unsigned addFluxSolvers( unsigned i_localId, unsigned i_neighborId, FaceType i_faceType );
+
+     private:
+       CellMatrixTable& m_table;
+       std::map<std::array<double, 3>, unsigned> m_materialIds;
+       std::map<std::tuple<unsigned, unsigned, FaceType>, unsigned> m_fluxSolverIds;
+       std::vector<seissol::model::ElasticMaterial> m_materials;
+     };
+
+     /**
+      * Fills the table with the Jacobians of all materials and with the flux solvers in the
+      * face-aligned frame of all pairs of materials and face types, and stores the indices into
+      * the table in the cells. The geometric parts are set by initializeCellLocalMatrices.
+      **/
+     void initializeCellMatrixTable( LTSTree*           io_ltsTree,
+                                     LTS*               i_lts,
+                                     CellMatrixTable&   o_table );
+#endif
                                        
      void initializeBoundaryMappings(seissol::geometry::MeshReader const& i_meshReader,
                                      const EasiBoundary* easiBoundary,
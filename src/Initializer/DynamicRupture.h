@@ -95,15 +95,17 @@ public:
   // will be always zero, if not using poroelasticity
   Variable<real[dr::misc::numPaddedPoints]> initialPressure;
   Variable<real[dr::misc::numPaddedPoints]> nucleationPressure;
-  Variable<real[dr::misc::numPaddedPoints]> mu;
-  Variable<real[dr::misc::numPaddedPoints]> accumulatedSlipMagnitude;
-  Variable<real[dr::misc::numPaddedPoints]> slip1; // slip at given fault node along local direction 1
-  Variable<real[dr::misc::numPaddedPoints]> slip2; // slip at given fault node along local direction 2
+  // the friction state, slip and rupture times are accumulated over the whole simulation, hence
+  // they are kept in realAcc (double in mixed precision)
+  Variable<realAcc[dr::misc::numPaddedPoints]> mu;
+  Variable<realAcc[dr::misc::numPaddedPoints]> accumulatedSlipMagnitude;
+  Variable<realAcc[dr::misc::numPaddedPoints]> slip1; // slip at given fault node along local direction 1
+  Variable<realAcc[dr::misc::numPaddedPoints]> slip2; // slip at given fault node along local direction 2
   Variable<real[dr::misc::numPaddedPoints]> slipRateMagnitude;
-  Variable<real[dr::misc::numPaddedPoints]> slipRate1; // slip rate at given fault node along local direction 1
-  Variable<real[dr::misc::numPaddedPoints]> slipRate2; // slip rate at given fault node along local direction 2
-  Variable<real[dr::misc::numPaddedPoints]> ruptureTime;
-  Variable<real[dr::misc::numPaddedPoints]> dynStressTime;
+  Variable<realAcc[dr::misc::numPaddedPoints]> slipRate1; // slip rate at given fault node along local direction 1
+  Variable<realAcc[dr::misc::numPaddedPoints]> slipRate2; // slip rate at given fault node along local direction 2
+  Variable<realAcc[dr::misc::numPaddedPoints]> ruptureTime;
+  Variable<realAcc[dr::misc::numPaddedPoints]> dynStressTime;
   Variable<bool[dr::misc::numPaddedPoints]> ruptureTimePending;
   Variable<bool[dr::misc::numPaddedPoints]> dynStressTimePending;
   Variable<real[dr::misc::numPaddedPoints]> peakSlipRate;
@@ -181,7 +183,7 @@ struct seissol::initializers::LTSLinearSlipWeakening : public seissol::initializ
 };
 
 struct seissol::initializers::LTSLinearSlipWeakeningBimaterial : public seissol::initializers::LTSLinearSlipWeakening {
-  Variable<real[dr::misc::numPaddedPoints]> regularisedStrength;
+  Variable<realAcc[dr::misc::numPaddedPoints]> regularisedStrength;
 
   virtual void addTo(initializers::LTSTree& tree) {
     seissol::initializers::LTSLinearSlipWeakening::addTo(tree);
@@ -193,7 +195,7 @@ struct seissol::initializers::LTSLinearSlipWeakeningBimaterial : public seissol:
 struct seissol::initializers::LTSRateAndState : public seissol::initializers::DynamicRupture {
   Variable<real[dr::misc::numPaddedPoints]> rsA;
   Variable<real[dr::misc::numPaddedPoints]> rsSl0;
-  Variable<real[dr::misc::numPaddedPoints]> stateVariable;
+  Variable<realAcc[dr::misc::numPaddedPoints]> stateVariable;
 
   virtual void addTo(initializers::LTSTree& tree) {
     seissol::initializers::DynamicRupture::addTo(tree);
@@ -221,8 +223,9 @@ struct seissol::initializers::LTSRateAndStateThermalPressurization : public seis
   Variable<real[dr::misc::numPaddedPoints]> pressure;
   Variable<real[dr::misc::numPaddedPoints][seissol::dr::misc::numberOfTPGridPoints]> theta;
   Variable<real[dr::misc::numPaddedPoints][seissol::dr::misc::numberOfTPGridPoints]> sigma;
-  Variable<real[dr::misc::numPaddedPoints][seissol::dr::misc::numberOfTPGridPoints]> thetaTmpBuffer;
-  Variable<real[dr::misc::numPaddedPoints][seissol::dr::misc::numberOfTPGridPoints]> sigmaTmpBuffer;
+  Variable<real[dr::misc::numPaddedPoints][seissol::dr::misc::numberOfTPGridPoints]> thetaDecay;
+  Variable<real[dr::misc::numPaddedPoints][seissol::dr::misc::numberOfTPGridPoints]> sigmaDecay;
+  Variable<real> decayTimeStepWidth; // time step width of thetaDecay and sigmaDecay
   Variable<real[dr::misc::numPaddedPoints]> faultStrength;
   Variable<real[dr::misc::numPaddedPoints]>halfWidthShearZone;
   Variable<real[dr::misc::numPaddedPoints]> hydraulicDiffusivity;
@@ -234,8 +237,9 @@ struct seissol::initializers::LTSRateAndStateThermalPressurization : public seis
     tree.addVar(pressure, mask, ALIGNMENT, seissol::memory::Standard);
     tree.addVar(theta, mask, ALIGNMENT, seissol::memory::Standard);
     tree.addVar(sigma, mask, ALIGNMENT, seissol::memory::Standard);
-    tree.addVar(thetaTmpBuffer, mask, ALIGNMENT, seissol::memory::Standard);
-    tree.addVar(sigmaTmpBuffer, mask, ALIGNMENT, seissol::memory::Standard);
+    tree.addVar(thetaDecay, mask, ALIGNMENT, seissol::memory::Standard);
+    tree.addVar(sigmaDecay, mask, ALIGNMENT, seissol::memory::Standard);
+    tree.addVar(decayTimeStepWidth, mask, 1, seissol::memory::Standard);
     tree.addVar(faultStrength, mask, ALIGNMENT, seissol::memory::Standard);
     tree.addVar(halfWidthShearZone, mask, ALIGNMENT, seissol::memory::Standard);
     tree.addVar(hydraulicDiffusivity, mask, ALIGNMENT, seissol::memory::Standard);
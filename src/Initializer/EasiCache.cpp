@@ -0,0 +1,243 @@
+#include "EasiCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <system_error>
+
+#include <unistd.h>
+#include <yaml-cpp/yaml.h>
+
+#include "Common/filesystem.h"
+#include "Common/fnv1a.h"
+#include "Parallel/MPI.h"
+#include "easi/Query.h"
+#include "utils/env.h"
+#include "utils/logger.h"
+
+namespace {
+
+constexpr char Magic[8] = {'S', 'S', 'E', 'A', 'S', 'I', 'C', '\0'};
+
+template <typename T>
+std::uint64_t hashValue(std::uint64_t hash, const T& value) {
+  return seissol::fnv1aUpdate(hash, &value, sizeof(T));
+}
+
+std::uint64_t hashQuery(std::uint64_t hash, const easi::Query& query) {
+  // Hash blocks of points in parallel and combine the hashes of the blocks in order
+  constexpr unsigned BlockSize = 4096;
+  const unsigned numPoints = query.numPoints();
+  const unsigned dimDomain = query.dimDomain();
+  std::vector<std::uint64_t> blockHashes((numPoints + BlockSize - 1) / BlockSize);
+
+#pragma omp parallel for schedule(static)
+  for (std::size_t block = 0; block < blockHashes.size(); ++block) {
+    std::uint64_t blockHash = seissol::Fnv1aBasis;
+    const unsigned end = std::min(numPoints, static_cast<unsigned>((block + 1) * BlockSize));
+    for (unsigned point = block * BlockSize; point < end; ++point) {
+      for (unsigned dim = 0; dim < dimDomain; ++dim) {
+        blockHash = hashValue(blockHash, static_cast<double>(query.x(point, dim)));
+      }
+      blockHash = hashValue(blockHash, static_cast<int>(query.group(point)));
+    }
+    blockHashes[block] = blockHash;
+  }
+
+  hash = hashValue(hash, numPoints);
+  hash = hashValue(hash, dimDomain);
+  return seissol::fnv1aUpdate(
+      hash, blockHashes.data(), blockHashes.size() * sizeof(std::uint64_t));
+}
+
+void collectReferencedFiles(const YAML::Node& node,
+                            std::vector<std::string>& includes,
+                            std::vector<std::string>& dataFiles) {
+  if (node.IsScalar()) {
+    if (node.Tag() == "!Include") {
+      includes.push_back(node.Scalar());
+    }
+  } else if (node.IsMap()) {
+    for (const auto& entry : node) {
+      // the grids of ASAGI (and NetCDF) components
+      if (entry.first.IsScalar() && entry.first.Scalar() == "file" && entry.second.IsScalar()) {
+        dataFiles.push_back(entry.second.Scalar());
+      } else {
+        collectReferencedFiles(entry.second, includes, dataFiles);
+      }
+    }
+  } else if (node.IsSequence()) {
+    for (const auto& entry : node) {
+      collectReferencedFiles(entry, includes, dataFiles);
+    }
+  }
+}
+
+seissol::filesystem::path resolvePath(const seissol::filesystem::path& modelFile,
+                                      const std::string& name) {
+  const seissol::filesystem::path path(name);
+  if (path.is_relative()) {
+    // try relative to the referencing file first, then relative to the working directory
+    const auto relative = modelFile.parent_path() / path;
+    std::error_code error;
+    if (seissol::filesystem::exists(relative, error)) {
+      return relative;
+    }
+  }
+  return path;
+}
+
+/**
+ * Hashes the path, the size and the modification time of a data file. Hashing the contents of a
+ * large grid would take about as long as querying it.
+ */
+std::uint64_t hashFileStatus(std::uint64_t hash, const seissol::filesystem::path& path) {
+  const std::string name = path.string();
+  hash = seissol::fnv1aUpdate(hash, name.data(), name.size());
+  std::error_code error;
+  const auto size = static_cast<std::uint64_t>(seissol::filesystem::file_size(path, error));
+  const auto modified = static_cast<std::int64_t>(
+      seissol::filesystem::last_write_time(path, error).time_since_epoch().count());
+  hash = hashValue(hash, size);
+  return hashValue(hash, modified);
+}
+
+/**
+ * Implements hashModelFile; visited contains the model files hashed so far.
+ */
+bool hashModelFileRecursive(std::uint64_t& hash,
+                            const seissol::filesystem::path& path,
+                            std::set<std::string>& visited) {
+  std::ifstream file(path.string(), std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  const std::string contents{std::istreambuf_iterator<char>(file),
+                             std::istreambuf_iterator<char>()};
+  hash = seissol::fnv1aUpdate(hash, contents.data(), contents.size());
+  if (!visited.insert(path.string()).second) {
+    // included repeatedly (or recursively); the contents are already covered
+    return true;
+  }
+
+  std::vector<std::string> includes;
+  std::vector<std::string> dataFiles;
+  try {
+    collectReferencedFiles(YAML::Load(contents), includes, dataFiles);
+  } catch (const YAML::Exception&) {
+    // easi reports the syntax error
+    return false;
+  }
+  for (const auto& include : includes) {
+    if (!hashModelFileRecursive(hash, resolvePath(path, include), visited)) {
+      return false;
+    }
+  }
+  for (const auto& dataFile : dataFiles) {
+    hash = hashFileStatus(hash, resolvePath(path, dataFile));
+  }
+  return true;
+}
+
+} // namespace
+
+namespace seissol::initializers {
+
+bool hashModelFile(std::uint64_t& hash, const std::string& fileName) {
+  std::set<std::string> visited;
+  return hashModelFileRecursive(hash, fileName, visited);
+}
+
+EasiCache::EasiCache(const std::string& fileName,
+                     const std::string& description,
+                     const easi::Query* query) {
+  const std::string directory = utils::Env::get<const char*>("SEISSOL_EASI_CACHE", "");
+  if (directory.empty()) {
+    return;
+  }
+
+  std::uint64_t hash = hashValue(Fnv1aBasis, Version);
+  if (!hashModelFile(hash, fileName)) {
+    // easi reports the missing or invalid file
+    return;
+  }
+  hash = fnv1aUpdate(hash, description.data(), description.size());
+  if (query != nullptr) {
+    hash = hashQuery(hash, *query);
+  }
+  key = hash;
+  modelFileName = fileName;
+
+  std::error_code error;
+  seissol::filesystem::create_directories(directory, error);
+
+  std::ostringstream name;
+  name << directory << '/' << std::hex << std::setw(16) << std::setfill('0') << key;
+  path = name.str();
+}
+
+bool EasiCache::load(std::vector<char>& data) const {
+  if (!isEnabled()) {
+    return false;
+  }
+
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+
+  char magic[sizeof(Magic)];
+  std::uint64_t fileKey = 0;
+  std::uint64_t size = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&fileKey), sizeof(fileKey));
+  file.read(reinterpret_cast<char*>(&size), sizeof(size));
+  if (!file || std::memcmp(magic, Magic, sizeof(Magic)) != 0 || fileKey != key) {
+    logWarning() << "Ignoring the invalid easi cache entry" << path;
+    return false;
+  }
+
+  data.resize(size);
+  file.read(data.data(), size);
+  if (!file) {
+    logWarning() << "Ignoring the incomplete easi cache entry" << path;
+    return false;
+  }
+  logInfo(seissol::MPI::mpi.rank()) << "Read the results of" << modelFileName
+                                    << "from the easi cache.";
+  return true;
+}
+
+void EasiCache::store(const void* data, std::size_t size) const {
+  if (!isEnabled()) {
+    return;
+  }
+
+  // Write a temporary file first, such that concurrent readers never see a partial entry
+  const std::string tmpPath = path + ".tmp" + std::to_string(seissol::MPI::mpi.rank()) + "_" +
+                              std::to_string(::getpid());
+  {
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    const std::uint64_t size64 = size;
+    file.write(Magic, sizeof(Magic));
+    file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+    file.write(reinterpret_cast<const char*>(&size64), sizeof(size64));
+    file.write(static_cast<const char*>(data), size);
+    if (!file) {
+      logWarning() << "Could not write the easi cache entry" << path;
+      return;
+    }
+  }
+  std::error_code error;
+  seissol::filesystem::rename(tmpPath, path, error);
+  if (error) {
+    seissol::filesystem::remove(tmpPath, error);
+    logWarning() << "Could not write the easi cache entry" << path;
+  }
+}
+
+} // namespace seissol::initializers
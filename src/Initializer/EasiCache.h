@@ -0,0 +1,63 @@
+#ifndef INITIALIZER_EASICACHE_H_
+#define INITIALIZER_EASICACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace easi {
+struct Query;
+}
+
+namespace seissol::initializers {
+
+/**
+ * Hashes the contents of an easi file and, recursively, of the files it includes, as well as the
+ * paths, sizes and modification times of the ASAGI grids they reference.
+ *
+ * @return False if a model file could not be read
+ */
+bool hashModelFile(std::uint64_t& hash, const std::string& fileName);
+
+/**
+ * On-disk cache for the results of easi queries.
+ *
+ * The cache is enabled by setting the environment variable SEISSOL_EASI_CACHE to a directory.
+ * Every entry is stored in its own file, named by a hash of the contents of the easi file and
+ * the files it includes, the paths, sizes and modification times of the ASAGI grids they
+ * reference, the query points (and hence the mesh partition and the query generator) and a
+ * description of the queried parameters. Reruns with an unchanged setup read the results from
+ * these files and skip easi.
+ */
+class EasiCache {
+  public:
+  static constexpr int Version = 2;
+
+  /**
+   * @param fileName The easi file
+   * @param description Describes the queried parameters and their type
+   * @param query The query, nullptr for entries which do not depend on the mesh
+   */
+  EasiCache(const std::string& fileName,
+            const std::string& description,
+            const easi::Query* query = nullptr);
+
+  [[nodiscard]] bool isEnabled() const { return !path.empty(); }
+
+  /**
+   * @return True if the entry was found, its contents are stored in data
+   */
+  bool load(std::vector<char>& data) const;
+
+  void store(const void* data, std::size_t size) const;
+
+  private:
+  std::string path;
+  std::string modelFileName;
+  std::uint64_t key = 0;
+};
+
+} // namespace seissol::initializers
+
+#endif // INITIALIZER_EASICACHE_H_
@@ -74,6 +74,7 @@ static void closeSeisSol() {
   seissol::SeisSol::main.checkPointManager().close();
   seissol::SeisSol::main.faultWriter().close();
   seissol::SeisSol::main.freeSurfaceWriter().close();
+  seissol::SeisSol::main.receiverWriter().close();
 
   // deallocate memory manager
   seissol::SeisSol::main.deleteMemoryManager();
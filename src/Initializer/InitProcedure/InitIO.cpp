@@ -25,22 +25,22 @@ static void setupCheckpointing() {
 
   // Only R&S friction explicitly stores the state variable, otherwise use the accumulated slip
   // magnitude
-  real* stateVariable{nullptr};
+  realAcc* stateVariable{nullptr};
   if (dynamic_cast<seissol::initializers::LTSRateAndState*>(dynRup)) {
-    stateVariable = reinterpret_cast<real*>(dynRupTree->var(
+    stateVariable = reinterpret_cast<realAcc*>(dynRupTree->var(
         dynamic_cast<seissol::initializers::LTSRateAndState*>(dynRup)->stateVariable));
   } else {
-    stateVariable = reinterpret_cast<real*>(dynRupTree->var(dynRup->accumulatedSlipMagnitude));
+    stateVariable = reinterpret_cast<realAcc*>(dynRupTree->var(dynRup->accumulatedSlipMagnitude));
   }
   // Only with prakash-clifton regularization, we store the fault strength, otherwise use the
   // friction coefficient
-  real* strength{nullptr};
+  realAcc* strength{nullptr};
   if (dynamic_cast<seissol::initializers::LTSLinearSlipWeakeningBimaterial*>(dynRup)) {
-    stateVariable = reinterpret_cast<real*>(dynRupTree->var(
+    strength = reinterpret_cast<realAcc*>(dynRupTree->var(
         dynamic_cast<seissol::initializers::LTSLinearSlipWeakeningBimaterial*>(dynRup)
             ->regularisedStrength));
   } else {
-    stateVariable = reinterpret_cast<real*>(dynRupTree->var(dynRup->mu));
+    strength = reinterpret_cast<realAcc*>(dynRupTree->var(dynRup->mu));
   }
 
   size_t numSides = seissol::SeisSol::main.meshReader().getFault().size();
@@ -49,12 +49,12 @@ static void setupCheckpointing() {
   bool hasCheckpoint = seissol::SeisSol::main.checkPointManager().init(
       reinterpret_cast<real*>(ltsTree->var(lts->dofs)),
       ltsTree->getNumberOfCells(lts->dofs.mask) * tensor::Q::size(),
-      reinterpret_cast<real*>(dynRupTree->var(dynRup->mu)),
-      reinterpret_cast<real*>(dynRupTree->var(dynRup->slipRate1)),
-      reinterpret_cast<real*>(dynRupTree->var(dynRup->slipRate2)),
-      reinterpret_cast<real*>(dynRupTree->var(dynRup->accumulatedSlipMagnitude)),
-      reinterpret_cast<real*>(dynRupTree->var(dynRup->slip1)),
-      reinterpret_cast<real*>(dynRupTree->var(dynRup->slip2)),
+      reinterpret_cast<realAcc*>(dynRupTree->var(dynRup->mu)),
+      reinterpret_cast<realAcc*>(dynRupTree->var(dynRup->slipRate1)),
+      reinterpret_cast<realAcc*>(dynRupTree->var(dynRup->slipRate2)),
+      reinterpret_cast<realAcc*>(dynRupTree->var(dynRup->accumulatedSlipMagnitude)),
+      reinterpret_cast<realAcc*>(dynRupTree->var(dynRup->slip1)),
+      reinterpret_cast<realAcc*>(dynRupTree->var(dynRup->slip2)),
       stateVariable,
       strength,
       numSides,
@@ -159,6 +159,8 @@ static void enableCheckpointing() {
         seissolParams.output.checkpointParameters.backend);
     seissol::SeisSol::main.checkPointManager().setFilename(
         seissolParams.output.checkpointParameters.fileName.c_str());
+    seissol::SeisSol::main.checkPointManager().setNumDeltas(
+        seissolParams.output.checkpointParameters.numDeltas);
   }
 }
 
@@ -11,6 +11,7 @@
 #include "Initializer/tree/Lut.hpp"
 #include "Initializer/tree/LTSSync.hpp"
 #include "Initializer/typedefs.hpp"
+#include "Initializer/WarmStartImage.h"
 
 #include "SeisSol.h"
 #include "Init.hpp"
@@ -72,6 +73,7 @@ void initializeCellMaterial() {
         seissol::initializer::parameters::isModelAnisotropic(),
         seissol::initializer::parameters::isModelPoroelastic(),
         seissolParams.model.useCellHomogenizedMaterial,
+        seissolParams.model.useAdaptiveHomogenization,
         ctvArray);
   };
 
@@ -203,18 +205,32 @@ struct LtsInfo {
   // RUNTIME
 };
 
-static void initializeCellMatrices(LtsInfo& ltsInfo) {
+static void initializeCellMatrices(LtsInfo& ltsInfo, bool warmStart) {
   const auto& seissolParams = seissol::SeisSol::main.getSeisSolParameters();
 
   // \todo Move this to some common initialization place
   auto& meshReader = seissol::SeisSol::main.meshReader();
   auto& memoryManager = seissol::SeisSol::main.getMemoryManager();
 
-  seissol::initializers::initializeCellLocalMatrices(meshReader,
-                                                     memoryManager.getLtsTree(),
-                                                     memoryManager.getLts(),
-                                                     memoryManager.getLtsLut(),
-                                                     ltsInfo.timeStepping);
+  // the cell-local matrices are part of the warm start image, unless they are compressed: then,
+  // the table and the (cheap) geometric parts are computed in every run
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  seissol::initializers::initializeCellMatrixTable(memoryManager.getLtsTree(),
+                                                   memoryManager.getLts(),
+                                                   memoryManager.getCellMatrixTable());
+  const bool initializeLocalMatrices = true;
+#else
+  const bool initializeLocalMatrices = !warmStart;
+#endif
+  if (initializeLocalMatrices) {
+    seissol::initializers::initializeCellLocalMatrices(meshReader,
+                                                       memoryManager.getLtsTree(),
+                                                       memoryManager.getLts(),
+                                                       memoryManager.getLtsLut(),
+                                                       ltsInfo.timeStepping);
+  }
+
+  // always executed, since it sets up the pointers between the LTS and the dynamic rupture tree
 
   seissol::initializers::initializeDynamicRuptureMatrices(meshReader,
                                                           memoryManager.getLtsTree(),
@@ -226,7 +242,7 @@ static void initializeCellMatrices(LtsInfo& ltsInfo) {
                                                           *memoryManager.getGlobalDataOnHost(),
                                                           ltsInfo.timeStepping);
 
-  memoryManager.initFrictionData();
+  memoryManager.initFrictionData(!warmStart);
 
   seissol::initializers::initializeBoundaryMappings(meshReader,
                                                     memoryManager.getEasiBoundaryReader(),
@@ -323,6 +339,49 @@ static void initializeClusteredLts(LtsInfo& ltsInfo) {
                                                         ltsTree->var(lts->cellInformation));
 }
 
+static void setupWarmStartImage(seissol::initializers::WarmStartImage& image) {
+  if (!image.isEnabled()) {
+    return;
+  }
+
+  const auto& seissolParams = seissol::SeisSol::main.getSeisSolParameters();
+  const auto& meshReader = seissol::SeisSol::main.meshReader();
+  auto& memoryManager = seissol::SeisSol::main.getMemoryManager();
+  auto* ltsTree = memoryManager.getLtsTree();
+  auto* lts = memoryManager.getLts();
+  auto* dynRupTree = memoryManager.getDynamicRuptureTree();
+  auto* dynRup = memoryManager.getDynamicRupture();
+
+  // the image is only valid for the same setup, mesh partition and LTS layout
+  image.addFileToKey(seissol::SeisSol::main.parameterFile());
+  image.addModelFileToKey(seissolParams.model.materialFileName);
+  image.addModelFileToKey(memoryManager.getDRParameters()->faultFileName);
+  for (const auto& vertex : meshReader.getVertices()) {
+    image.addToKey(vertex.coords, sizeof(vertex.coords));
+  }
+  for (const auto& element : meshReader.getElements()) {
+    image.addToKey(element.vertices, sizeof(element.vertices));
+    image.addToKey(&element.group, sizeof(element.group));
+    image.addToKey(element.faultTags, sizeof(element.faultTags));
+  }
+  image.addToKey(ltsTree->var(lts->cellInformation),
+                 ltsTree->getVariableSizes()[lts->cellInformation.index]);
+
+  image.addVariable(*ltsTree, lts->material);
+  image.addVariable(*ltsTree, lts->plasticity);
+#ifndef USE_COMPRESSED_CELL_MATRICES
+  image.addVariable(*ltsTree, lts->localIntegration);
+  image.addVariable(*ltsTree, lts->neighboringIntegration);
+#endif
+
+  // all fault variables but the pointers to the time derivatives
+  for (unsigned var = 0; var < dynRupTree->getNumberOfVariables(); ++var) {
+    if (var != dynRup->timeDerivativePlus.index && var != dynRup->timeDerivativeMinus.index) {
+      image.addVariable(*dynRupTree, var);
+    }
+  }
+}
+
 static void initializeMemoryLayout(LtsInfo& ltsInfo) {
   const auto& seissolParams = seissol::SeisSol::main.getSeisSolParameters();
 
@@ -362,10 +421,17 @@ void seissol::initializer::initprocedure::initModel() {
   logInfo(seissol::MPI::mpi.rank()) << "Initialize LTS.";
   initializeClusteredLts(ltsInfo);
 
+  // read the materials, the cell-local matrices and the fault parameters of an earlier run
+  seissol::initializers::WarmStartImage warmStartImage;
+  setupWarmStartImage(warmStartImage);
+  const bool warmStart = warmStartImage.load();
+
   // init cell materials (needs LTS, to place the material in; this part was translated from
   // FORTRAN)
-  logInfo(seissol::MPI::mpi.rank()) << "Initialize cell material parameters.";
-  initializeCellMaterial();
+  if (!warmStart) {
+    logInfo(seissol::MPI::mpi.rank()) << "Initialize cell material parameters.";
+    initializeCellMaterial();
+  }
 
   // init memory layout (needs cell material values to initialize e.g. displacements correctly)
   logInfo(seissol::MPI::mpi.rank()) << "Initialize Memory layout.";
@@ -373,7 +439,11 @@ void seissol::initializer::initprocedure::initModel() {
 
   // init cell matrices
   logInfo(seissol::MPI::mpi.rank()) << "Initialize cell-local matrices.";
-  initializeCellMatrices(ltsInfo);
+  initializeCellMatrices(ltsInfo, warmStart);
+
+  if (!warmStart) {
+    warmStartImage.store();
+  }
 
   watch.pause();
   watch.printTime("Model initialized in:");
@@ -165,9 +165,16 @@ static void readModel(ParameterReader& baseReader, SeisSolParameters& seissolPar
       reader.readWithDefault("gravitationalacceleration", 9.81);
 
   seissolParams.model.plasticity = reader.readWithDefault("plasticity", false);
+#ifdef MULTIPLE_SIMULATIONS
+  if (seissolParams.model.plasticity) {
+    logError() << "Plasticity is not supported with multiple simulations.";
+  }
+#endif
   seissolParams.model.tv = reader.readWithDefault("tv", 0.1);
   seissolParams.model.useCellHomogenizedMaterial =
       reader.readWithDefault("usecellhomogenizedmaterial", true);
+  seissolParams.model.useAdaptiveHomogenization =
+      reader.readWithDefault("adaptivecellhomogenization", false);
   seissolParams.itmParameters.ITMToggle = reader.readWithDefault("itmenable", bool(0));
   if (seissolParams.itmParameters.ITMToggle) {
     seissolParams.itmParameters.ITMStartingTime = reader.readWithDefault("itmstartingtime", 0.0);
@@ -298,6 +305,29 @@ static void readMesh(ParameterReader& baseReader, SeisSolParameters& seissolPara
   seissolParams.timeStepping.vertexWeight.weightFreeSurfaceWithGravity =
       reader.readWithDefault("vertexweightfreesurfacewithgravity", 100);
 
+  // weights written by a previous run (prefix-vertexWeights.yaml) take precedence
+  const auto vertexWeightFile = reader.readWithDefault("vertexweightfile", std::string(""));
+  if (!vertexWeightFile.empty()) {
+    YAML::Node weightNode;
+    try {
+      weightNode = YAML::LoadFile(vertexWeightFile);
+    } catch (std::exception& e) {
+      logError() << "Could not read the vertex weight file" << vertexWeightFile << ":" << e.what();
+    }
+    ParameterReader weightReader(weightNode, false);
+    auto& vertexWeight = seissolParams.timeStepping.vertexWeight;
+    vertexWeight.weightElement =
+        weightReader.readWithDefault("vertexweightelement", vertexWeight.weightElement);
+    vertexWeight.weightDynamicRupture =
+        weightReader.readWithDefault("vertexweightdynamicrupture", vertexWeight.weightDynamicRupture);
+    vertexWeight.weightFreeSurfaceWithGravity = weightReader.readWithDefault(
+        "vertexweightfreesurfacewithgravity", vertexWeight.weightFreeSurfaceWithGravity);
+    logInfo(seissol::MPI::mpi.rank())
+        << "Vertex weights read from" << vertexWeightFile << ": element =" << vertexWeight.weightElement
+        << ", dynamic rupture =" << vertexWeight.weightDynamicRupture
+        << ", free surface with gravity =" << vertexWeight.weightFreeSurfaceWithGravity;
+  }
+
   seissolParams.mesh.showEdgeCutStatistics = reader.readWithDefault("showedgecutstatistics", false);
 
   reader.warnDeprecated({"periodic", "periodic_direction"});
@@ -470,8 +500,10 @@ static void readOutput(ParameterReader& baseReader, SeisSolParameters& seissolPa
   if (seissolParams.output.checkpointParameters.enabled) {
     seissolParams.output.checkpointParameters.fileName =
         reader.readOrFail<std::string>("checkpointfile", "No checkpoint filename given.");
+    seissolParams.output.checkpointParameters.numDeltas =
+        reader.readWithDefault("checkpointdeltas", 0u);
   } else {
-    reader.markUnused("checkpointfile");
+    reader.markUnused("checkpointfile", "checkpointdeltas");
   }
 
   // output: wavefield
@@ -502,6 +534,18 @@ static void readOutput(ParameterReader& baseReader, SeisSolParameters& seissolPa
                                                     OutputRefinement::Refine8,
                                                     OutputRefinement::Refine32});
 
+  seissolParams.output.waveFieldParameters.compression =
+      reader.readWithDefaultStringEnum<WaveFieldCompression>(
+          "wavefieldcompression",
+          "none",
+          {{"none", WaveFieldCompression::None}, {"quantize", WaveFieldCompression::Quantize}});
+  if (seissolParams.output.waveFieldParameters.compression != WaveFieldCompression::None) {
+    seissolParams.output.waveFieldParameters.compressionTolerance = reader.readOrFail<double>(
+        "wavefieldcompressiontolerance", "No tolerance for the wave field compression given.");
+  } else {
+    reader.markUnused("wavefieldcompressiontolerance");
+  }
+
   warnIntervalAndDisable(seissolParams.output.waveFieldParameters.enabled,
                          seissolParams.output.waveFieldParameters.interval,
                          "wavefieldoutput",
@@ -557,6 +601,8 @@ static void readOutput(ParameterReader& baseReader, SeisSolParameters& seissolPa
       reader.readWithDefault("energyterminaloutput", false);
   seissolParams.output.energyParameters.computeVolumeEnergiesEveryOutput =
       reader.readWithDefault("computevolumeenergieseveryoutput", 1);
+  seissolParams.output.energyParameters.fusedAccumulation =
+      reader.readWithDefault("energyfusedaccumulation", false);
 
   warnIntervalAndDisable(seissolParams.output.energyParameters.enabled,
                          seissolParams.output.energyParameters.interval,
@@ -572,6 +618,11 @@ static void readOutput(ParameterReader& baseReader, SeisSolParameters& seissolPa
   seissolParams.output.receiverParameters.fileName =
       reader.readWithDefault("rfilename", std::string(""));
   seissolParams.output.receiverParameters.samplingInterval = reader.readWithDefault("pickdt", 0.0);
+  seissolParams.output.receiverParameters.format =
+      reader.readWithDefaultStringEnum<ReceiverOutputFormat>(
+          "receiveroutputformat",
+          "ascii",
+          {{"ascii", ReceiverOutputFormat::Ascii}, {"binary", ReceiverOutputFormat::Binary}});
 
   warnIntervalAndDisable(seissolParams.output.receiverParameters.enabled,
                          seissolParams.output.receiverParameters.interval,
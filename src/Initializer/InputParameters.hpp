@@ -57,6 +57,7 @@ struct ModelParameters {
   double tv;
   bool plasticity;
   bool useCellHomogenizedMaterial;
+  bool useAdaptiveHomogenization;
   double freqCentral;
   double freqRatio;
   std::string materialFileName;
@@ -102,6 +103,8 @@ enum class OutputFormat : int { None = 10, Xdmf = 6 };
 
 enum class OutputRefinement : int { NoRefine = 0, Refine4 = 1, Refine8 = 2, Refine32 = 3 };
 
+enum class WaveFieldCompression : int { None, Quantize };
+
 struct VertexWeightParameters {
   int weightElement;
   int weightDynamicRupture;
@@ -137,12 +140,15 @@ struct OutputBounds {
   }
 };
 
+enum class ReceiverOutputFormat : int { Ascii, Binary };
+
 struct ReceiverOutputParameters {
   bool enabled;
   double interval;
   bool computeRotation;
   std::string fileName;
   double samplingInterval;
+  ReceiverOutputFormat format;
 };
 
 struct FreeSurfaceOutputParameters {
@@ -156,6 +162,7 @@ struct EnergyOutputParameters {
   double interval;
   bool terminalOutput;
   int computeVolumeEnergiesEveryOutput;
+  bool fusedAccumulation;
 };
 
 struct CheckpointParameters {
@@ -163,12 +170,15 @@ struct CheckpointParameters {
   double interval;
   std::string fileName;
   seissol::checkpoint::Backend backend;
+  unsigned numDeltas;
 };
 
 struct WaveFieldOutputParameters {
   bool enabled;
   double interval;
   OutputRefinement refinement;
+  WaveFieldCompression compression;
+  double compressionTolerance;
   OutputBounds bounds;
   std::array<bool, NUMBER_OF_QUANTITIES> outputMask;
   std::array<bool, 7> plasticityMask;
@@ -71,6 +71,15 @@
 #include "MemoryAllocator.h"
 #include <Parallel/MPI.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <utils/env.h>
 #include <utils/logger.h>
 
 #ifdef ACL_DEVICE
@@ -169,11 +178,103 @@ void seissol::memory::printMemoryAlignment( std::vector< std::vector<unsigned lo
   }
 }
 
+const seissol::memory::PagePlacement& seissol::memory::PagePlacement::get() {
+  static const PagePlacement placement = [] {
+    PagePlacement result;
+    result.numaAware = utils::Env::get<bool>("SEISSOL_NUMA_AWARE_ALLOCATION", false);
+    const std::string hugePages = utils::Env::get<const char*>("SEISSOL_HUGE_PAGES", "none");
+    if (hugePages == "2M") {
+      result.hugePages = HugePages::Transparent;
+    } else if (hugePages == "1G") {
+      result.hugePages = HugePages::Explicit1G;
+    } else if (hugePages != "none") {
+      logError() << "Unknown value for SEISSOL_HUGE_PAGES:" << hugePages
+                 << "(valid values: none, 2M, 1G)";
+    }
+    return result;
+  }();
+  return placement;
+}
+
+namespace {
+constexpr size_t TransparentHugePageSize = 2ul << 20;
+constexpr size_t ExplicitHugePageSize = 1ul << 30;
+
+size_t roundUp(size_t size, size_t multiple) {
+  return (size + multiple - 1) / multiple * multiple;
+}
+} // namespace
+
+void* seissol::memory::allocatePages(size_t i_size, size_t i_alignment, HugePages i_hugePages) {
+  const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+  if (i_hugePages == HugePages::Explicit1G) {
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    void* pointer = mmap(nullptr, roundUp(i_size, ExplicitHugePageSize), PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (30 << MAP_HUGE_SHIFT), -1, 0);
+    if (pointer != MAP_FAILED) {
+      return pointer;
+    }
+#endif
+    logError() << "Could not map" << i_size << "bytes with 1 GB pages."
+               << "Reserve enough 1 GB pages or use SEISSOL_HUGE_PAGES=2M.";
+  }
+
+  // Map with extra space and unmap the unaligned head and the tail
+  const size_t alignment = std::max(pageSize, i_hugePages == HugePages::Transparent
+                                                  ? std::max(i_alignment, TransparentHugePageSize)
+                                                  : i_alignment);
+  const size_t size = roundUp(i_size, pageSize);
+  void* mapping = mmap(nullptr, size + alignment, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED) {
+    logError() << "The mmap failed (bytes: " << i_size << ", alignment: " << i_alignment << ").";
+  }
+  const auto begin = reinterpret_cast<std::uintptr_t>(mapping);
+  const auto alignedBegin = roundUp(begin, alignment);
+  if (alignedBegin > begin) {
+    munmap(mapping, alignedBegin - begin);
+  }
+  if (alignment > alignedBegin - begin) {
+    munmap(reinterpret_cast<void*>(alignedBegin + size), alignment - (alignedBegin - begin));
+  }
+  void* pointer = reinterpret_cast<void*>(alignedBegin);
+
+#ifdef MADV_HUGEPAGE
+  if (i_hugePages != HugePages::None) {
+    madvise(pointer, size, MADV_HUGEPAGE);
+  }
+#endif
+  return pointer;
+}
+
+void seissol::memory::freePages(void* i_pointer, size_t i_size, HugePages i_hugePages) {
+  const size_t pageSize = i_hugePages == HugePages::Explicit1G
+                              ? ExplicitHugePageSize
+                              : static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  munmap(i_pointer, roundUp(i_size, pageSize));
+}
+
+void seissol::memory::touchInterleaved(void* i_pointer, size_t i_size) {
+  const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t numPages = (i_size + pageSize - 1) / pageSize;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+  for (size_t page = 0; page < numPages; ++page) {
+    const size_t offset = page * pageSize;
+    memset(static_cast<char*>(i_pointer) + offset, 0, std::min(pageSize, i_size - offset));
+  }
+}
+
 seissol::memory::ManagedAllocator::~ManagedAllocator()
 {
   for (AddressVector::const_iterator it = m_dataMemoryAddresses.begin(); it != m_dataMemoryAddresses.end(); ++it) {
     seissol::memory::free(it->second, it->first);
   }
+  for (const auto& mapping : m_pageMappings) {
+    seissol::memory::freePages(mapping.address, mapping.size, mapping.hugePages);
+  }
 
   // reset memory vectors
   m_dataMemoryAddresses.clear();
@@ -185,3 +286,20 @@ void* seissol::memory::ManagedAllocator::allocateMemory( size_t i_size, size_t i
   m_dataMemoryAddresses.push_back( Address(i_memkind, l_ptrBuffer) );
   return l_ptrBuffer;
 }
+
+void* seissol::memory::ManagedAllocator::allocatePlacedMemory( size_t i_size, size_t i_alignment, enum Memkind i_memkind )
+{
+  const auto& placement = PagePlacement::get();
+  if (!placement.isEnabled() || i_memkind != Standard ||
+      i_size < static_cast<size_t>(sysconf(_SC_PAGESIZE))) {
+    return allocateMemory(i_size, i_alignment, i_memkind);
+  }
+
+  // 1 GB pages are only worth their padding for large arrays
+  const HugePages hugePages = (placement.hugePages == HugePages::Explicit1G && i_size < ExplicitHugePageSize)
+                                ? HugePages::Transparent
+                                : placement.hugePages;
+  void* l_ptrBuffer = seissol::memory::allocatePages(i_size, i_alignment, hugePages);
+  m_pageMappings.push_back({l_ptrBuffer, i_size, hugePages});
+  return l_ptrBuffer;
+}
@@ -93,6 +93,40 @@ namespace seissol {
     void* allocate(size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard);
     void free(void* i_pointer, enum Memkind i_memkind = Standard);   
 
+    enum class HugePages { None, Transparent, Explicit1G };
+
+    /**
+     * Placement of the large host arrays of the LTS trees.
+     *
+     * With numaAware (SEISSOL_NUMA_AWARE_ALLOCATION=1), the arrays are mapped directly from the
+     * OS, such that the first touch (which follows the static OpenMP schedule of the cell loops)
+     * places every page on the NUMA domain of the thread which computes it. Ghost layers, which are
+     * read by all threads, are interleaved page by page over all threads instead.
+     * hugePages (SEISSOL_HUGE_PAGES=2M or 1G) backs the arrays with huge pages.
+     **/
+    struct PagePlacement {
+      bool numaAware = false;
+      HugePages hugePages = HugePages::None;
+
+      bool isEnabled() const { return numaAware || hugePages != HugePages::None; }
+
+      /**
+       * @return The placement given by the environment (read once).
+       **/
+      static const PagePlacement& get();
+    };
+
+    /**
+     * Maps at least i_size bytes of untouched memory with the given alignment.
+     **/
+    void* allocatePages(size_t i_size, size_t i_alignment, HugePages i_hugePages);
+    void freePages(void* i_pointer, size_t i_size, HugePages i_hugePages);
+
+    /**
+     * Touches the memory page by page, distributing the pages round-robin over all threads.
+     **/
+    void touchInterleaved(void* i_pointer, size_t i_size);
+
     /**
      * Prints the memory alignment of in terms of relative start and ends in bytes.
      *
@@ -114,6 +148,15 @@ class seissol::memory::ManagedAllocator {
     //! holds all memory addresses, which point to data arrays and have been returned by mallocs calling functions of the memory allocator.
     AddressVector m_dataMemoryAddresses;
 
+    struct PageMapping {
+      void* address;
+      size_t size;
+      HugePages hugePages;
+    };
+
+    //! holds all memory mappings returned by allocatePages.
+    std::vector<PageMapping> m_pageMappings;
+
   public:  
     ManagedAllocator() {}
     
@@ -130,6 +173,12 @@ class seissol::memory::ManagedAllocator {
      * @return pointer, which points to the aligned memory of the given size.
      **/
     void* allocateMemory( size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard );
+
+    /**
+     * Allocates host memory according to PagePlacement::get(); falls back to allocateMemory
+     * if the placement is disabled, for small chunks and for other memkinds than Standard.
+     **/
+    void* allocatePlacedMemory( size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard );
 };
 
 #endif
@@ -93,6 +93,10 @@ void seissol::initializers::MemoryManager::initialize()
 {
   // initialize global matrices
   GlobalDataInitializerOnHost::init(m_globalDataOnHost, m_memoryAllocator, MEMKIND_GLOBAL);
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  // filled by initializeCellMatrixTable
+  m_globalDataOnHost.cellMatrixTable = &m_cellMatrixTable;
+#endif
   if constexpr (seissol::isDeviceOn()) {
     // the serial order for initialization is needed for some (older) driver versions on some GPUs
     bool serialize = false;
@@ -868,10 +872,12 @@ void seissol::initializers::MemoryManager::initFaultOutputManager(const std::str
 }
 
 
-void seissol::initializers::MemoryManager::initFrictionData() {
+void seissol::initializers::MemoryManager::initFrictionData(bool evaluateFaultModel) {
   if (m_dynRupParameters->isDynamicRuptureEnabled) {
 
-    m_DRInitializer->initializeFault(m_dynRup.get(), &m_dynRupTree);
+    if (evaluateFaultModel) {
+      m_DRInitializer->initializeFault(m_dynRup.get(), &m_dynRupTree);
+    }
 
 #ifdef ACL_DEVICE
     if (auto* impl = dynamic_cast<dr::friction_law::gpu::FrictionSolverInterface*>(m_FrictionLaw.get())) {
@@ -162,6 +162,11 @@ class seissol::initializers::MemoryManager {
     GlobalData            m_globalDataOnHost;
     GlobalData            m_globalDataOnDevice;
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+    //! material-dependent parts of the cell-local matrices, referenced by m_globalDataOnHost
+    CellMatrixTable       m_cellMatrixTable;
+#endif
+
     //! Memory organization tree
     LTSTree               m_ltsTree;
     LTS                   m_lts;
@@ -280,6 +285,15 @@ class seissol::initializers::MemoryManager {
       return &m_globalDataOnDevice;
     }
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+    /**
+     * Gets the table of the compressed cell-local matrices.
+     **/
+    CellMatrixTable& getCellMatrixTable() {
+      return m_cellMatrixTable;
+    }
+#endif
+
     /**
      * Gets the global data on both host and device.
     **/
@@ -398,7 +412,10 @@ class seissol::initializers::MemoryManager {
 
   void initializeFrictionLaw();
   void initFaultOutputManager(const std::string& backupTimeStamp);
-  void initFrictionData();
+  /**
+   * @param evaluateFaultModel False if the fault parameters are already set, e.g. by a warm start
+   **/
+  void initFrictionData(bool evaluateFaultModel = true);
 };
 
 
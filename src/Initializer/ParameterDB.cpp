@@ -47,9 +47,14 @@
 #include "PUML/PUML.h"
 #include "PUML/Downward.h"
 #endif
+#include <cassert>
 #include <cmath>
+#include <cstring>
+#include <sstream>
 #include <algorithm>
+#include <typeinfo>
 #include "ParameterDB.h"
+#include "EasiCache.h"
 
 #include "SeisSol.h"
 #include "easi/YAMLParser.h"
@@ -144,8 +149,8 @@ easi::Query seissol::initializers::ElementBarycentreGenerator::generate() const
 }
 
 seissol::initializers::ElementAverageGenerator::ElementAverageGenerator(
-    const CellToVertexArray& cellToVertex)
-    : m_cellToVertex(cellToVertex) {
+    const CellToVertexArray& cellToVertex, bool adaptive)
+    : m_cellToVertex(cellToVertex), m_adaptive(adaptive) {
   double quadraturePoints[NUM_QUADPOINTS][3];
   double quadratureWeights[NUM_QUADPOINTS];
   seissol::quadrature::TetrahedronQuadrature(
@@ -181,6 +186,70 @@ easi::Query seissol::initializers::ElementAverageGenerator::generate() const {
   return query;
 }
 
+easi::Query seissol::initializers::ElementAverageGenerator::generateForElements(
+    const std::vector<unsigned>& elements) const {
+  easi::Query query(elements.size() * NUM_QUADPOINTS, 3);
+
+#pragma omp parallel for schedule(static)
+  for (unsigned k = 0; k < elements.size(); ++k) {
+    const unsigned elem = elements[k];
+    auto vertices = m_cellToVertex.elementCoordinates(elem);
+    for (unsigned i = 0; i < NUM_QUADPOINTS; ++i) {
+      Eigen::Vector3d transformed = seissol::transformations::tetrahedronReferenceToGlobal(
+          vertices[0], vertices[1], vertices[2], vertices[3], m_quadraturePoints[i].data());
+      query.x(k * NUM_QUADPOINTS + i, 0) = transformed(0);
+      query.x(k * NUM_QUADPOINTS + i, 1) = transformed(1);
+      query.x(k * NUM_QUADPOINTS + i, 2) = transformed(2);
+      query.group(k * NUM_QUADPOINTS + i) = m_cellToVertex.elementGroups(elem);
+    }
+  }
+
+  return query;
+}
+
+std::array<Eigen::Vector3d, seissol::initializers::ElementAverageGenerator::NumProbes>
+    seissol::initializers::ElementAverageGenerator::probePoints(
+        const std::array<Eigen::Vector3d, 4>& vertices) {
+  const Eigen::Vector3d barycenter = (vertices[0] + vertices[1] + vertices[2] + vertices[3]) * 0.25;
+  std::array<Eigen::Vector3d, NumProbes> points;
+  unsigned i = 0;
+  for (unsigned a = 0; a < 4; ++a) {
+    points[i++] = vertices[a];
+  }
+  for (unsigned a = 0; a < 4; ++a) {
+    for (unsigned b = a + 1; b < 4; ++b) {
+      points[i++] = 0.5 * (vertices[a] + vertices[b]);
+    }
+  }
+  for (unsigned a = 0; a < 4; ++a) {
+    // the centroid of the face opposite to vertex a
+    points[i++] = (4.0 * barycenter - vertices[a]) / 3.0;
+  }
+  assert(i == NumProbes - 1);
+  for (unsigned k = 0; k < NumProbes - 1; ++k) {
+    points[k] = barycenter + ProbeScaling * (points[k] - barycenter);
+  }
+  points[NumProbes - 1] = barycenter;
+  return points;
+}
+
+easi::Query seissol::initializers::ElementAverageGenerator::generateProbes() const {
+  easi::Query query(m_cellToVertex.size * NumProbes, 3);
+
+#pragma omp parallel for schedule(static)
+  for (unsigned elem = 0; elem < m_cellToVertex.size; ++elem) {
+    const auto points = probePoints(m_cellToVertex.elementCoordinates(elem));
+    for (unsigned i = 0; i < NumProbes; ++i) {
+      query.x(elem * NumProbes + i, 0) = points[i](0);
+      query.x(elem * NumProbes + i, 1) = points[i](1);
+      query.x(elem * NumProbes + i, 2) = points[i](2);
+      query.group(elem * NumProbes + i) = m_cellToVertex.elementGroups(elem);
+    }
+  }
+
+  return query;
+}
+
 easi::Query seissol::initializers::FaultBarycentreGenerator::generate() const {
   std::vector<Fault> const& fault = m_meshReader.getFault();
   std::vector<Element> const& elements = m_meshReader.getElements();
@@ -261,16 +330,16 @@ namespace initializers {
 using namespace seissol::model;
 
 template <>
-void MaterialParameterDB<ElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<ElasticMaterial>& adapter) {
+template <typename Adapter>
+void MaterialParameterDB<ElasticMaterial>::addBindingPoints(Adapter& adapter) {
   adapter.addBindingPoint("rho", &ElasticMaterial::rho);
   adapter.addBindingPoint("mu", &ElasticMaterial::mu);
   adapter.addBindingPoint("lambda", &ElasticMaterial::lambda);
 }
 
 template <>
-void MaterialParameterDB<ViscoElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<ViscoElasticMaterial>& adapter) {
+template <typename Adapter>
+void MaterialParameterDB<ViscoElasticMaterial>::addBindingPoints(Adapter& adapter) {
   adapter.addBindingPoint("rho", &ViscoElasticMaterial::rho);
   adapter.addBindingPoint("mu", &ViscoElasticMaterial::mu);
   adapter.addBindingPoint("lambda", &ViscoElasticMaterial::lambda);
@@ -279,8 +348,8 @@ void MaterialParameterDB<ViscoElasticMaterial>::addBindingPoints(
 }
 
 template <>
-void MaterialParameterDB<PoroElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<PoroElasticMaterial>& adapter) {
+template <typename Adapter>
+void MaterialParameterDB<PoroElasticMaterial>::addBindingPoints(Adapter& adapter) {
   adapter.addBindingPoint("bulk_solid", &PoroElasticMaterial::bulkSolid);
   adapter.addBindingPoint("rho", &PoroElasticMaterial::rho);
   adapter.addBindingPoint("lambda", &PoroElasticMaterial::lambda);
@@ -294,8 +363,8 @@ void MaterialParameterDB<PoroElasticMaterial>::addBindingPoints(
 }
 
 template <>
-void MaterialParameterDB<Plasticity>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<Plasticity>& adapter) {
+template <typename Adapter>
+void MaterialParameterDB<Plasticity>::addBindingPoints(Adapter& adapter) {
   adapter.addBindingPoint("bulkFriction", &Plasticity::bulkFriction);
   adapter.addBindingPoint("plastCo", &Plasticity::plastCo);
   adapter.addBindingPoint("s_xx", &Plasticity::s_xx);
@@ -307,8 +376,8 @@ void MaterialParameterDB<Plasticity>::addBindingPoints(
 }
 
 template <>
-void MaterialParameterDB<AnisotropicMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<AnisotropicMaterial>& adapter) {
+template <typename Adapter>
+void MaterialParameterDB<AnisotropicMaterial>::addBindingPoints(Adapter& adapter) {
   adapter.addBindingPoint("rho", &AnisotropicMaterial::rho);
   adapter.addBindingPoint("c11", &AnisotropicMaterial::c11);
   adapter.addBindingPoint("c12", &AnisotropicMaterial::c12);
@@ -333,13 +402,103 @@ void MaterialParameterDB<AnisotropicMaterial>::addBindingPoints(
   adapter.addBindingPoint("c66", &AnisotropicMaterial::c66);
 }
 
+namespace {
+/**
+ * Collects the material parameters which are read from easi
+ */
+template <class T>
+struct MaterialMembers {
+  MaterialMembers() { MaterialParameterDB<T>().addBindingPoints(*this); }
+
+  void addBindingPoint(std::string const& name, double T::*member) {
+    names.push_back(name);
+    members.push_back(member);
+  }
+
+  bool equal(T const& a, T const& b) const {
+    return std::all_of(
+        members.begin(), members.end(), [&](auto member) { return a.*member == b.*member; });
+  }
+
+  std::vector<std::string> names;
+  std::vector<double T::*> members;
+};
+
+/**
+ * Stores the parameters of the first numMaterials materials in the easi cache
+ */
+template <class T>
+class MaterialCache {
+  public:
+  MaterialCache(std::string const& fileName,
+                easi::Query const& query,
+                QueryGenerator const* const queryGen) {
+    std::string description = std::string("material/") + typeid(*queryGen).name();
+    for (const auto& name : materialMembers.names) {
+      description += "/" + name;
+    }
+    cache = std::make_unique<EasiCache>(fileName, description, &query);
+  }
+
+  bool load(std::vector<T>& materials, unsigned numMaterials) const {
+    const auto& members = materialMembers.members;
+    std::vector<char> data;
+    if (!cache->load(data) || data.size() != numMaterials * members.size() * sizeof(double)) {
+      return false;
+    }
+    std::vector<double> values(numMaterials * members.size());
+    std::memcpy(values.data(), data.data(), data.size());
+#pragma omp parallel for schedule(static)
+    for (unsigned i = 0; i < numMaterials; ++i) {
+      for (std::size_t m = 0; m < members.size(); ++m) {
+        materials[i].*members[m] = values[i * members.size() + m];
+      }
+    }
+    return true;
+  }
+
+  void store(std::vector<T> const& materials, unsigned numMaterials) const {
+    if (!cache->isEnabled()) {
+      return;
+    }
+    const auto& members = materialMembers.members;
+    std::vector<double> values(numMaterials * members.size());
+#pragma omp parallel for schedule(static)
+    for (unsigned i = 0; i < numMaterials; ++i) {
+      for (std::size_t m = 0; m < members.size(); ++m) {
+        values[i * members.size() + m] = materials[i].*members[m];
+      }
+    }
+    cache->store(values.data(), values.size() * sizeof(double));
+  }
+
+  private:
+  MaterialMembers<T> materialMembers;
+  std::unique_ptr<EasiCache> cache;
+};
+} // namespace
+
 template <class T>
 void MaterialParameterDB<T>::evaluateModel(std::string const& fileName,
                                            QueryGenerator const* const queryGen) {
-  easi::Component* model = loadEasiModel(fileName);
+  if (const auto* gen = dynamic_cast<const ElementAverageGenerator*>(queryGen);
+      gen != nullptr && gen->isAdaptive()) {
+    evaluateModelAdaptively(fileName, *gen);
+    return;
+  }
+
   easi::Query query = queryGen->generate();
   const unsigned numPoints = query.numPoints();
+  const unsigned numMaterials = dynamic_cast<const ElementAverageGenerator*>(queryGen) != nullptr
+                                    ? numPoints / NUM_QUADPOINTS
+                                    : numPoints;
 
+  MaterialCache<T> cache(fileName, query, queryGen);
+  if (cache.load(*m_materials, numMaterials)) {
+    return;
+  }
+
+  easi::Component* model = loadEasiModel(fileName);
   std::vector<T> materialsFromQuery(numPoints);
   easi::ArrayOfStructsAdapter<T> adapter(materialsFromQuery.data());
   MaterialParameterDB<T>().addBindingPoints(adapter);
@@ -364,6 +523,74 @@ void MaterialParameterDB<T>::evaluateModel(std::string const& fileName,
     }
   }
   delete model;
+
+  cache.store(*m_materials, numMaterials);
+}
+
+// Adaptive homogenization: The material is sampled at NumProbes points per element first. Only the
+// elements with differing samples (i.e. elements crossing a material interface or lying in a
+// gradient) are sampled at all quadrature points and averaged. All other elements take the
+// barycentre sample, which equals the average of a constant material.
+template <class T>
+void MaterialParameterDB<T>::evaluateModelAdaptively(std::string const& fileName,
+                                                     ElementAverageGenerator const& queryGen) {
+  constexpr unsigned NumProbes = ElementAverageGenerator::NumProbes;
+  easi::Query probeQuery = queryGen.generateProbes();
+  const unsigned numElems = probeQuery.numPoints() / NumProbes;
+
+  MaterialCache<T> cache(fileName, probeQuery, &queryGen);
+  if (cache.load(*m_materials, numElems)) {
+    return;
+  }
+
+  easi::Component* model = loadEasiModel(fileName);
+  std::vector<T> probes(probeQuery.numPoints());
+  {
+    easi::ArrayOfStructsAdapter<T> adapter(probes.data());
+    MaterialParameterDB<T>().addBindingPoints(adapter);
+    model->evaluate(probeQuery, adapter);
+  }
+
+  const MaterialMembers<T> materialMembers;
+  std::vector<char> isHeterogeneous(numElems);
+#pragma omp parallel for schedule(static)
+  for (unsigned elementIdx = 0; elementIdx < numElems; ++elementIdx) {
+    const T& barycentre = probes[elementIdx * NumProbes + NumProbes - 1];
+    isHeterogeneous[elementIdx] = 0;
+    for (unsigned i = 0; i < NumProbes - 1; ++i) {
+      if (!materialMembers.equal(probes[elementIdx * NumProbes + i], barycentre)) {
+        isHeterogeneous[elementIdx] = 1;
+      }
+    }
+    m_materials->at(elementIdx) = T(barycentre);
+  }
+
+  std::vector<unsigned> heterogeneousElements;
+  for (unsigned elementIdx = 0; elementIdx < numElems; ++elementIdx) {
+    if (isHeterogeneous[elementIdx] != 0) {
+      heterogeneousElements.push_back(elementIdx);
+    }
+  }
+  logInfo(MPI::mpi.rank()) << "Adaptive material averaging:" << heterogeneousElements.size()
+                           << "of" << numElems << "elements are sampled at all quadrature points.";
+
+  if (!heterogeneousElements.empty()) {
+    easi::Query query = queryGen.generateForElements(heterogeneousElements);
+    std::vector<T> materialsFromQuery(query.numPoints());
+    easi::ArrayOfStructsAdapter<T> adapter(materialsFromQuery.data());
+    MaterialParameterDB<T>().addBindingPoints(adapter);
+    model->evaluate(query, adapter);
+
+    std::array<double, NUM_QUADPOINTS> quadratureWeights{queryGen.getQuadratureWeights()};
+#pragma omp parallel for
+    for (unsigned k = 0; k < heterogeneousElements.size(); ++k) {
+      m_materials->at(heterogeneousElements[k]) =
+          this->computeAveragedMaterial(k, quadratureWeights, materialsFromQuery);
+    }
+  }
+  delete model;
+
+  cache.store(*m_materials, numElems);
 }
 
 // Computes the averaged material, assuming that materialsFromQuery, stores
@@ -480,8 +707,13 @@ ViscoElasticMaterial MaterialParameterDB<ViscoElasticMaterial>::computeAveragedM
 template <>
 void MaterialParameterDB<AnisotropicMaterial>::evaluateModel(std::string const& fileName,
                                                              QueryGenerator const* const queryGen) {
-  easi::Component* model = loadEasiModel(fileName);
   easi::Query query = queryGen->generate();
+  MaterialCache<AnisotropicMaterial> cache(fileName, query, queryGen);
+  if (cache.load(*m_materials, query.numPoints())) {
+    return;
+  }
+
+  easi::Component* model = loadEasiModel(fileName);
   auto suppliedParameters = model->suppliedParameters();
   // TODO(Sebastian): inhomogeneous materials, where in some parts only mu and lambda are given
   //                  and in other parts the full elastic tensor is given
@@ -505,13 +737,41 @@ void MaterialParameterDB<AnisotropicMaterial>::evaluateModel(std::string const&
     model->evaluate(query, arrayOfStructsAdapter);
   }
   delete model;
+
+  cache.store(*m_materials, query.numPoints());
 }
 
 void FaultParameterDB::evaluateModel(std::string const& fileName,
                                      QueryGenerator const* const queryGen) {
-  easi::Component* model = loadEasiModel(fileName);
   easi::Query query = queryGen->generate();
+  const unsigned numPoints = query.numPoints();
+
+  // the cache stores the parameters one after the other, ordered by name
+  std::vector<std::string> names;
+  std::string description = "fault/" + std::to_string(sizeof(real));
+  for (const auto& kv : m_parameters) {
+    names.push_back(kv.first);
+  }
+  std::sort(names.begin(), names.end());
+  for (const auto& name : names) {
+    description += "/" + name;
+  }
+  EasiCache cache(fileName, description, &query);
+
+  std::vector<char> data;
+  if (cache.load(data) && data.size() == names.size() * numPoints * sizeof(real)) {
+    for (std::size_t p = 0; p < names.size(); ++p) {
+      const auto [memory, stride] = m_parameters[names[p]];
+      for (unsigned i = 0; i < numPoints; ++i) {
+        std::memcpy(memory + i * stride,
+                    data.data() + (p * numPoints + i) * sizeof(real),
+                    sizeof(real));
+      }
+    }
+    return;
+  }
 
+  easi::Component* model = loadEasiModel(fileName);
   easi::ArraysAdapter<real> adapter;
   for (auto& kv : m_parameters) {
     adapter.addBindingPoint(kv.first, kv.second.first, kv.second.second);
@@ -519,6 +779,17 @@ void FaultParameterDB::evaluateModel(std::string const& fileName,
   model->evaluate(query, adapter);
 
   delete model;
+
+  if (cache.isEnabled()) {
+    std::vector<real> values(names.size() * numPoints);
+    for (std::size_t p = 0; p < names.size(); ++p) {
+      const auto [memory, stride] = m_parameters[names[p]];
+      for (unsigned i = 0; i < numPoints; ++i) {
+        values[p * numPoints + i] = memory[i * stride];
+      }
+    }
+    cache.store(values.data(), values.size() * sizeof(real));
+  }
 }
 
 } // namespace initializers
@@ -529,9 +800,29 @@ std::set<std::string>
   if (fileName.length() == 0) {
     return std::set<std::string>();
   }
+
+  // the cache stores the names separated by newlines
+  EasiCache cache(fileName, "faultProvides");
+  std::vector<char> data;
+  if (cache.load(data)) {
+    std::set<std::string> supplied;
+    std::istringstream stream(std::string(data.begin(), data.end()));
+    std::string name;
+    while (std::getline(stream, name)) {
+      supplied.insert(name);
+    }
+    return supplied;
+  }
+
   easi::Component* model = loadEasiModel(fileName);
   std::set<std::string> supplied = model->suppliedParameters();
   delete model;
+
+  std::string names;
+  for (const auto& name : supplied) {
+    names += name + "\n";
+  }
+  cache.store(names.data(), names.size());
   return supplied;
 }
 
@@ -638,6 +929,7 @@ QueryGenerator* getBestQueryGenerator(bool anelasticity,
                                       bool anisotropy,
                                       bool poroelasticity,
                                       bool useCellHomogenizedMaterial,
+                                      bool useAdaptiveHomogenization,
                                       const CellToVertexArray& cellToVertex) {
   QueryGenerator* queryGen = nullptr;
   if (!useCellHomogenizedMaterial) {
@@ -660,7 +952,7 @@ QueryGenerator* getBestQueryGenerator(bool anelasticity,
              "material properties sampled from the element barycenters instead.";
       queryGen = new ElementBarycentreGenerator(cellToVertex);
     } else {
-      queryGen = new ElementAverageGenerator(cellToVertex);
+      queryGen = new ElementAverageGenerator(cellToVertex, useAdaptiveHomogenization);
     }
   }
   return queryGen;
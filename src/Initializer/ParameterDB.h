@@ -48,6 +48,7 @@
 #include <string>
 #include <unordered_map>
 #include <set>
+#include <vector>
 
 #include "Geometry/MeshReader.h"
 #include "Kernels/precision.hpp"
@@ -114,6 +115,7 @@ QueryGenerator* getBestQueryGenerator(bool anelasticity,
                                       bool anisotropy,
                                       bool poroelasticity,
                                       bool useCellHomogenizedMaterial,
+                                      bool useAdaptiveHomogenization,
                                       const CellToVertexArray& cellToVertex);
 } // namespace initializers
 } // namespace seissol
@@ -135,17 +137,41 @@ class seissol::initializers::ElementBarycentreGenerator
   CellToVertexArray m_cellToVertex;
 };
 
+/**
+ * Generates NUM_QUADPOINTS quadrature points per element for the material averaging.
+ *
+ * In the adaptive mode, the material is first probed at NumProbes points per element (close to
+ * the vertices, the edge midpoints and the face centroids, and the barycentre), and only the
+ * elements with differing samples are averaged with the quadrature points, see
+ * MaterialParameterDB::evaluateModel. A material layer which is thinner than the probe spacing
+ * and passes between all probes is not detected.
+ */
 class seissol::initializers::ElementAverageGenerator
     : public seissol::initializers::QueryGenerator {
   public:
-  explicit ElementAverageGenerator(const CellToVertexArray& cellToVertex);
+  static constexpr unsigned NumProbes = 15;
+  /** The probe points are moved towards the barycentre by this factor, such that the samples of
+   * elements which only touch a material interface are unambiguous. */
+  static constexpr double ProbeScaling = 0.99;
+
+  explicit ElementAverageGenerator(const CellToVertexArray& cellToVertex, bool adaptive = false);
   virtual easi::Query generate() const;
+  /** Generates the quadrature points of the given elements only */
+  easi::Query generateForElements(const std::vector<unsigned>& elements) const;
+  /** Generates the NumProbes probe points per element, the last one is the barycentre */
+  easi::Query generateProbes() const;
+  /** The probe points of a tetrahedron: 4 vertices, 6 edge midpoints, 4 face centroids and the
+   * barycentre (last) */
+  static std::array<Eigen::Vector3d, NumProbes>
+      probePoints(const std::array<Eigen::Vector3d, 4>& vertices);
   const std::array<double, NUM_QUADPOINTS>& getQuadratureWeights() const {
     return m_quadratureWeights;
   };
+  bool isAdaptive() const { return m_adaptive; }
 
   private:
   CellToVertexArray m_cellToVertex;
+  bool m_adaptive;
   std::array<double, NUM_QUADPOINTS> m_quadratureWeights;
   std::array<std::array<double, 3>, NUM_QUADPOINTS> m_quadraturePoints;
 };
@@ -188,9 +214,17 @@ class seissol::initializers::MaterialParameterDB : seissol::initializers::Parame
                             std::vector<T> const& materialsFromQuery);
   void evaluateModel(std::string const& fileName, QueryGenerator const* const queryGen) override;
   void setMaterialVector(std::vector<T>* materials) { m_materials = materials; }
-  void addBindingPoints(easi::ArrayOfStructsAdapter<T>& adapter){};
+  /**
+   * Adds the parameters of the material to the adapter, which is an easi::ArrayOfStructsAdapter<T>
+   * or any other type with the member function addBindingPoint(name, double T::*member).
+   */
+  template <typename Adapter>
+  void addBindingPoints(Adapter& adapter){};
 
   private:
+  void evaluateModelAdaptively(std::string const& fileName,
+                               ElementAverageGenerator const& queryGen);
+
   std::vector<T>* m_materials;
 };
 
@@ -69,11 +69,173 @@
  **/
 
 #include "PointMapper.h"
+#include <algorithm>
+#include <array>
 #include <cstring>
+#include <limits>
 #include <Initializer/MemoryAllocator.h>
 #include <utils/logger.h>
 #include <Parallel/MPI.h>
 
+namespace {
+/**
+ * Bounding volume hierarchy over the tetrahedra of a mesh.
+ * Nodes are split at the median element centre along the longest axis,
+ * hence the tree is balanced and a point query visits O(log(#elements)) nodes
+ * as long as the point lies in only few element bounding boxes.
+ */
+class ElementBVH {
+  public:
+  ElementBVH(std::vector<Vertex> const& vertices, std::vector<Element> const& elements)
+      : m_boxes(elements.size()), m_order(elements.size()) {
+    std::vector<std::array<double, 3>> centres(elements.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (unsigned elem = 0; elem < elements.size(); ++elem) {
+      BoundingBox& box = m_boxes[elem];
+      for (unsigned dim = 0; dim < 3; ++dim) {
+        box.min[dim] = std::numeric_limits<double>::max();
+        box.max[dim] = std::numeric_limits<double>::lowest();
+      }
+      for (unsigned vertex = 0; vertex < 4; ++vertex) {
+        box.extend(vertices[elements[elem].vertices[vertex]].coords);
+      }
+      // Slightly enlarge the box such that points which are on the boundary
+      // of the element (up to round-off) are not discarded by the box test.
+      for (unsigned dim = 0; dim < 3; ++dim) {
+        const double eps = 1.0e-10 * (box.max[dim] - box.min[dim]) +
+                           std::numeric_limits<double>::min();
+        box.min[dim] -= eps;
+        box.max[dim] += eps;
+        centres[elem][dim] = 0.5 * (box.min[dim] + box.max[dim]);
+      }
+      m_order[elem] = elem;
+    }
+
+    if (!elements.empty()) {
+      m_nodes.reserve(2 * (elements.size() / LeafSize + 1));
+      build(0, elements.size(), centres);
+    }
+  }
+
+  /**
+   * Calls func(elem) for every element whose bounding box contains point.
+   */
+  template <typename F>
+  void forEachCandidate(double const point[3], F&& func) const {
+    if (m_nodes.empty()) {
+      return;
+    }
+    // The tree is balanced, hence its depth is bounded by log2(2^32)
+    std::array<unsigned, 64> stack;
+    unsigned stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+      Node const& node = m_nodes[stack[--stackSize]];
+      if (!node.box.contains(point)) {
+        continue;
+      }
+      if (node.isLeaf()) {
+        for (unsigned i = node.begin; i < node.end; ++i) {
+          if (m_boxes[m_order[i]].contains(point)) {
+            func(m_order[i]);
+          }
+        }
+      } else {
+        stack[stackSize++] = node.left;
+        stack[stackSize++] = node.right;
+      }
+    }
+  }
+
+  private:
+  static constexpr unsigned LeafSize = 8;
+
+  struct BoundingBox {
+    double min[3];
+    double max[3];
+
+    void extend(double const p[3]) {
+      for (unsigned dim = 0; dim < 3; ++dim) {
+        min[dim] = std::min(min[dim], p[dim]);
+        max[dim] = std::max(max[dim], p[dim]);
+      }
+    }
+
+    void extend(BoundingBox const& other) {
+      extend(other.min);
+      extend(other.max);
+    }
+
+    bool contains(double const p[3]) const {
+      return p[0] >= min[0] && p[0] <= max[0] && p[1] >= min[1] && p[1] <= max[1] &&
+             p[2] >= min[2] && p[2] <= max[2];
+    }
+  };
+
+  struct Node {
+    BoundingBox box;
+    unsigned begin;
+    unsigned end;
+    unsigned left;
+    unsigned right;
+
+    bool isLeaf() const { return left == 0; }
+  };
+
+  /** Builds the subtree for m_order[begin, end) and returns the index of its root. */
+  unsigned build(unsigned begin, unsigned end, std::vector<std::array<double, 3>> const& centres) {
+    const unsigned nodeId = m_nodes.size();
+    m_nodes.emplace_back();
+
+    BoundingBox box = m_boxes[m_order[begin]];
+    BoundingBox centreBox = {{centres[m_order[begin]][0],
+                              centres[m_order[begin]][1],
+                              centres[m_order[begin]][2]},
+                             {centres[m_order[begin]][0],
+                              centres[m_order[begin]][1],
+                              centres[m_order[begin]][2]}};
+    for (unsigned i = begin + 1; i < end; ++i) {
+      box.extend(m_boxes[m_order[i]]);
+      centreBox.extend(centres[m_order[i]].data());
+    }
+
+    unsigned left = 0;
+    unsigned right = 0;
+    if (end - begin > LeafSize) {
+      unsigned axis = 0;
+      for (unsigned dim = 1; dim < 3; ++dim) {
+        if (centreBox.max[dim] - centreBox.min[dim] > centreBox.max[axis] - centreBox.min[axis]) {
+          axis = dim;
+        }
+      }
+      const unsigned mid = begin + (end - begin) / 2;
+      std::nth_element(m_order.begin() + begin,
+                       m_order.begin() + mid,
+                       m_order.begin() + end,
+                       [&](unsigned a, unsigned b) { return centres[a][axis] < centres[b][axis]; });
+      left = build(begin, mid, centres);
+      right = build(mid, end, centres);
+    }
+
+    // m_nodes may have been reallocated by the recursive calls
+    Node& node = m_nodes[nodeId];
+    node.box = box;
+    node.begin = begin;
+    node.end = end;
+    node.left = left;
+    node.right = right;
+    return nodeId;
+  }
+
+  std::vector<BoundingBox> m_boxes;
+  std::vector<unsigned> m_order;
+  std::vector<Node> m_nodes;
+};
+} // namespace
+
 void seissol::initializers::findMeshIds(Eigen::Vector3d const* points,
                                         seissol::geometry::MeshReader const& mesh,
                                         unsigned numPoints,
@@ -97,6 +259,9 @@ void seissol::initializers::findMeshIds(Eigen::Vector3d const* points,
   memset(contained, 0, numPoints * sizeof(short));
 
   double (*planeEquations)[4][4] = static_cast<double(*)[4][4]>(seissol::memory::allocate(elements.size() * sizeof(double[4][4]), ALIGNMENT));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
   for (unsigned elem = 0; elem < elements.size(); ++elem) {
     for (int face = 0; face < 4; ++face) {
       VrtxCoords n, p;
@@ -110,74 +275,39 @@ void seissol::initializers::findMeshIds(Eigen::Vector3d const* points,
     }
   }
 
-  double (*points1)[4] = new double[numPoints][4];
-  for (unsigned point = 0; point < numPoints; ++point) {
-    points1[point][0] = points[point](0);
-    points1[point][1] = points[point](1);
-    points1[point][2] = points[point](2);
-    points1[point][3] = 1.0;
-  }
+  const ElementBVH bvh(vertices, elements);
 
-/// @TODO Could use the code generator for the following
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(dynamic, 64)
 #endif
-  for (unsigned elem = 0; elem < elements.size(); ++elem) {
-#if 0 //defined(__AVX__)
-    __m256d zero = _mm256_setzero_pd();
-      __m256d planeDims[4];
-      for (unsigned i = 0; i < 4; ++i) {
-        planeDims[i] = _mm256_load_pd(&planeEquations[elem][i][0]);
-      }
-#endif
-    for (unsigned point = 0; point < numPoints; ++point) {
-      int l_notInside = 0;
-#if 0 //defined(__AVX__)
-      // Not working because <0 => 0 should actually be  <=0 => 0
-      /*__m256d result = _mm256_setzero_pd();
-      for (unsigned dim = 0; dim < 4; ++dim) {
-        result = _mm256_add_pd(result, _mm256_mul_pd(planeDims[dim], _mm256_broadcast_sd(&points1[point][dim])) );
-      }
-      // >0 => (2^64)-1 ; <0 = 0
-      __m256d inside4 = _mm256_cmp_pd(result, zero, _CMP_GE_OQ);
-      l_notInside = _mm256_movemask_pd(inside4);*/
-#else
+  for (unsigned point = 0; point < numPoints; ++point) {
+    const double p[4] = {points[point](0), points[point](1), points[point](2), 1.0};
+    bvh.forEachCandidate(p, [&](unsigned elem) {
       double result[4] = { 0.0, 0.0, 0.0, 0.0 };
       for (unsigned dim = 0; dim < 4; ++dim) {
         for (unsigned face = 0; face < 4; ++face) {
-          result[face] += planeEquations[elem][dim][face] * points1[point][dim];
+          result[face] += planeEquations[elem][dim][face] * p[dim];
         }
       }
+      int l_notInside = 0;
       for (unsigned face = 0; face < 4; ++face) {
         l_notInside += (result[face] > 0.0) ? 1 : 0;
       }
-#endif
       if (l_notInside == 0) {
-#ifdef _OPENMP
-#pragma omp critical
-        {
-#endif
-          /* It might actually happen that a point is found in two tetrahedrons
-           * if it lies on the boundary. In this case we arbitrarily assign
-           * it to the one with the higher meshId.
-           * @todo Check if this is a problem with the numerical scheme. */
-          /*if (contained[point] != 0) {
-             logError() << "point with id " << point << " was already found in a different element!";
-          }*/
-          auto localId = static_cast<unsigned>(elements[elem].localId);
-          if ((contained[point] == 0) || (meshIds[point] > localId)) {
-            contained[point] = 1;
-            meshIds[point] = elements[elem].localId;
-          }
-#ifdef _OPENMP
+        /* It might actually happen that a point is found in two tetrahedrons
+         * if it lies on the boundary. In this case we arbitrarily assign
+         * it to the one with the lower meshId.
+         * @todo Check if this is a problem with the numerical scheme. */
+        auto localId = static_cast<unsigned>(elements[elem].localId);
+        if ((contained[point] == 0) || (meshIds[point] > localId)) {
+          contained[point] = 1;
+          meshIds[point] = elements[elem].localId;
         }
-#endif
       }
-    }
+    });
   }
 
   seissol::memory::free(planeEquations);
-  delete[] points1;
 }
 
 #ifdef USE_MPI
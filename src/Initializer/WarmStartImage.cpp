@@ -0,0 +1,197 @@
+#include "WarmStartImage.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Common/filesystem.h"
+#include "Common/fnv1a.h"
+#include "Initializer/EasiCache.h"
+#include "Parallel/MPI.h"
+#include "utils/env.h"
+#include "utils/logger.h"
+
+namespace {
+
+constexpr char Magic[8] = {'S', 'S', 'W', 'A', 'R', 'M', '\0', '\0'};
+
+struct Header {
+  char magic[sizeof(Magic)];
+  std::uint64_t version;
+  std::uint64_t key;
+  std::uint64_t size;
+};
+
+/** Copies in chunks, such that large regions are copied by all threads */
+void parallelCopy(void* dest, const void* src, std::size_t size) {
+  constexpr std::size_t ChunkSize = 1 << 22;
+  const std::size_t numChunks = (size + ChunkSize - 1) / ChunkSize;
+#pragma omp parallel for schedule(static)
+  for (std::size_t chunk = 0; chunk < numChunks; ++chunk) {
+    const std::size_t offset = chunk * ChunkSize;
+    std::memcpy(static_cast<char*>(dest) + offset,
+                static_cast<const char*>(src) + offset,
+                std::min(ChunkSize, size - offset));
+  }
+}
+
+} // namespace
+
+namespace seissol::initializers {
+
+WarmStartImage::WarmStartImage()
+    : directory(utils::Env::get<const char*>("SEISSOL_WARMSTART_IMAGE", "")),
+      key(fnv1aUpdate(Fnv1aBasis, &Version, sizeof(Version))) {
+  const int size = MPI::mpi.size();
+  key = fnv1aUpdate(key, &size, sizeof(size));
+#ifdef ACL_DEVICE
+  if (isEnabled()) {
+    // parts of the cell-local data only live in device memory
+    logWarning(MPI::mpi.rank()) << "The warm start image is not supported on GPUs; ignoring"
+                                << "SEISSOL_WARMSTART_IMAGE.";
+    directory.clear();
+  }
+#endif // ACL_DEVICE
+}
+
+void WarmStartImage::addFileToKey(const std::string& fileName) {
+  if (!isEnabled() || fileName.empty()) {
+    return;
+  }
+  std::ifstream file(fileName, std::ios::binary);
+  const std::string contents{std::istreambuf_iterator<char>(file),
+                             std::istreambuf_iterator<char>()};
+  key = fnv1aUpdate(key, fileName.data(), fileName.size());
+  key = fnv1aUpdate(key, contents.data(), contents.size());
+}
+
+void WarmStartImage::addModelFileToKey(const std::string& fileName) {
+  if (!isEnabled() || fileName.empty()) {
+    return;
+  }
+  key = fnv1aUpdate(key, fileName.data(), fileName.size());
+  // easi reports a missing or invalid file
+  hashModelFile(key, fileName);
+}
+
+void WarmStartImage::addToKey(const void* data, std::size_t size) {
+  if (!isEnabled()) {
+    return;
+  }
+  key = fnv1aUpdate(key, &size, sizeof(size));
+  key = fnv1aUpdate(key, data, size);
+}
+
+void WarmStartImage::addVariable(LTSTree& tree, unsigned index) {
+  regions.push_back({tree.var(index), tree.getVariableSizes()[index]});
+}
+
+std::string WarmStartImage::path() const {
+  return directory + "/" + std::to_string(MPI::mpi.rank()) + "-of-" +
+         std::to_string(MPI::mpi.size());
+}
+
+std::uint64_t WarmStartImage::finalKey() const {
+  std::uint64_t hash = key;
+  for (const auto& region : regions) {
+    hash = fnv1aUpdate(hash, &region.size, sizeof(region.size));
+  }
+  return hash;
+}
+
+bool WarmStartImage::load() {
+  if (!isEnabled()) {
+    return false;
+  }
+
+  std::size_t size = 0;
+  for (const auto& region : regions) {
+    size += region.size;
+  }
+
+  int found = 0;
+  void* mapping = MAP_FAILED;
+  const int fd = ::open(path().c_str(), O_RDONLY);
+  struct stat fileStat {};
+  if (fd >= 0 && ::fstat(fd, &fileStat) == 0 &&
+      static_cast<std::size_t>(fileStat.st_size) == sizeof(Header) + size) {
+    mapping = ::mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  if (mapping != MAP_FAILED) {
+    Header header{};
+    std::memcpy(&header, mapping, sizeof(Header));
+    found = std::memcmp(header.magic, Magic, sizeof(Magic)) == 0 && header.version == Version &&
+            header.key == finalKey() && header.size == size;
+  }
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &found, 1, MPI_INT, MPI_MIN, MPI::mpi.comm());
+#endif // USE_MPI
+
+  if (found != 0) {
+    ::madvise(mapping, fileStat.st_size, MADV_SEQUENTIAL);
+    const char* data = static_cast<const char*>(mapping) + sizeof(Header);
+    for (const auto& region : regions) {
+      parallelCopy(region.data, data, region.size);
+      data += region.size;
+    }
+    logInfo(MPI::mpi.rank()) << "Read the initialized cell and fault data from the warm start image"
+                             << directory;
+  }
+
+  if (mapping != MAP_FAILED) {
+    ::munmap(mapping, fileStat.st_size);
+  }
+  if (fd >= 0) {
+    ::close(fd);
+  }
+  return found != 0;
+}
+
+void WarmStartImage::store() const {
+  if (!isEnabled()) {
+    return;
+  }
+
+  std::error_code error;
+  seissol::filesystem::create_directories(directory, error);
+
+  Header header{};
+  std::memcpy(header.magic, Magic, sizeof(Magic));
+  header.version = Version;
+  header.key = finalKey();
+  for (const auto& region : regions) {
+    header.size += region.size;
+  }
+
+  // Write a temporary file first, such that a concurrent run never reads a partial image
+  const std::string fileName = path();
+  const std::string tmpFileName = fileName + ".tmp" + std::to_string(::getpid());
+  {
+    std::ofstream file(tmpFileName, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& region : regions) {
+      file.write(static_cast<const char*>(region.data), region.size);
+    }
+    if (!file) {
+      logWarning() << "Could not write the warm start image" << fileName;
+      return;
+    }
+  }
+  seissol::filesystem::rename(tmpFileName, fileName, error);
+  if (error) {
+    seissol::filesystem::remove(tmpFileName, error);
+    logWarning() << "Could not write the warm start image" << fileName;
+    return;
+  }
+  logInfo(MPI::mpi.rank()) << "Stored the initialized cell and fault data in the warm start image"
+                           << directory;
+}
+
+} // namespace seissol::initializers
@@ -0,0 +1,87 @@
+#ifndef INITIALIZER_WARMSTARTIMAGE_H_
+#define INITIALIZER_WARMSTARTIMAGE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Initializer/tree/LTSTree.hpp"
+
+namespace seissol::initializers {
+
+/**
+ * Per-rank image of the initialized cell-local and fault data.
+ *
+ * The image is enabled by setting the environment variable SEISSOL_WARMSTART_IMAGE to a
+ * directory. After the initialization, the variables registered with addVariable are written to
+ * <directory>/<rank>-of-<size>. A later run whose key matches (same mesh partition, parameter
+ * and model files including their includes and grids, build configuration and rank count) reads
+ * the variables from the image instead of evaluating the easi models and computing the
+ * cell-local matrices.
+ *
+ * The image only contains plain data. Pointer variables are rebuilt by the memory layout in every
+ * run, since the addresses of the trees differ between runs.
+ */
+class WarmStartImage {
+  public:
+  static constexpr std::uint64_t Version = 1;
+
+  WarmStartImage();
+
+  [[nodiscard]] bool isEnabled() const { return !directory.empty(); }
+
+  /**
+   * Adds the contents of a file to the key. Empty file names are ignored.
+   */
+  void addFileToKey(const std::string& fileName);
+
+  /**
+   * Adds an easi file to the key, including the files it includes and the ASAGI grids they
+   * reference (cf. hashModelFile). Empty file names are ignored.
+   */
+  void addModelFileToKey(const std::string& fileName);
+
+  /**
+   * Adds data, e.g. the mesh coordinates, to the key.
+   */
+  void addToKey(const void* data, std::size_t size);
+
+  /**
+   * Adds the tree-wide memory of a variable to the image.
+   */
+  void addVariable(LTSTree& tree, unsigned index);
+
+  template <typename T>
+  void addVariable(LTSTree& tree, const Variable<T>& handle) {
+    addVariable(tree, handle.index);
+  }
+
+  /**
+   * Reads all variables from the image. Collective; either all ranks read their image or none.
+   *
+   * @return True if the variables were read
+   */
+  bool load();
+
+  void store() const;
+
+  private:
+  struct Region {
+    void* data;
+    std::size_t size;
+  };
+
+  [[nodiscard]] std::string path() const;
+
+  /** Finalizes the key with the number and sizes of the regions */
+  [[nodiscard]] std::uint64_t finalKey() const;
+
+  std::string directory;
+  std::uint64_t key;
+  std::vector<Region> regions;
+};
+
+} // namespace seissol::initializers
+
+#endif // INITIALIZER_WARMSTARTIMAGE_H_
@@ -48,6 +48,7 @@ GlobalTimestep computeTimesteps(double cfl,
       seissol::initializer::parameters::isModelAnisotropic(),
       seissol::initializer::parameters::isModelPoroelastic(),
       seissolParams.model.useCellHomogenizedMaterial,
+      seissolParams.model.useAdaptiveHomogenization,
       cellToVertex);
   std::vector<Material> materials(cellToVertex.size);
   seissol::initializers::MaterialParameterDB<Material> parameterDB;
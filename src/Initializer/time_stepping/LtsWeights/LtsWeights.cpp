@@ -39,6 +39,9 @@
  *
  **/
 #include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <cmath>
+#include <sstream>
 #include <Kernels/precision.hpp>
 #include <Initializer/typedefs.hpp>
 
@@ -49,6 +52,7 @@
 
 #include <Initializer/time_stepping/GlobalTimestep.hpp>
 #include <Parallel/MPI.h>
+#include <Common/fnv1a.h>
 
 #include <generated_code/init.h>
 
@@ -169,7 +173,21 @@ void LtsWeights::computeWeights(PUML::TETPUML const& mesh, double maximumAllowed
     }
 
     ComputeWiggleFactorResult wiggleFactorResult{};
-    if (autoMergeBaseline == AutoMergeCostBaseline::BestWiggleFactor) {
+    auto& tuningDatabase = SeisSol::main.tuningDatabase();
+    std::optional<WiggleFactorTuningKeys> tuningKeys;
+    std::optional<double> cachedWiggleFactor;
+    std::optional<double> cachedMaxClusterId;
+    if (tuningDatabase.isEnabled()) {
+      tuningKeys = computeWiggleFactorTuningKeys();
+      cachedWiggleFactor = tuningDatabase.get(tuningKeys->wiggleFactor);
+      cachedMaxClusterId = tuningDatabase.get(tuningKeys->maxClusterId);
+    }
+    if (cachedWiggleFactor && cachedMaxClusterId) {
+      // The database is identical on all ranks, hence all ranks skip the search
+      logInfo(rank) << "Using the wiggle factor" << *cachedWiggleFactor << "from the tuning database.";
+      wiggleFactorResult.wiggleFactor = *cachedWiggleFactor;
+      wiggleFactorResult.maxClusterId = static_cast<int>(*cachedMaxClusterId);
+    } else if (autoMergeBaseline == AutoMergeCostBaseline::BestWiggleFactor) {
       // First compute wiggle factor without merging as baseline cost
       logInfo(rank) << "Using best wiggle factor as baseline cost for auto merging.";
       logInfo(rank) << "1. Compute best wiggle factor without merging clusters";
@@ -182,6 +200,11 @@ void LtsWeights::computeWeights(PUML::TETPUML const& mesh, double maximumAllowed
       assert(autoMergeBaseline == AutoMergeCostBaseline::MaxWiggleFactor);
       wiggleFactorResult = computeBestWiggleFactor(std::nullopt, ltsParameters->isAutoMergeUsed());
     }
+    if (rank == 0 && tuningKeys && (!cachedWiggleFactor || !cachedMaxClusterId)) {
+      // The result is global, one rank suffices
+      tuningDatabase.set(tuningKeys->wiggleFactor, wiggleFactorResult.wiggleFactor);
+      tuningDatabase.set(tuningKeys->maxClusterId, wiggleFactorResult.maxClusterId);
+    }
 
     wiggleFactor = wiggleFactorResult.wiggleFactor;
     if (ltsParameters->isAutoMergeUsed()) {
@@ -217,6 +240,53 @@ void LtsWeights::computeWeights(PUML::TETPUML const& mesh, double maximumAllowed
   logInfo(rank) << "Computing LTS weights. Done. " << utils::nospace << '('
                                     << finalNumberOfReductions << " reductions.)";
 }
+LtsWeights::WiggleFactorTuningKeys LtsWeights::computeWiggleFactorTuningKeys() const {
+  // The result of the search depends on the distribution of the cell costs over the time steps.
+  // Hence, we fingerprint the problem by a global histogram of the cell costs over log2(dt / dt_min)
+  // with a resolution of 1/64 and the number of cells in the last entry.
+  constexpr int BinsPerOctave = 64;
+  constexpr int NumberOfBins = 16 * BinsPerOctave;
+  std::vector<unsigned long long> histogram(NumberOfBins + 1, 0);
+  for (std::size_t cell = 0; cell < m_cellCosts.size(); ++cell) {
+    const double octaves = std::log2(m_details.cellTimeStepWidths[cell] / m_details.globalMinTimeStep);
+    const int bin = std::clamp(static_cast<int>(octaves * BinsPerOctave), 0, NumberOfBins - 1);
+    histogram[bin] += m_cellCosts[cell];
+  }
+  histogram[NumberOfBins] = m_cellCosts.size();
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE,
+                histogram.data(),
+                histogram.size(),
+                MPI_UNSIGNED_LONG_LONG,
+                MPI_SUM,
+                MPI::mpi.comm());
+#endif
+  const auto numberOfCells = histogram[NumberOfBins];
+
+  std::ostringstream parameters;
+  parameters.precision(std::numeric_limits<double>::max_digits10);
+  parameters << m_details.globalMinTimeStep << ' ' << m_details.globalMaxTimeStep << ' ' << m_rate
+             << ' ' << ltsParameters->isWiggleFactorUsed() << ' '
+             << ltsParameters->getWiggleFactorMinimum() << ' '
+             << ltsParameters->getWiggleFactorStepsize() << ' '
+             << ltsParameters->getWiggleFactorEnforceMaximumDifference() << ' '
+             << ltsParameters->getMaxNumberOfClusters() << ' '
+             << ltsParameters->isAutoMergeUsed() << ' '
+             << ltsParameters->getAllowedPerformanceLossRatioAutoMerge() << ' '
+             << static_cast<int>(ltsParameters->getAutoMergeCostBaseline());
+  const auto parametersString = parameters.str();
+  auto parametersHash = seissol::fnv1aUpdate(
+      seissol::Fnv1aBasis, parametersString.data(), parametersString.size());
+  parametersHash = seissol::fnv1aUpdate(
+      parametersHash, histogram.data(), histogram.size() * sizeof(histogram[0]));
+
+  std::ostringstream hash;
+  hash << std::hex << parametersHash;
+  return WiggleFactorTuningKeys{
+      TuningDatabase::makeKey("ltsWiggleFactor", hash.str(), numberOfCells),
+      TuningDatabase::makeKey("ltsMaxClusterId", hash.str(), numberOfCells)};
+}
+
 LtsWeights::ComputeWiggleFactorResult
     LtsWeights::computeBestWiggleFactor(std::optional<double> baselineCost, bool isAutoMergeUsed) {
   const auto rank = seissol::MPI::mpi.rank();
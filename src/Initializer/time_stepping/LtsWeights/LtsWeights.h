@@ -141,6 +141,12 @@ protected:
   };
   ComputeWiggleFactorResult computeBestWiggleFactor(std::optional<double> baselineCost,
                                                     bool isAutoMergeUsed);
+  // keys of the wiggle factor search results in the tuning database; collective
+  struct WiggleFactorTuningKeys {
+    std::string wiggleFactor;
+    std::string maxClusterId;
+  };
+  WiggleFactorTuningKeys computeWiggleFactorTuningKeys() const;
 };
 }
 
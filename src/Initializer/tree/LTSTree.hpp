@@ -103,6 +103,11 @@ public:
     return static_cast<T*>(m_vars[handle.index]);
   }
 
+  void* var(unsigned index) {
+    assert(m_vars != NULL);
+    return m_vars[index];
+  }
+
   MemoryInfo const& info(unsigned index) const {
     return varInfo[index];
   }
@@ -150,7 +155,7 @@ public:
     }
 
     for (unsigned var = 0; var < varInfo.size(); ++var) {
-      m_vars[var] = m_allocator.allocateMemory(variableSizes[var], varInfo[var].alignment, varInfo[var].memkind);
+      m_vars[var] = m_allocator.allocatePlacedMemory(variableSizes[var], varInfo[var].alignment, varInfo[var].memkind);
     }
     
     std::fill(variableSizes.begin(), variableSizes.end(), 0);
@@ -169,7 +174,7 @@ public:
     }
     
     for (unsigned bucket = 0; bucket < bucketInfo.size(); ++bucket) {
-      m_buckets[bucket] = m_allocator.allocateMemory(bucketSizes[bucket], bucketInfo[bucket].alignment, bucketInfo[bucket].memkind);
+      m_buckets[bucket] = m_allocator.allocatePlacedMemory(bucketSizes[bucket], bucketInfo[bucket].alignment, bucketInfo[bucket].memkind);
     }
     
     std::fill(bucketSizes.begin(), bucketSizes.end(), 0);
@@ -177,6 +182,14 @@ public:
       it->setMemoryRegionsForBuckets(m_buckets, bucketSizes);
       it->addBucketSizes(bucketSizes);
     }
+
+    // Interleave the ghost layers, which are read by all threads. The buckets of the other layers
+    // are touched later with the schedule of the cell loops (see kernels::touchBuffersDerivatives).
+    if (seissol::memory::PagePlacement::get().numaAware) {
+      for (LTSTree::leaf_iterator it = beginLeaf(LayerMask(Copy) | LayerMask(Interior)); it != endLeaf(); ++it) {
+        it->touchBucketsInterleaved(bucketInfo);
+      }
+    }
   }
 
 #ifdef ACL_DEVICE
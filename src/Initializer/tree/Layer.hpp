@@ -248,11 +248,18 @@ public:
 #endif
   
   void touchVariables(std::vector<MemoryInfo> const& vars) {
+    // Ghost layers are read by all threads
+    const bool interleave = m_layerType == Ghost && seissol::memory::PagePlacement::get().numaAware;
+
     for (unsigned var = 0; var < vars.size(); ++var) {
 
       // NOTE: we don't touch device global memory because it is in a different address space
       // we will do deep-copy from the host to a device later on
       if (!isMasked(vars[var].mask) && (vars[var].memkind != seissol::memory::DeviceGlobalMemory)) {
+        if (interleave) {
+          seissol::memory::touchInterleaved(m_vars[var], m_numberOfCells * vars[var].bytes);
+          continue;
+        }
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
@@ -263,6 +270,14 @@ public:
     }
   }
 
+  void touchBucketsInterleaved(std::vector<MemoryInfo> const& buckets) {
+    for (unsigned bucket = 0; bucket < buckets.size(); ++bucket) {
+      if (buckets[bucket].memkind == seissol::memory::Standard && m_bucketSizes[bucket] > 0) {
+        seissol::memory::touchInterleaved(m_buckets[bucket], m_bucketSizes[bucket]);
+      }
+    }
+  }
+
 #ifdef ACL_DEVICE
   template<typename InnerKeyType>
   auto& getConditionalTable() {
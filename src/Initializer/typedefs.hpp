@@ -205,6 +205,29 @@ struct MeshStructure {
 
 };
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+// material-dependent parts of the cell-local matrices, stored once per material and per pair of
+// materials and face type; referenced by index from LocalIntegrationData
+struct CellMatrixTable {
+  struct Jacobians {
+    // transposed Jacobians in the sparsity pattern of the star matrices
+    real AT[seissol::tensor::star::size(0)];
+    real BT[seissol::tensor::star::size(1)];
+    real CT[seissol::tensor::star::size(2)];
+  };
+
+  struct FluxSolvers {
+    // flux solvers of the element local and the neighboring contribution in the face-aligned
+    // frame, i.e. without the rotations T and Tinv and the scaling with |S|/|J|
+    real local[seissol::tensor::faceAlignedFluxSolver::size()];
+    real neighbor[seissol::tensor::faceAlignedFluxSolver::size()];
+  };
+
+  std::vector<Jacobians> jacobians;
+  std::vector<FluxSolvers> fluxSolvers;
+};
+#endif
+
 struct GlobalData {  
   /**
    * Addresses of the global change of basis matrices (multiplied by the inverse diagonal mass matrix):
@@ -326,6 +349,11 @@ struct GlobalData {
   // A vector of ones. Note: It is only relevant for GPU computing.
   // It allows us to allocate this vector only once in the GPU memory
   real* replicateStresses{nullptr};
+
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  //! Material-dependent parts of the cell-local matrices (not owned)
+  CellMatrixTable const* cellMatrixTable{nullptr};
+#endif
 };
 
 struct CompoundGlobalData {
@@ -335,11 +363,28 @@ struct CompoundGlobalData {
 
 // data for the cell local integration
 struct LocalIntegrationData {
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  // gradients of xi, eta and zeta; the star matrices are assembled from these and the Jacobians
+  real gradients[3][3];
+
+  // normal, tangent1 and tangent2 of the faces, which define the rotations of the flux solvers
+  real faceFrames[4][3][3];
+
+  // scaling of the flux solvers with -2 |S| / (6 |J|)
+  real fluxScales[4];
+
+  // index of the Jacobians of the cell material in CellMatrixTable::jacobians
+  unsigned jacobianId;
+
+  // indices of the flux solvers of the faces in CellMatrixTable::fluxSolvers
+  unsigned fluxSolverIds[4];
+#else
   // star matrices
   real starMatrices[3][seissol::tensor::star::size(0)];
 
   // flux solver for element local contribution
   real nApNm1[4][seissol::tensor::AplusT::size()];
+#endif
 
   // equation-specific data
   //TODO(Lukas/Sebastian):
@@ -357,8 +402,11 @@ struct LocalIntegrationData {
 
 // data for the neighboring boundary integration
 struct NeighboringIntegrationData {
+#ifndef USE_COMPRESSED_CELL_MATRICES
   // flux solver for the contribution of the neighboring elements
+  // (with compressed cell matrices, it is computed from the data in LocalIntegrationData)
   real nAmNm1[4][seissol::tensor::AminusT::size()];
+#endif
 
   // equation-specific data
   //TODO(Lukas/Sebastian):
@@ -421,8 +469,8 @@ struct DRGodunovData {
 
 struct DREnergyOutput {
   real slip[seissol::tensor::slipInterpolated::size()];
-  real accumulatedSlip[seissol::dr::misc::numPaddedPoints];
-  real frictionalEnergy[seissol::dr::misc::numPaddedPoints];
+  realAcc accumulatedSlip[seissol::dr::misc::numPaddedPoints];
+  realAcc frictionalEnergy[seissol::dr::misc::numPaddedPoints];
 };
 
 struct CellDRMapping {
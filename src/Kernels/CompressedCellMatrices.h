@@ -0,0 +1,105 @@
+#ifndef KERNELS_COMPRESSEDCELLMATRICES_H_
+#define KERNELS_COMPRESSEDCELLMATRICES_H_
+
+#ifdef USE_COMPRESSED_CELL_MATRICES
+
+#include <cassert>
+
+#include "Initializer/typedefs.hpp"
+#include "Model/common.hpp"
+#include "generated_code/init.h"
+#include "generated_code/kernel.h"
+
+namespace seissol::kernels {
+
+/**
+ * Assembles the star matrices of a cell from the Jacobians of its material and the gradients of
+ * the reference coordinates (cf. setStarMatrix in CellLocalMatrices.cpp).
+ */
+inline void assembleStarMatrices(const CellMatrixTable& table,
+                                 const LocalIntegrationData& localIntegration,
+                                 real (*starMatrices)[tensor::star::size(0)]) {
+  assert(localIntegration.jacobianId < table.jacobians.size());
+  const auto& jacobians = table.jacobians[localIntegration.jacobianId];
+  for (unsigned dim = 0; dim < 3; ++dim) {
+    const real* gradient = localIntegration.gradients[dim];
+    real* star = starMatrices[dim];
+    for (unsigned idx = 0; idx < tensor::star::size(0); ++idx) {
+      star[idx] = gradient[0] * jacobians.AT[idx];
+    }
+    for (unsigned idx = 0; idx < tensor::star::size(1); ++idx) {
+      star[idx] += gradient[1] * jacobians.BT[idx];
+    }
+    for (unsigned idx = 0; idx < tensor::star::size(2); ++idx) {
+      star[idx] += gradient[2] * jacobians.CT[idx];
+    }
+  }
+}
+
+inline void computeFaceRotation(const LocalIntegrationData& localIntegration,
+                                unsigned face,
+                                real* TData,
+                                real* TinvData) {
+  const auto& frame = localIntegration.faceFrames[face];
+  const VrtxCoords normal = {frame[0][0], frame[0][1], frame[0][2]};
+  const VrtxCoords tangent1 = {frame[1][0], frame[1][1], frame[1][2]};
+  const VrtxCoords tangent2 = {frame[2][0], frame[2][1], frame[2][2]};
+  auto T = init::T::view::create(TData);
+  auto Tinv = init::Tinv::view::create(TinvData);
+  seissol::model::getFaceRotationMatrix(normal, tangent1, tangent2, T, Tinv);
+}
+
+/**
+ * Computes the flux solver of the element local contribution of a face (nApNm1 in the
+ * uncompressed layout).
+ */
+inline void computeLocalFluxSolver(const CellMatrixTable& table,
+                                   const LocalIntegrationData& localIntegration,
+                                   unsigned face,
+                                   real* AplusT) {
+  assert(localIntegration.fluxSolverIds[face] < table.fluxSolvers.size());
+  real TData[tensor::T::size()];
+  real TinvData[tensor::Tinv::size()];
+  computeFaceRotation(localIntegration, face, TData, TinvData);
+
+  kernel::rotateFluxSolverLocal krnl;
+  krnl.fluxScale = localIntegration.fluxScales[face];
+  krnl.faceAlignedFluxSolver = table.fluxSolvers[localIntegration.fluxSolverIds[face]].local;
+  krnl.T = TData;
+  krnl.Tinv = TinvData;
+  krnl.AplusT = AplusT;
+  krnl.execute();
+}
+
+/**
+ * Computes the flux solver of the neighboring contribution of a face (nAmNm1 in the
+ * uncompressed layout).
+ */
+inline void computeNeighborFluxSolver(const CellMatrixTable& table,
+                                      const LocalIntegrationData& localIntegration,
+                                      FaceType faceType,
+                                      unsigned face,
+                                      real* AminusT) {
+  assert(localIntegration.fluxSolverIds[face] < table.fluxSolvers.size());
+  real TData[tensor::T::size()];
+  real TinvData[tensor::Tinv::size()];
+  computeFaceRotation(localIntegration, face, TData, TinvData);
+
+  kernel::rotateFluxSolverNeighbor krnl;
+  krnl.fluxScale = localIntegration.fluxScales[face];
+  krnl.faceAlignedFluxSolver = table.fluxSolvers[localIntegration.fluxSolverIds[face]].neighbor;
+  krnl.T = TData;
+  krnl.Tinv = TinvData;
+  if (faceType == FaceType::dirichlet || faceType == FaceType::freeSurfaceGravity) {
+    // the boundary data is already given in the face-aligned frame
+    krnl.Tinv = init::identityT::Values;
+  }
+  krnl.AminusT = AminusT;
+  krnl.execute();
+}
+
+} // namespace seissol::kernels
+
+#endif // USE_COMPRESSED_CELL_MATRICES
+
+#endif // KERNELS_COMPRESSEDCELLMATRICES_H_
@@ -83,6 +83,11 @@ void seissol::kernels::DynamicRupture::setGlobalData(const CompoundGlobalData& g
 
 
 void seissol::kernels::DynamicRupture::setTimeStepWidth(double timestep)
+{
+  setSubTimeStep(timestep, 0, 1);
+}
+
+void seissol::kernels::DynamicRupture::setSubTimeStep(double timestep, unsigned subStep, unsigned numberOfSubSteps)
 {
 #ifdef USE_DR_CELLAVERAGE
   static_assert(false, "Cell average currently not supported");
@@ -106,13 +111,16 @@ void seissol::kernels::DynamicRupture::setTimeStepWidth(double timestep)
 #else
   // TODO(Lukas) Cache unscaled points/weights to avoid costly recomputation every timestep.
   seissol::quadrature::GaussLegendre(timePoints, timeWeights, CONVERGENCE_ORDER);
+  const double subTimeStep = timestep / numberOfSubSteps;
+  m_subTimeStepStart = subStep * subTimeStep;
   for (unsigned point = 0; point < CONVERGENCE_ORDER; ++point) {
 #ifdef USE_STP
-    double tau = timePoints[point];
+    // map the quadrature point of the sub time step to the reference interval of the time step
+    double tau = (2.0 * subStep + 1.0 + timePoints[point]) / numberOfSubSteps - 1.0;
     timeBasisFunctions[point] = std::make_shared<seissol::basisFunction::SampledTimeBasisFunctions<real>>(CONVERGENCE_ORDER, tau);
 #endif
-    timePoints[point] = 0.5 * (timestep * timePoints[point] + timestep);
-    timeWeights[point] = 0.5 * timestep * timeWeights[point];
+    timePoints[point] = 0.5 * (subTimeStep * timePoints[point] + subTimeStep);
+    timeWeights[point] = 0.5 * subTimeStep * timeWeights[point];
   }
 #endif
 }
@@ -147,8 +155,8 @@ void seissol::kernels::DynamicRupture::spaceTimeInterpolation(  DRFaceInformatio
     m_timeKernel.evaluateAtTime(timeBasisFunctions[timeInterval], timeDerivativePlus, degreesOfFreedomPlus);
     m_timeKernel.evaluateAtTime(timeBasisFunctions[timeInterval], timeDerivativeMinus, degreesOfFreedomMinus);
 #else
-    m_timeKernel.computeTaylorExpansion(timePoints[timeInterval], 0.0, timeDerivativePlus, degreesOfFreedomPlus);
-    m_timeKernel.computeTaylorExpansion(timePoints[timeInterval], 0.0, timeDerivativeMinus, degreesOfFreedomMinus);
+    m_timeKernel.computeTaylorExpansion(m_subTimeStepStart + timePoints[timeInterval], 0.0, timeDerivativePlus, degreesOfFreedomPlus);
+    m_timeKernel.computeTaylorExpansion(m_subTimeStepStart + timePoints[timeInterval], 0.0, timeDerivativeMinus, degreesOfFreedomMinus);
 #endif
 
     real const* plusPrefetch = (timeInterval < CONVERGENCE_ORDER-1) ? &QInterpolatedPlus[timeInterval+1][0] : timeDerivativePlus_prefetch;
@@ -192,7 +200,7 @@ void seissol::kernels::DynamicRupture::batchedSpaceTimeInterpolation(DrCondition
       real** timeDerivativePlus = (entry.get(inner_keys::Dr::Id::DerivativesPlus))->getDeviceDataPtr();
       degreesOfFreedomPlus = (entry.get(inner_keys::Dr::Id::IdofsPlus))->getDeviceDataPtr();
 
-      m_timeKernel.computeBatchedTaylorExpansion(timePoints[timeInterval],
+      m_timeKernel.computeBatchedTaylorExpansion(m_subTimeStepStart + timePoints[timeInterval],
                                                  0.0,
                                                  timeDerivativePlus,
                                                  degreesOfFreedomPlus,
@@ -200,7 +208,7 @@ void seissol::kernels::DynamicRupture::batchedSpaceTimeInterpolation(DrCondition
 
       real** timeDerivativeMinus = (entry.get(inner_keys::Dr::Id::DerivativesMinus))->getDeviceDataPtr();
       degreesOfFreedomMinus = (entry.get(inner_keys::Dr::Id::IdofsMinus))->getDeviceDataPtr();
-      m_timeKernel.computeBatchedTaylorExpansion(timePoints[timeInterval],
+      m_timeKernel.computeBatchedTaylorExpansion(m_subTimeStepStart + timePoints[timeInterval],
                                                  0.0,
                                                  timeDerivativeMinus,
                                                  degreesOfFreedomMinus,
@@ -260,7 +268,8 @@ void seissol::kernels::DynamicRupture::batchedSpaceTimeInterpolation(DrCondition
 
 void seissol::kernels::DynamicRupture::flopsGodunovState( DRFaceInformation const&  faceInfo,
                                                           long long&                o_nonZeroFlops,
-                                                          long long&                o_hardwareFlops )
+                                                          long long&                o_hardwareFlops,
+                                                          unsigned                  numberOfSubSteps )
 {
   m_timeKernel.flopsTaylorExpansion(o_nonZeroFlops, o_hardwareFlops);
  
@@ -274,6 +283,6 @@ void seissol::kernels::DynamicRupture::flopsGodunovState( DRFaceInformation cons
   o_nonZeroFlops += dynamicRupture::kernel::evaluateAndRotateQAtInterpolationPoints::nonZeroFlops(faceInfo.minusSide, faceInfo.faceRelation);
   o_hardwareFlops += dynamicRupture::kernel::evaluateAndRotateQAtInterpolationPoints::hardwareFlops(faceInfo.minusSide, faceInfo.faceRelation);
 
-  o_nonZeroFlops *= CONVERGENCE_ORDER;
-  o_hardwareFlops *= CONVERGENCE_ORDER;
+  o_nonZeroFlops *= CONVERGENCE_ORDER * numberOfSubSteps;
+  o_hardwareFlops *= CONVERGENCE_ORDER * numberOfSubSteps;
 }
@@ -63,6 +63,8 @@ class seissol::kernels::DynamicRupture {
   private:
     dynamicRupture::kernel::evaluateAndRotateQAtInterpolationPoints m_krnlPrototype;
     kernels::Time m_timeKernel;
+    //! Beginning of the current sub time step, relative to the beginning of the time step
+    double m_subTimeStepStart = 0.0;
 #ifdef ACL_DEVICE
     dynamicRupture::kernel::gpu_evaluateAndRotateQAtInterpolationPoints m_gpuKrnlPrototype;
     device::DeviceInstance& device = device::DeviceInstance::getInstance();
@@ -84,6 +86,17 @@ class seissol::kernels::DynamicRupture {
     
     void setTimeStepWidth(double timestep);
 
+    /**
+     * Sets the time points and weights for the sub time step subStep, where the time step is split
+     * into numberOfSubSteps sub time steps of equal width. The time points are relative to the
+     * beginning of the sub time step, the space time interpolation evaluates the time derivatives
+     * at the corresponding times of the whole time step.
+     **/
+    void setSubTimeStep(double timestep, unsigned subStep, unsigned numberOfSubSteps);
+
+    //! Beginning of the current sub time step, relative to the beginning of the time step
+    double getSubTimeStepStart() const { return m_subTimeStepStart; }
+
     void spaceTimeInterpolation(DRFaceInformation const&    faceInfo,
                                 GlobalData const*           global,
                                 DRGodunovData const*        godunovData,
@@ -97,9 +110,14 @@ class seissol::kernels::DynamicRupture {
 
   void batchedSpaceTimeInterpolation(DrConditionalPointersToRealsTable& table);
 
+    /**
+     * Flops of the space time interpolation of one face in one time step, which is repeated in
+     * each of the numberOfSubSteps friction sub steps.
+     **/
     void flopsGodunovState( DRFaceInformation const&  faceInfo,
                             long long&                o_nonZeroFlops,
-                            long long&                o_hardwareFlops );
+                            long long&                o_hardwareFlops,
+                            unsigned                  numberOfSubSteps = 1 );
 };
 
 #endif
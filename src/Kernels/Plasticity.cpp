@@ -43,7 +43,9 @@
 
 #include <cstring>
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
 #include <generated_code/kernel.h>
 #include <generated_code/init.h>
 #include "common.hpp"
@@ -55,6 +57,114 @@ using namespace device;
 #endif
 
 namespace seissol::kernels {
+  namespace {
+    // The tensors with an optional simulation dimension store it first for MULTIPLE_SIMULATIONS,
+    // followed by the basis functions or nodes
+#ifdef MULTIPLE_SIMULATIONS
+    constexpr unsigned NodeDimension = 1;
+#else
+    constexpr unsigned NodeDimension = 0;
+#endif
+    constexpr unsigned NumberOfBasisFunctions = tensor::QEtaModal::Shape[NodeDimension];
+    constexpr unsigned NumberOfNodes = tensor::QStressNodal::Shape[NodeDimension];
+
+    /** Nodal values of the basis functions phi_l, split into their mean over all nodes
+     *  and the maximum deviation from this mean, i.e.
+     *  phi_l(x_k) = mean_l + d_{kl} with |d_{kl}| <= deviation_l.
+     *  For the constant basis function, the deviation is zero. */
+    struct BasisFunctionBounds {
+      std::array<real, NumberOfBasisFunctions> mean{};
+      std::array<real, NumberOfBasisFunctions> deviation{};
+    };
+
+    BasisFunctionBounds computeBasisFunctionBounds(GlobalData const* global) {
+      BasisFunctionBounds bounds;
+      real QEtaModal[tensor::QEtaModal::size()] __attribute__((aligned(ALIGNMENT)));
+      real QEtaNodal[tensor::QEtaNodal::size()] __attribute__((aligned(ALIGNMENT)));
+      constexpr unsigned NumNodes = tensor::QEtaNodal::Shape[NodeDimension];
+
+      // Evaluate every basis function at the nodes with the same kernel as used for the stresses
+      kernel::plConvertEtaModal2Nodal m2nKrnl;
+      m2nKrnl.v = global->vandermondeMatrix;
+      m2nKrnl.QEtaModal = QEtaModal;
+      m2nKrnl.QEtaNodal = QEtaNodal;
+      for (unsigned l = 0; l < NumberOfBasisFunctions; ++l) {
+        std::fill(std::begin(QEtaModal), std::end(QEtaModal), static_cast<real>(0.0));
+        QEtaModal[l] = 1.0;
+        m2nKrnl.execute();
+
+        real mean = 0.0;
+        for (unsigned k = 0; k < NumNodes; ++k) {
+          mean += QEtaNodal[k];
+        }
+        mean /= NumNodes;
+        real deviation = 0.0;
+        for (unsigned k = 0; k < NumNodes; ++k) {
+          deviation = std::max(deviation, std::abs(QEtaNodal[k] - mean));
+        }
+        bounds.mean[l] = mean;
+        bounds.deviation[l] = deviation;
+      }
+      return bounds;
+    }
+  } // namespace
+
+  bool Plasticity::isBelowYieldSurface(GlobalData const *global,
+                                       PlasticityData const *plasticityData,
+                                       real const degreesOfFreedom[tensor::Q::size()]) {
+    static_assert(tensor::QStress::Shape[NodeDimension] == NumberOfBasisFunctions,
+                  "Modal stresses and modal eta must have the same number of basis functions.");
+    static const BasisFunctionBounds bounds = computeBasisFunctionBounds(global);
+    constexpr unsigned ModalStride = tensor::QStress::size() / 6;
+
+    /* Split the nodal stresses into s_{ij}(x_k) = c_{ij} + r_{ij}(x_k), where
+     * c_{ij} = sigma0_{ij} + sum_l mean_l Q_{lij} is constant over the cell and
+     * |r_{ij}(x_k)| <= R_{ij} = sum_l deviation_l |Q_{lij}|. */
+    real constant[6];
+    real radius[6];
+    real scale = 0.0;
+    for (unsigned p = 0; p < 6; ++p) {
+      const real* modes = degreesOfFreedom + p * ModalStride;
+      real c = plasticityData->initialLoading[p];
+      real r = 0.0;
+      #pragma omp simd reduction(+:c,r)
+      for (unsigned l = 0; l < NumberOfBasisFunctions; ++l) {
+        c += bounds.mean[l] * modes[l];
+        r += bounds.deviation[l] * std::abs(modes[l]);
+      }
+      constant[p] = c;
+      radius[p] = r;
+      scale = std::max(scale, std::abs(c) + r);
+    }
+
+    /* sqrt(I_2) is a seminorm, hence tau(x_k) <= tau(c) + tau(r(x_k)), and with
+     * I_2 = 1/6 ((s_xx - s_yy)^2 + (s_yy - s_zz)^2 + (s_zz - s_xx)^2) + s_xy^2 + s_yz^2 + s_xz^2
+     * the latter is bounded in terms of R_{ij}. Moreover, |m(x_k) - m(c)| <= (R_xx + R_yy + R_zz) / 3. */
+    const real meanStress = (constant[0] + constant[1] + constant[2]) / static_cast<real>(3.0);
+    const real meanStressRadius = (radius[0] + radius[1] + radius[2]) / static_cast<real>(3.0);
+    const real sxx = constant[0] - meanStress;
+    const real syy = constant[1] - meanStress;
+    const real szz = constant[2] - meanStress;
+    const real tauConstant = std::sqrt(static_cast<real>(0.5) * (sxx * sxx + syy * syy + szz * szz) +
+                                       constant[3] * constant[3] + constant[4] * constant[4] +
+                                       constant[5] * constant[5]);
+    const real rxy = radius[0] + radius[1];
+    const real ryz = radius[1] + radius[2];
+    const real rzx = radius[2] + radius[0];
+    const real tauRadius = std::sqrt((rxy * rxy + ryz * ryz + rzx * rzx) / static_cast<real>(6.0) +
+                                     radius[3] * radius[3] + radius[4] * radius[4] +
+                                     radius[5] * radius[5]);
+
+    // Lower bound of tau_c = max(0, c cos(phi) - m sin(phi)) over all nodes
+    const real taulimLowerBound = plasticityData->cohesionTimesCosAngularFriction -
+                                  meanStress * plasticityData->sinAngularFriction -
+                                  meanStressRadius * std::abs(plasticityData->sinAngularFriction);
+
+    // Safety margin for the round-off in the nodal evaluation
+    const real tolerance = static_cast<real>(1.0e3) * std::numeric_limits<real>::epsilon() * scale;
+    return tauConstant + tauRadius + tolerance < taulimLowerBound;
+  }
+
   unsigned Plasticity::computePlasticity(double oneMinusIntegratingFactor,
                                          double timeStepWidth,
                                          double T_v,
@@ -69,17 +179,18 @@ namespace seissol::kernels {
     real QStressNodal[tensor::QStressNodal::size()] __attribute__((aligned(ALIGNMENT)));
     real QEtaNodal[tensor::QEtaNodal::size()] __attribute__((aligned(ALIGNMENT)));
     real QEtaModal[tensor::QEtaModal::size()] __attribute__((aligned(ALIGNMENT)));
-    real meanStress[tensor::meanStress::size()] __attribute__((aligned(ALIGNMENT)));
-    real secondInvariant[tensor::secondInvariant::size()] __attribute__((aligned(ALIGNMENT)));
-    real tau[tensor::secondInvariant::size()] __attribute__((aligned(ALIGNMENT)));
-    real taulim[tensor::meanStress::size()] __attribute__((aligned(ALIGNMENT)));
     real yieldFactor[tensor::yieldFactor::size()] __attribute__((aligned(ALIGNMENT)));
     real dudt_pstrain[tensor::QStress::size()] __attribute__((aligned(ALIGNMENT)));
 
-    static_assert(tensor::secondInvariant::size() == tensor::meanStress::size(),
-                  "Second invariant tensor and mean stress tensor must be of the same size().");
-    static_assert(tensor::yieldFactor::size() <= tensor::meanStress::size(),
-                  "Yield factor tensor must be smaller than mean stress tensor.");
+    // The nodal stresses are stored component by component (column-major),
+    // i.e. as a structure of arrays over the nodes. The yield factor is shared by all
+    // simulations, hence plasticity is rejected for MULTIPLE_SIMULATIONS at startup.
+    constexpr unsigned NumNodes = NumberOfNodes;
+    constexpr unsigned NodalStride = tensor::QStressNodal::size() / 6;
+    static_assert(tensor::QStressNodal::size() % 6 == 0,
+                  "Nodal stress tensor must consist of 6 equally sized components.");
+    static_assert(tensor::yieldFactor::size() >= NumNodes,
+                  "Yield factor tensor must hold a value for every node.");
 
     //copy dofs for later comparison, only first dof of stresses required
     // @todo multiple sims
@@ -100,51 +211,41 @@ namespace seissol::kernels {
     m2nKrnl.initialLoading = plasticityData->initialLoading;
     m2nKrnl.execute();
 
-    // Computes m = s_{ii} / 3.0 for every node
-    kernel::plComputeMean cmKrnl;
-    cmKrnl.meanStress = meanStress;
-    cmKrnl.QStressNodal = QStressNodal;
-    cmKrnl.selectBulkAverage = init::selectBulkAverage::Values;
-    cmKrnl.execute();
-
-    /* Compute s_{ij} := s_{ij} - m delta_{ij},
-     * where delta_{ij} = 1 if i == j else 0.
-     * Thus, s_{ij} contains the deviatoric stresses. */
-    kernel::plSubtractMean smKrnl;
-    smKrnl.meanStress = meanStress;
-    smKrnl.QStressNodal = QStressNodal;
-    smKrnl.selectBulkNegative = init::selectBulkNegative::Values;
-    smKrnl.execute();
-
-    // Compute I_2 = 0.5 s_{ij} s_ji for every node
-    kernel::plComputeSecondInvariant siKrnl;
-    siKrnl.secondInvariant = secondInvariant;
-    siKrnl.QStressNodal = QStressNodal;
-    siKrnl.weightSecondInvariant = init::weightSecondInvariant::Values;
-    siKrnl.execute();
-
-    // tau := sqrt(I_2) for every node
-    for (unsigned ip = 0; ip < tensor::secondInvariant::size(); ++ip) {
-      tau[ip] = sqrt(secondInvariant[ip]);
-    }
-
-    // Compute tau_c for every node
-    for (unsigned ip = 0; ip < tensor::meanStress::size(); ++ip) {
-      taulim[ip] = std::max((real) 0.0, plasticityData->cohesionTimesCosAngularFriction -
-                                        meanStress[ip] * plasticityData->sinAngularFriction);
-    }
-
-    bool adjust = false;
-    for (unsigned ip = 0; ip < tensor::yieldFactor::size(); ++ip) {
-      // Compute yield := (t_c / tau - 1) r for every node,
-      // where r = 1 - exp(-timeStepWidth / T_v)
-      if (tau[ip] > taulim[ip]) {
-        adjust = true;
-        yieldFactor[ip] = (taulim[ip] / tau[ip] - 1.0) * oneMinusIntegratingFactor;
-      } else {
-        yieldFactor[ip] = 0.0;
-      }
+    /* Fused yield check, vectorized over the nodes. For every node:
+     *  m := s_{ii} / 3
+     *  s_{ij} := s_{ij} - m delta_{ij}, i.e. s_{ij} contains the deviatoric stresses
+     *  tau := sqrt(I_2) with I_2 = 0.5 s_{ij} s_{ji}
+     *  tau_c := max(0, c cos(phi) - m sin(phi))
+     *  yield := (tau_c / tau - 1) r if tau > tau_c, 0 otherwise,
+     * where r = 1 - exp(-timeStepWidth / T_v) */
+    real* sxx = QStressNodal + 0 * NodalStride;
+    real* syy = QStressNodal + 1 * NodalStride;
+    real* szz = QStressNodal + 2 * NodalStride;
+    const real* sxy = QStressNodal + 3 * NodalStride;
+    const real* syz = QStressNodal + 4 * NodalStride;
+    const real* sxz = QStressNodal + 5 * NodalStride;
+    const real cohesionTimesCosAngularFriction = plasticityData->cohesionTimesCosAngularFriction;
+    const real sinAngularFriction = plasticityData->sinAngularFriction;
+
+    unsigned numberOfYieldingNodes = 0;
+    #pragma omp simd reduction(+:numberOfYieldingNodes)
+    for (unsigned ip = 0; ip < NumNodes; ++ip) {
+      const real meanStress = (sxx[ip] + syy[ip] + szz[ip]) / static_cast<real>(3.0);
+      sxx[ip] -= meanStress;
+      syy[ip] -= meanStress;
+      szz[ip] -= meanStress;
+      const real secondInvariant =
+          static_cast<real>(0.5) * (sxx[ip] * sxx[ip] + syy[ip] * syy[ip] + szz[ip] * szz[ip]) +
+          sxy[ip] * sxy[ip] + syz[ip] * syz[ip] + sxz[ip] * sxz[ip];
+      const real tau = std::sqrt(secondInvariant);
+      const real taulim = std::max(static_cast<real>(0.0),
+                                   cohesionTimesCosAngularFriction - meanStress * sinAngularFriction);
+      const bool yields = tau > taulim;
+      yieldFactor[ip] = yields ? (taulim / tau - static_cast<real>(1.0)) * oneMinusIntegratingFactor
+                               : static_cast<real>(0.0);
+      numberOfYieldingNodes += yields ? 1 : 0;
     }
+    const bool adjust = numberOfYieldingNodes > 0;
 
     if (adjust) {
       /**
@@ -252,9 +353,9 @@ namespace seissol::kernels {
                                                 initializers::recording::ConditionalPointersToRealsTable &table,
                                                 PlasticityData *plasticityData) {
 #ifdef ACL_DEVICE
-    static_assert(tensor::Q::Shape[0] == tensor::QStressNodal::Shape[0],
+    static_assert(tensor::Q::Shape[NodeDimension] == NumberOfNodes,
                   "modal and nodal dofs must have the same leading dimensions");
-    static_assert(tensor::Q::Shape[0] == tensor::v::Shape[0],
+    static_assert(tensor::Q::Shape[NodeDimension] == tensor::v::Shape[0],
                   "modal dofs and vandermonde matrix must hage the same leading dimensions");
 
     DeviceInstance &device = DeviceInstance::getInstance();
@@ -442,6 +543,17 @@ namespace seissol::kernels {
 #endif // ACL_DEVICE
   }
 
+  void Plasticity::flopsPlasticityPreCheck(long long &o_NonZeroFlops,
+                                           long long &o_HardwareFlops) {
+    // constant part and radius (2 mul, 2 add per mode and stress component, abs NOT counted)
+    o_NonZeroFlops = 6 * 4 * NumberOfBasisFunctions;
+    o_HardwareFlops = 6 * 4 * (tensor::QStress::size() / 6);
+
+    // invariants and bounds (sqrt and max NOT counted)
+    o_NonZeroFlops += 44;
+    o_HardwareFlops += 44;
+  }
+
   void Plasticity::flopsPlasticity(long long &o_NonZeroFlopsCheck,
                                    long long &o_HardwareFlopsCheck,
                                    long long &o_NonZeroFlopsYield,
@@ -456,21 +568,12 @@ namespace seissol::kernels {
     o_NonZeroFlopsCheck += kernel::plConvertToNodal::NonZeroFlops;
     o_HardwareFlopsCheck += kernel::plConvertToNodal::HardwareFlops;
 
-    // compute mean stress
-    o_NonZeroFlopsCheck += kernel::plComputeMean::NonZeroFlops;
-    o_HardwareFlopsCheck += kernel::plComputeMean::HardwareFlops;
-
-    // subtract mean stress
-    o_NonZeroFlopsCheck += kernel::plSubtractMean::NonZeroFlops;
-    o_HardwareFlopsCheck += kernel::plSubtractMean::HardwareFlops;
-
-    // compute second invariant
-    o_NonZeroFlopsCheck += kernel::plComputeSecondInvariant::NonZeroFlops;
-    o_HardwareFlopsCheck += kernel::plComputeSecondInvariant::HardwareFlops;
-
-    // compute taulim (1 add, 1 mul, max NOT counted)
-    o_NonZeroFlopsCheck += 2 * tensor::meanStress::size();
-    o_HardwareFlopsCheck += 2 * tensor::meanStress::size();
+    // fused yield check per node (sqrt and max NOT counted):
+    // mean stress (2 add, 1 div), subtract mean stress (3 add),
+    // second invariant (6 mul, 5 add, 1 mul), taulim (1 add, 1 mul)
+    constexpr long long FlopsPerNode = 3 + 3 + 12 + 2;
+    o_NonZeroFlopsCheck += FlopsPerNode * NumberOfNodes;
+    o_HardwareFlopsCheck += FlopsPerNode * (tensor::QStressNodal::size() / 6);
 
     // check for yield (NOT counted, as it would require counting the number of yielding points)
 
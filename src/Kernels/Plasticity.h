@@ -57,6 +57,14 @@ class seissol::kernels::Plasticity {
 public:
   /** Returns 1 if there was plastic yielding otherwise 0.
    */
+  /** Returns true if the stresses of the cell provably stay below the yield surface
+   *  at every node, such that computePlasticity would not change the cell.
+   *  The check is conservative and works on the modal coefficients only.
+   */
+  static bool isBelowYieldSurface( GlobalData const*           global,
+                                   PlasticityData const*       plasticityData,
+                                   real const                  degreesOfFreedom[tensor::Q::size()]);
+
   static unsigned computePlasticity( double                      oneMinusIntegratingFactor,
                                      double                      timeStepWidth,
                                      double                      T_v,
@@ -72,6 +80,9 @@ public:
                                            initializers::recording::ConditionalPointersToRealsTable &table,
                                            PlasticityData *plasticity);
 
+  static void flopsPlasticityPreCheck(  long long&  o_nonZeroFlops,
+                                        long long&  o_hardwareFlops );
+
   static void flopsPlasticity(  long long&  o_nonZeroFlopsCheck,
                                 long long&  o_hardwareFlopsCheck,
                                 long long&  o_nonZeroFlopsYield,
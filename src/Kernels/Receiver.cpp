@@ -68,6 +68,13 @@ void seissol::kernels::ReceiverCluster::addReceiver(  unsigned
                             coords,
                             kernels::LocalData::lookup(lts, ltsLut, meshId),
                             reserved);
+  m_receiverMeshIds.push_back(meshId);
+
+  // Keep receivers which lie in the same cell next to each other,
+  // such that the time prediction is computed only once per cell
+  auto position = std::upper_bound(m_cellOrder.begin(), m_cellOrder.end(), meshId,
+                                   [&](unsigned id, size_t receiver) { return id < m_receiverMeshIds[receiver]; });
+  m_cellOrder.insert(position, m_receivers.size() - 1);
 }
 
 double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
@@ -102,15 +109,19 @@ double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
 
   double receiverTime = time;
   if (time >= expansionPoint && time < expansionPoint + timeStepWidth) {
-    for (auto& receiver : m_receivers) {
-      krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
-      derivativeKrnl.basisFunctionDerivativesAtPoint = receiver.basisFunctionDerivatives.m_data.data();
+    for (size_t first = 0; first < m_cellOrder.size();) {
+      // All receivers m_cellOrder[first, last) lie in the same cell
+      const unsigned meshId = m_receiverMeshIds[m_cellOrder[first]];
+      size_t last = first + 1;
+      while (last < m_cellOrder.size() && m_receiverMeshIds[m_cellOrder[last]] == meshId) {
+        ++last;
+      }
 
 #ifdef USE_STP
-      m_timeKernel.executeSTP(timeStepWidth, receiver.data, timeEvaluated, stp);
+      m_timeKernel.executeSTP(timeStepWidth, m_receivers[m_cellOrder[first]].data, timeEvaluated, stp);
 #else
       m_timeKernel.computeAder( timeStepWidth,
-                                receiver.data,
+                                m_receivers[m_cellOrder[first]].data,
                                 tmp,
                                 timeEvaluated, // useless but the interface requires it
                                 timeDerivatives );
@@ -122,7 +133,7 @@ double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
       while (receiverTime < expansionPoint + timeStepWidth) {
 #ifdef USE_STP
         //eval time basis
-        double tau = (time - expansionPoint) / timeStepWidth;
+        double tau = (receiverTime - expansionPoint) / timeStepWidth;
         seissol::basisFunction::SampledTimeBasisFunctions<real> timeBasisFunctions(CONVERGENCE_ORDER, tau);
         krnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
         derivativeKrnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
@@ -130,50 +141,58 @@ double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
         m_timeKernel.computeTaylorExpansion(receiverTime, expansionPoint, timeDerivatives, timeEvaluated);
 #endif
 
-        krnl.execute();
-        derivativeKrnl.execute();
+        for (size_t r = first; r < last; ++r) {
+          auto& receiver = m_receivers[m_cellOrder[r]];
+          krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
+          derivativeKrnl.basisFunctionDerivativesAtPoint = receiver.basisFunctionDerivatives.m_data.data();
 
-        receiver.output.push_back(receiverTime);
+          krnl.execute();
+          derivativeKrnl.execute();
+
+          receiver.output.push_back(receiverTime);
 #ifdef MULTIPLE_SIMULATIONS
-        for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-          for (auto quantity : m_quantities) {
-           if (!std::isfinite(qAtPoint(sim, quantity))) {
-             logError()
-                 << "Detected Inf/NaN in receiver output at"
-                 << receiver.coordinates[0] << ","
-                 << receiver.coordinates[1] << ","
-                 << receiver.coordinates[2] << "."
-                 << "Aborting.";
+          for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
+            for (auto quantity : m_quantities) {
+              if (!std::isfinite(qAtPoint(sim, quantity))) {
+                logError()
+                    << "Detected Inf/NaN in receiver output at"
+                    << receiver.position[0] << ","
+                    << receiver.position[1] << ","
+                    << receiver.position[2] << "."
+                    << "Aborting.";
+              }
+              receiver.output.push_back(qAtPoint(sim, quantity));
+            }
+            if (m_computeRotation) {
+              receiver.output.push_back(qDerivativeAtPoint(sim, 8, 1) - qDerivativeAtPoint(sim, 7, 2));
+              receiver.output.push_back(qDerivativeAtPoint(sim, 6, 2) - qDerivativeAtPoint(sim, 8, 0));
+              receiver.output.push_back(qDerivativeAtPoint(sim, 7, 0) - qDerivativeAtPoint(sim, 6, 1));
+            }
           }
-            receiver.output.push_back(qAtPoint(sim, quantity));
+#else //MULTIPLE_SIMULATIONS
+          for (auto quantity : m_quantities) {
+            if (!std::isfinite(qAtPoint(quantity))) {
+              logError()
+                  << "Detected Inf/NaN in receiver output at"
+                  << receiver.position[0] << ","
+                  << receiver.position[1] << ","
+                  << receiver.position[2] << "."
+                  << "Aborting.";
+            }
+            receiver.output.push_back(qAtPoint(quantity));
           }
           if (m_computeRotation) {
-            receiver.output.push_back(qDerivativeAtPoint(sim, 8, 1) - qDerivativeAtPoint(sim, 7, 2));
-            receiver.output.push_back(qDerivativeAtPoint(sim, 6, 2) - qDerivativeAtPoint(sim, 8, 0));
-            receiver.output.push_back(qDerivativeAtPoint(sim, 7, 0) - qDerivativeAtPoint(sim, 6, 1));
+            receiver.output.push_back(qDerivativeAtPoint(8, 1) - qDerivativeAtPoint(7, 2));
+            receiver.output.push_back(qDerivativeAtPoint(6, 2) - qDerivativeAtPoint(8, 0));
+            receiver.output.push_back(qDerivativeAtPoint(7, 0) - qDerivativeAtPoint(6, 1));
           }
-        }
-#else //MULTIPLE_SIMULATIONS
-        for (auto quantity : m_quantities) {
-          if (!std::isfinite(qAtPoint(quantity))) {
-            logError()
-                << "Detected Inf/NaN in receiver output at"
-                << receiver.position[0] << ","
-                << receiver.position[1] << ","
-                << receiver.position[2] << "."
-                << "Aborting.";
-          }
-          receiver.output.push_back(qAtPoint(quantity));
-        }
-        if (m_computeRotation) {
-          receiver.output.push_back(qDerivativeAtPoint(8, 1) - qDerivativeAtPoint(7, 2));
-          receiver.output.push_back(qDerivativeAtPoint(6, 2) - qDerivativeAtPoint(8, 0));
-          receiver.output.push_back(qDerivativeAtPoint(7, 0) - qDerivativeAtPoint(6, 1));
-        }
 #endif //MULTITPLE_SIMULATIONS
+        }
 
         receiverTime += m_samplingInterval;
       }
+
+      first = last;
     }
   }
   return receiverTime;
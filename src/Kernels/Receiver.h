@@ -47,9 +47,11 @@
 #include <Initializer/tree/Lut.hpp>
 #include <Kernels/Interface.hpp>
 #include <Kernels/Time.h>
+#include <Kernels/precision.hpp>
 #include <Numerical_aux/BasisFunction.h>
 #include <Numerical_aux/Transformation.h>
 #include <generated_code/init.h>
+#include <algorithm>
 #include <vector>
 
 struct GlobalData;
@@ -75,7 +77,8 @@ namespace seissol {
       basisFunction::SampledBasisFunctions<real> basisFunctions;
       basisFunction::SampledBasisFunctionDerivatives<real> basisFunctionDerivatives;
       kernels::LocalData data;
-      std::vector<real> output;
+      // the sample times are accumulated in double, also in mixed precision
+      std::vector<realAcc> output;
     };
 
     class ReceiverCluster {
@@ -131,6 +134,10 @@ namespace seissol {
 
     private:
       std::vector<Receiver> m_receivers;
+      //! Cell of each receiver
+      std::vector<unsigned> m_receiverMeshIds;
+      //! Receiver indices sorted by cell, such that receivers of the same cell are contiguous
+      std::vector<size_t> m_cellOrder;
       seissol::kernels::Time m_timeKernel;
       std::vector<unsigned> m_quantities;
       unsigned m_nonZeroFlops;
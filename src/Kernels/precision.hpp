@@ -20,6 +20,14 @@ typedef float real;
 typedef double real;
 #endif
 
+// Fault quantities which are accumulated over the whole simulation (e.g. rupture times,
+// frictional work). In mixed precision, they are kept in double while the wave field is float.
+#if defined(DOUBLE_PRECISION) || defined(USE_MIXED_PRECISION)
+typedef double realAcc;
+#else
+typedef float realAcc;
+#endif
+
 
 #ifdef USE_MPI
 #ifdef SINGLE_PRECISION
@@ -206,6 +206,10 @@ protected:
     return m_syncInterval;
   }
 
+  double nextSyncPoint() const {
+    return m_nextSyncPoint;
+  }
+
 	/**
 	 * Set the synchronization interval for this module
 	 *
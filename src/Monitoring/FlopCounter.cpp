@@ -203,7 +203,126 @@ void FlopCounter::printPerformanceSummary(double wallTime) {
                 << UnitFlop.formatPrefix(totalFlops[PLHardwareFlops]).c_str();
   logInfo(rank) << "PL calculated NZ-FLOP: "
                 << UnitFlop.formatPrefix(totalFlops[PLNonZeroFlops]).c_str();
+
+  dynamicRuptureFaces.printSummary("DR", "face updates skipped for locked faces");
+  plasticityCells.printSummary("PL", "cell updates skipped by the yield pre-check");
+  printFrictionIterationSummary();
 }
+
+void FlopCounter::printFrictionIterationSummary() {
+  const int rank = seissol::MPI::mpi.rank();
+  const std::lock_guard lock(frictionIterationsMutex);
+
+  unsigned long numberOfBins = frictionIterations.size();
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE,
+                &numberOfBins,
+                1,
+                MPI_UNSIGNED_LONG,
+                MPI_MAX,
+                seissol::MPI::mpi.comm());
+#endif
+  if (numberOfBins == 0) {
+    return;
+  }
+  // updates, fallback points, histogram
+  std::vector<unsigned long long> counts(numberOfBins + 2, 0);
+  counts[0] = frictionUpdates;
+  counts[1] = frictionFallbackPoints;
+  std::copy(frictionIterations.begin(), frictionIterations.end(), counts.begin() + 2);
+#ifdef USE_MPI
+  MPI_Reduce(rank == 0 ? MPI_IN_PLACE : counts.data(),
+             counts.data(),
+             counts.size(),
+             MPI_UNSIGNED_LONG_LONG,
+             MPI_SUM,
+             0,
+             seissol::MPI::mpi.comm());
+#endif
+
+  unsigned long long numberOfInversions = 0;
+  unsigned long long numberOfIterations = 0;
+  for (unsigned bin = 0; bin < numberOfBins; ++bin) {
+    numberOfInversions += counts[bin + 2];
+    numberOfIterations += bin * counts[bin + 2];
+  }
+  if (numberOfInversions == 0) {
+    return;
+  }
+  logInfo(rank) << "DR friction:" << counts[0] << "updates," << numberOfInversions
+                << "slip rate inversions,"
+                << static_cast<double>(numberOfIterations) / numberOfInversions
+                << "Newton iterations per inversion," << counts[1]
+                << "points solved by the bracketed fallback";
+  for (unsigned bin = 0; bin < numberOfBins; ++bin) {
+    if (counts[bin + 2] > 0) {
+      logInfo(rank) << "DR friction:" << counts[bin + 2] << "inversions with" << bin
+                    << (bin + 1 == numberOfBins ? "or more Newton iterations"
+                                                : "Newton iterations");
+    }
+  }
+}
+
+void FlopCounter::ClusterUpdates::printSummary(const char* prefix, const char* description) {
+  const int rank = seissol::MPI::mpi.rank();
+  const std::lock_guard lock(mutex);
+
+  unsigned long numberOfClusters = total.size();
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE,
+                &numberOfClusters,
+                1,
+                MPI_UNSIGNED_LONG,
+                MPI_MAX,
+                seissol::MPI::mpi.comm());
+#endif
+  if (numberOfClusters == 0) {
+    return;
+  }
+  total.resize(numberOfClusters, 0);
+  skipped.resize(numberOfClusters, 0);
+
+  std::vector<long long> totalUpdates(total);
+  std::vector<long long> totalSkipped(skipped);
+#ifdef USE_MPI
+  MPI_Reduce(total.data(),
+             totalUpdates.data(),
+             numberOfClusters,
+             MPI_LONG_LONG,
+             MPI_SUM,
+             0,
+             seissol::MPI::mpi.comm());
+  MPI_Reduce(skipped.data(),
+             totalSkipped.data(),
+             numberOfClusters,
+             MPI_LONG_LONG,
+             MPI_SUM,
+             0,
+             seissol::MPI::mpi.comm());
+#endif
+
+  for (unsigned cluster = 0; cluster < numberOfClusters; ++cluster) {
+    if (totalUpdates[cluster] > 0) {
+      logInfo(rank) << prefix << "cluster" << cluster << ":" << totalSkipped[cluster] << "of"
+                    << totalUpdates[cluster] << description << "("
+                    << 100.0 * totalSkipped[cluster] / totalUpdates[cluster] << "%)";
+    }
+  }
+}
+
+void FlopCounter::ClusterUpdates::increment(unsigned globalClusterId,
+                                            long long numberOfUpdates,
+                                            long long numberOfSkipped) {
+  assert(numberOfSkipped >= 0 && numberOfSkipped <= numberOfUpdates);
+  const std::lock_guard lock(mutex);
+  if (globalClusterId >= total.size()) {
+    total.resize(globalClusterId + 1, 0);
+    skipped.resize(globalClusterId + 1, 0);
+  }
+  total[globalClusterId] += numberOfUpdates;
+  skipped[globalClusterId] += numberOfSkipped;
+}
+
 void FlopCounter::incrementNonZeroFlopsLocal(long long update) {
   assert(update >= 0);
   nonZeroFlopsLocal += update;
@@ -244,4 +363,28 @@ void FlopCounter::incrementHardwareFlopsPlasticity(long long update) {
   assert(update >= 0);
   hardwareFlopsPlasticity += update;
 }
+void FlopCounter::incrementPlasticityCells(unsigned globalClusterId,
+                                           long long numberOfCells,
+                                           long long numberOfSkippedCells) {
+  plasticityCells.increment(globalClusterId, numberOfCells, numberOfSkippedCells);
+}
+void FlopCounter::incrementDynamicRuptureFaces(unsigned globalClusterId,
+                                               long long numberOfFaces,
+                                               long long numberOfLockedFaces) {
+  dynamicRuptureFaces.increment(globalClusterId, numberOfFaces, numberOfLockedFaces);
+}
+void FlopCounter::incrementFrictionIterations(unsigned long long numberOfUpdates,
+                                              const unsigned long long* histogram,
+                                              unsigned numberOfBins,
+                                              unsigned long long numberOfFallbackPoints) {
+  const std::lock_guard lock(frictionIterationsMutex);
+  if (numberOfBins > frictionIterations.size()) {
+    frictionIterations.resize(numberOfBins, 0);
+  }
+  frictionUpdates += numberOfUpdates;
+  for (unsigned bin = 0; bin < numberOfBins; ++bin) {
+    frictionIterations[bin] += histogram[bin];
+  }
+  frictionFallbackPoints += numberOfFallbackPoints;
+}
 } // namespace seissol::monitoring
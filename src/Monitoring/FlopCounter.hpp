@@ -42,7 +42,10 @@
 #ifndef FLOPCOUNTER_HPP
 #define FLOPCOUNTER_HPP
 
+#include <atomic>
 #include <fstream>
+#include <mutex>
+#include <vector>
 
 // Floating point operations performed in the matrix kernels.
 // Remark: These variables are updated by the matrix kernels (subroutine.cpp) only in debug builds.
@@ -65,22 +68,54 @@ struct FlopCounter {
   void incrementHardwareFlopsDynamicRupture(long long update);
   void incrementNonZeroFlopsPlasticity(long long update);
   void incrementHardwareFlopsPlasticity(long long update);
+  void incrementPlasticityCells(unsigned globalClusterId,
+                                long long numberOfCells,
+                                long long numberOfSkippedCells);
+  void incrementDynamicRuptureFaces(unsigned globalClusterId,
+                                    long long numberOfFaces,
+                                    long long numberOfLockedFaces);
+  void incrementFrictionIterations(unsigned long long numberOfUpdates,
+                                   const unsigned long long* histogram,
+                                   unsigned numberOfBins,
+                                   unsigned long long numberOfFallbackPoints);
 
   private:
+  // updates per global cluster, of which some were skipped
+  struct ClusterUpdates {
+    std::mutex mutex;
+    std::vector<long long> total;
+    std::vector<long long> skipped;
+
+    void increment(unsigned globalClusterId, long long numberOfUpdates, long long numberOfSkipped);
+    void printSummary(const char* prefix, const char* description);
+  };
+
+  void printFrictionIterationSummary();
+
   std::ofstream out;
   long long previousTotalFlops = 0;
   double previousWallTime = 0;
   // global variables for summing-up SeisSol internal counters
-  long long nonZeroFlopsLocal = 0;
-  long long hardwareFlopsLocal = 0;
-  long long nonZeroFlopsNeighbor = 0;
-  long long hardwareFlopsNeighbor = 0;
-  long long nonZeroFlopsOther = 0;
-  long long hardwareFlopsOther = 0;
-  long long nonZeroFlopsDynamicRupture = 0;
-  long long hardwareFlopsDynamicRupture = 0;
-  long long nonZeroFlopsPlasticity = 0;
-  long long hardwareFlopsPlasticity = 0;
+  // (atomic, as time clusters may be executed concurrently)
+  std::atomic<long long> nonZeroFlopsLocal = 0;
+  std::atomic<long long> hardwareFlopsLocal = 0;
+  std::atomic<long long> nonZeroFlopsNeighbor = 0;
+  std::atomic<long long> hardwareFlopsNeighbor = 0;
+  std::atomic<long long> nonZeroFlopsOther = 0;
+  std::atomic<long long> hardwareFlopsOther = 0;
+  std::atomic<long long> nonZeroFlopsDynamicRupture = 0;
+  std::atomic<long long> hardwareFlopsDynamicRupture = 0;
+  std::atomic<long long> nonZeroFlopsPlasticity = 0;
+  std::atomic<long long> hardwareFlopsPlasticity = 0;
+  // cell updates which entered the plasticity kernel and which were skipped by the yield pre-check
+  ClusterUpdates plasticityCells;
+  // dynamic rupture face updates and those which took the elastic path for locked faces
+  ClusterUpdates dynamicRuptureFaces;
+  // histogram of the Newton iterations per slip rate inversion of the rate and state friction laws
+  std::mutex frictionIterationsMutex;
+  unsigned long long frictionUpdates = 0;
+  std::vector<unsigned long long> frictionIterations;
+  unsigned long long frictionFallbackPoints = 0;
 };
 } // namespace seissol::monitoring
 
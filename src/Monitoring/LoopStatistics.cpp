@@ -44,6 +44,9 @@
 #include <cmath>
 #include <cstdint>
 #include <cstddef>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #ifdef USE_NETCDF
 #include <netcdf.h>
 #ifdef USE_MPI
@@ -57,10 +60,27 @@
 
 namespace seissol {
 
+namespace {
+int threadId() {
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+int numberOfThreads() {
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+} // namespace
+
 void LoopStatistics::enableSampleOutput(bool enabled) { outputSamples = enabled; }
 
 LoopStatistics::Region::Region(std::string const& name, bool includeInSummary)
-    : name(name), includeInSummary(includeInSummary) {}
+    : name(name), includeInSummary(includeInSummary), begin(numberOfThreads()) {}
 
 void LoopStatistics::addRegion(std::string const& name, bool includeInSummary) {
   regions.push_back(Region(name, includeInSummary));
@@ -75,17 +95,18 @@ unsigned LoopStatistics::getRegion(std::string const& name) const {
 }
 
 void LoopStatistics::begin(unsigned region) {
-  clock_gettime(CLOCK_MONOTONIC, &regions[region].begin);
+  clock_gettime(CLOCK_MONOTONIC, &regions[region].begin[threadId()]);
 }
 
 void LoopStatistics::end(unsigned region, unsigned numIterations, unsigned subRegion) {
   timespec endTime;
   clock_gettime(CLOCK_MONOTONIC, &endTime);
-  addSample(region, numIterations, subRegion, regions[region].begin, endTime);
+  addSample(region, numIterations, subRegion, regions[region].begin[threadId()], endTime);
 }
 
 void LoopStatistics::addSample(
     unsigned region, unsigned numIterations, unsigned subRegion, timespec begin, timespec end) {
+  std::lock_guard lock{sampleMutex};
   if (outputSamples) {
     Sample sample;
     sample.begin = begin;
@@ -173,6 +194,13 @@ void LoopStatistics::printSummary(MPI_Comm comm) {
   MPI_Allreduce(MPI_IN_PLACE, sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, comm);
 #endif
 
+  timePerIteration.assign(nRegions, 0.0);
+  for (unsigned region = 0; region < nRegions; ++region) {
+    if (getNumIters(region) > 0) {
+      timePerIteration[region] = getTime(region) / getNumIters(region);
+    }
+  }
+
   auto regressionCoeffs = std::vector<double>(2 * nRegions);
   auto stderror = std::vector<double>(nRegions, 0.0);
   for (unsigned region = 0; region < nRegions; ++region) {
@@ -236,6 +264,10 @@ void LoopStatistics::printSummary(MPI_Comm comm) {
   }
 }
 
+double LoopStatistics::getTimePerIteration(unsigned region) const {
+  return region < timePerIteration.size() ? timePerIteration[region] : 0.0;
+}
+
 #ifdef USE_NETCDF
 static void check_err(const int stat, const int line, const char* file) {
   if (stat != NC_NOERR) {
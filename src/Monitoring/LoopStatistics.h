@@ -47,6 +47,7 @@
 #include <unordered_map>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <time.h>
 #include <vector>
 #include "Parallel/MPI.h"
@@ -71,6 +72,12 @@ class LoopStatistics {
 
   void printSummary(MPI_Comm comm);
 
+  /**
+   * Returns the time per iteration of the region, averaged over all samples of all ranks.
+   * Only valid after printSummary was called; returns 0 if no iteration was recorded.
+   */
+  double getTimePerIteration(unsigned region) const;
+
   void writeSamples(const std::string& outputPrefix, bool isLoopStatisticsNetcdfOutputOn);
 
   private:
@@ -94,14 +101,17 @@ class LoopStatistics {
     std::string name;
     std::vector<Sample> times;
     bool includeInSummary;
-    timespec begin;
+    //! one begin time per OpenMP thread, as actors may be executed concurrently
+    std::vector<timespec> begin;
     StatisticVariables variables;
 
     Region(const std::string& name, bool includeInSummary);
   };
 
   std::vector<Region> regions;
+  std::vector<double> timePerIteration;
   bool outputSamples = false;
+  std::mutex sampleMutex;
 };
 } // namespace seissol
 
@@ -34,6 +34,23 @@ void printPersistentMpiInfo(const T& mpiBasic) {
   }
 }
 
+inline bool useTaskScheduler() {
+#ifdef ACL_DEVICE
+  return false;
+#else
+  return utils::Env::get<bool>("SEISSOL_TASK_SCHEDULER", false);
+#endif
+}
+
+template <typename T>
+void printTaskSchedulerInfo(const T& mpiBasic) {
+  if (useTaskScheduler()) {
+    logInfo(mpiBasic.rank()) << "Executing independent time cluster actors concurrently as tasks.";
+  } else {
+    logInfo(mpiBasic.rank()) << "Executing time cluster actors one after another.";
+  }
+}
+
 } // namespace seissol
 
 #endif // SEISSOL_PARALLEL_HELPER_HPP_
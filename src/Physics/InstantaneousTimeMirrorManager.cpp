@@ -1,6 +1,7 @@
 #include "InstantaneousTimeMirrorManager.h"
 #include "Modules/Modules.h"
 #include "Initializer/CellLocalMatrices.h"
+#include "Initializer/MemoryManager.h"
 #include "SeisSol.h"
 
 namespace seissol::ITM {
@@ -43,6 +44,11 @@ void InstantaneousTimeMirrorManager::syncPoint(double currentTime) {
   updateVelocities();
 
   logInfo(rank) << "Updating CellLocalMatrices";
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  // the scaled materials get new entries in the table of the material-dependent parts
+  initializers::initializeCellMatrixTable(
+      ltsTree, lts, seissol::SeisSol::main.getMemoryManager().getCellMatrixTable());
+#endif
   initializers::initializeCellLocalMatrices(
       *meshReader, ltsTree, lts, ltsLut, *timestepping); // An empty timestepping is added. Need to
                                                          // discuss what exactly is to be sent here
@@ -7,6 +7,7 @@
 #include "Initializer/InputParameters.hpp"
 #include "Initializer/preProcessorMacros.hpp"
 #include <cstring>
+#include <limits>
 #include <generated_code/tensor.h>
 
 namespace seissol::writer {
@@ -29,6 +30,13 @@ double& EnergiesStorage::plasticMoment() { return energies[7]; }
 
 double& EnergiesStorage::seismicMoment() { return energies[8]; }
 
+EnergiesStorage& EnergiesStorage::operator+=(const EnergiesStorage& other) {
+  for (std::size_t i = 0; i < energies.size(); ++i) {
+    energies[i] += other.energies[i];
+  }
+  return *this;
+}
+
 void EnergyOutput::init(
     GlobalData* newGlobal,
     seissol::initializers::DynamicRupture* newDynRup,
@@ -62,6 +70,47 @@ void EnergyOutput::init(
   ltsLut = newLtsLut;
 
   isPlasticityEnabled = newIsPlasticityEnabled;
+  gravitationalAcceleration = SeisSol::main.getGravitationSetup().acceleration;
+
+  constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
+  constexpr auto numQuadraturePointsTet = quadPolyDegree * quadPolyDegree * quadPolyDegree;
+  double quadraturePointsTet[numQuadraturePointsTet][3];
+  quadratureWeightsTet.resize(numQuadraturePointsTet);
+  seissol::quadrature::TetrahedronQuadrature(
+      quadraturePointsTet, quadratureWeightsTet.data(), quadPolyDegree);
+
+  constexpr auto numQuadraturePointsTri = quadPolyDegree * quadPolyDegree;
+  double quadraturePointsTri[numQuadraturePointsTri][2];
+  quadratureWeightsTri.resize(numQuadraturePointsTri);
+  seissol::quadrature::TriangleQuadrature(
+      quadraturePointsTri, quadratureWeightsTri.data(), quadPolyDegree);
+
+  isFusedAccumulationEnabled = parameters.fusedAccumulation;
+#ifdef ACL_DEVICE
+  if (isFusedAccumulationEnabled) {
+    logWarning(rank) << "The fused energy accumulation is not supported on GPUs; the energies are "
+                        "computed at each output.";
+    isFusedAccumulationEnabled = false;
+  }
+#endif
+  if (isFusedAccumulationEnabled) {
+    logInfo(rank) << "Energies are accumulated during the time step before each output.";
+    const auto mask = lts->dofs.mask;
+    const unsigned* ltsToMesh = ltsLut->getLtsToMeshLut(mask);
+    meshIds.resize(ltsTree->getNumberOfCells(mask));
+    std::size_t offset = 0;
+    for (auto it = ltsTree->beginLeaf(mask); it != ltsTree->endLeaf(); ++it) {
+      layerOffsets[&(*it)] = offset;
+      for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
+        const auto meshId = ltsToMesh[offset + cell];
+        // Only the first duplicate of a cell contributes, as in computeVolumeEnergies
+        const bool isPrimary = meshId != std::numeric_limits<unsigned>::max() &&
+                               ltsLut->ltsId(mask, meshId) == offset + cell;
+        meshIds[offset + cell] = isPrimary ? meshId : std::numeric_limits<unsigned>::max();
+      }
+      offset += it->getNumberOfCells();
+    }
+  }
 
   Modules::registerHook(*this, SIMULATION_START);
   Modules::registerHook(*this, SYNCHRONIZATION_POINT);
@@ -72,7 +121,20 @@ void EnergyOutput::syncPoint(double time) {
   assert(isEnabled);
   const auto rank = MPI::mpi.rank();
   logInfo(rank) << "Writing energy output at time" << time;
-  computeEnergies();
+  {
+    std::lock_guard lock(accumulationMutex);
+    // The accumulated energies belong to the scheduled output time; forced outputs at other
+    // times (e.g. at the end of the simulation) sweep the mesh
+    const bool isScheduled =
+        std::abs(time - nextSyncPoint()) < SeisSol::main.timeManager().getTimeTolerance();
+    if (hasAccumulatedEnergies && isScheduled) {
+      energiesStorage = accumulatedEnergies;
+    } else {
+      computeEnergies();
+    }
+    accumulatedEnergies = EnergiesStorage{};
+    hasAccumulatedEnergies = false;
+  }
   reduceEnergies();
   if (isTerminalOutputEnabled) {
     printEnergies();
@@ -96,7 +158,7 @@ real EnergyOutput::computeStaticWork(const real* degreesOfFreedomPlus,
                                      const real* degreesOfFreedomMinus,
                                      const DRFaceInformation& faceInfo,
                                      const DRGodunovData& godunovData,
-                                     const real slip[seissol::tensor::slipInterpolated::size()]) {
+                                     const real slip[seissol::tensor::slipInterpolated::size()]) const {
   real points[NUMBER_OF_SPACE_QUADRATURE_POINTS][2];
   alignas(ALIGNMENT) real spaceWeights[NUMBER_OF_SPACE_QUADRATURE_POINTS];
   seissol::quadrature::TriangleQuadrature(points, spaceWeights, CONVERGENCE_ORDER + 1);
@@ -146,10 +208,36 @@ real EnergyOutput::computeStaticWork(const real* degreesOfFreedomPlus,
   return staticFrictionalWork;
 }
 
+void EnergyOutput::addFaceEnergies(const real* degreesOfFreedomPlus,
+                                   const real* degreesOfFreedomMinus,
+                                   const DRFaceInformation& faceInfo,
+                                   const DRGodunovData& godunovData,
+                                   const DREnergyOutput& drEnergyOutput,
+                                   const seissol::model::IsotropicWaveSpeeds& waveSpeedsPlus,
+                                   const seissol::model::IsotropicWaveSpeeds& waveSpeedsMinus,
+                                   EnergiesStorage& energies) const {
+  for (unsigned j = 0; j < seissol::dr::misc::numberOfBoundaryGaussPoints; ++j) {
+    energies.totalFrictionalWork() += drEnergyOutput.frictionalEnergy[j];
+  }
+  energies.staticFrictionalWork() += computeStaticWork(
+      degreesOfFreedomPlus, degreesOfFreedomMinus, faceInfo, godunovData, drEnergyOutput.slip);
+
+  const real muPlus =
+      waveSpeedsPlus.density * waveSpeedsPlus.sWaveVelocity * waveSpeedsPlus.sWaveVelocity;
+  const real muMinus =
+      waveSpeedsMinus.density * waveSpeedsMinus.sWaveVelocity * waveSpeedsMinus.sWaveVelocity;
+  const real mu = muPlus * muMinus / (muPlus + muMinus);
+  real seismicMomentIncrease = 0.0;
+  for (unsigned k = 0; k < seissol::dr::misc::numberOfBoundaryGaussPoints; ++k) {
+    seismicMomentIncrease += drEnergyOutput.accumulatedSlip[k];
+  }
+  seismicMomentIncrease *=
+      godunovData.doubledSurfaceArea * mu / seissol::dr::misc::numberOfBoundaryGaussPoints;
+  energies.seismicMoment() += seismicMomentIncrease;
+}
+
 void EnergyOutput::computeDynamicRuptureEnergies() {
-  double& totalFrictionalWork = energiesStorage.totalFrictionalWork();
-  double& staticFrictionalWork = energiesStorage.staticFrictionalWork();
-  double& seismicMoment = energiesStorage.seismicMoment();
+  EnergiesStorage energies{};
 #ifdef ACL_DEVICE
   unsigned maxCells = 0;
   for (auto it = dynRupTree->beginLeaf(); it != dynRupTree->endLeaf(); ++it) {
@@ -211,8 +299,7 @@ void EnergyOutput::computeDynamicRuptureEnergies() {
     seissol::model::IsotropicWaveSpeeds* waveSpeedsMinus = it->var(dynRup->waveSpeedsMinus);
 
 #if defined(_OPENMP) && !NVHPC_AVOID_OMP
-#pragma omp parallel for reduction(                                                                \
-        + : totalFrictionalWork, staticFrictionalWork, seismicMoment) default(none)                \
+#pragma omp parallel for reduction(energiesSum : energies) default(none)                           \
     shared(it,                                                                                     \
                drEnergyOutput,                                                                     \
                faceInformation,                                                                    \
@@ -224,27 +311,14 @@ void EnergyOutput::computeDynamicRuptureEnergies() {
 #endif
     for (unsigned i = 0; i < it->getNumberOfCells(); ++i) {
       if (faceInformation[i].plusSideOnThisRank) {
-        for (unsigned j = 0; j < seissol::dr::misc::numberOfBoundaryGaussPoints; ++j) {
-          totalFrictionalWork += drEnergyOutput[i].frictionalEnergy[j];
-        }
-        staticFrictionalWork += computeStaticWork(timeDerivativePlusPtr(i),
-                                                  timeDerivativeMinusPtr(i),
-                                                  faceInformation[i],
-                                                  godunovData[i],
-                                                  drEnergyOutput[i].slip);
-
-        real muPlus = waveSpeedsPlus[i].density * waveSpeedsPlus[i].sWaveVelocity *
-                      waveSpeedsPlus[i].sWaveVelocity;
-        real muMinus = waveSpeedsMinus[i].density * waveSpeedsMinus[i].sWaveVelocity *
-                       waveSpeedsMinus[i].sWaveVelocity;
-        real mu = muPlus * muMinus / (muPlus + muMinus);
-        real seismicMomentIncrease = 0.0;
-        for (unsigned k = 0; k < seissol::dr::misc::numberOfBoundaryGaussPoints; ++k) {
-          seismicMomentIncrease += drEnergyOutput[i].accumulatedSlip[k];
-        }
-        seismicMomentIncrease *=
-            godunovData[i].doubledSurfaceArea * mu / seissol::dr::misc::numberOfBoundaryGaussPoints;
-        seismicMoment += seismicMomentIncrease;
+        addFaceEnergies(timeDerivativePlusPtr(i),
+                        timeDerivativeMinusPtr(i),
+                        faceInformation[i],
+                        godunovData[i],
+                        drEnergyOutput[i],
+                        waveSpeedsPlus[i],
+                        waveSpeedsMinus[i],
+                        energies);
       }
     }
   }
@@ -252,182 +326,221 @@ void EnergyOutput::computeDynamicRuptureEnergies() {
   device::DeviceInstance::getInstance().api->freePinnedMem(timeDerivativePlusHost);
   device::DeviceInstance::getInstance().api->freePinnedMem(timeDerivativeMinusHost);
 #endif
+  energiesStorage += energies;
 }
 
-void EnergyOutput::computeVolumeEnergies() {
-  auto& totalGravitationalEnergyLocal = energiesStorage.gravitationalEnergy();
-  auto& totalAcousticEnergyLocal = energiesStorage.acousticEnergy();
-  auto& totalAcousticKineticEnergyLocal = energiesStorage.acousticKineticEnergy();
-  auto& totalElasticEnergyLocal = energiesStorage.elasticEnergy();
-  auto& totalElasticKineticEnergyLocal = energiesStorage.elasticKineticEnergy();
-  auto& totalPlasticMoment = energiesStorage.plasticMoment();
+void EnergyOutput::addElementEnergies(unsigned elementId, EnergiesStorage& energies) const {
+  auto& totalGravitationalEnergyLocal = energies.gravitationalEnergy();
+  auto& totalAcousticEnergyLocal = energies.acousticEnergy();
+  auto& totalAcousticKineticEnergyLocal = energies.acousticKineticEnergy();
+  auto& totalElasticEnergyLocal = energies.elasticEnergy();
+  auto& totalElasticKineticEnergyLocal = energies.elasticKineticEnergy();
+  auto& totalPlasticMoment = energies.plasticMoment();
 
   std::vector<Element> const& elements = meshReader->getElements();
   std::vector<Vertex> const& vertices = meshReader->getVertices();
 
-  const auto g = SeisSol::main.getGravitationSetup().acceleration;
-
-  // Note: Default(none) is not possible, clang requires data sharing attribute for g, gcc forbids
-  // it
-#if defined(_OPENMP) && !NVHPC_AVOID_OMP
-#pragma omp parallel for schedule(static) reduction(+ : totalGravitationalEnergyLocal,             \
-                                                        totalAcousticEnergyLocal,                  \
-                                                        totalAcousticKineticEnergyLocal,           \
-                                                        totalElasticEnergyLocal,                   \
-                                                        totalElasticKineticEnergyLocal,            \
-                                                        totalPlasticMoment)                        \
-    shared(elements, vertices, lts, ltsLut, global)
-#endif
-  for (std::size_t elementId = 0; elementId < elements.size(); ++elementId) {
-    real volume = MeshTools::volume(elements[elementId], vertices);
-    CellMaterialData& material = ltsLut->lookup(lts->material, elementId);
+  const real volume = MeshTools::volume(elements[elementId], vertices);
+  const CellMaterialData& material = ltsLut->lookup(lts->material, elementId);
 #if defined(USE_ELASTIC) || defined(USE_VISCOELASTIC2)
-    auto& cellInformation = ltsLut->lookup(lts->cellInformation, elementId);
-    auto& faceDisplacements = ltsLut->lookup(lts->faceDisplacements, elementId);
-
-    constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
-    constexpr auto numQuadraturePointsTet = quadPolyDegree * quadPolyDegree * quadPolyDegree;
-
-    double quadraturePointsTet[numQuadraturePointsTet][3];
-    double quadratureWeightsTet[numQuadraturePointsTet];
-    seissol::quadrature::TetrahedronQuadrature(
-        quadraturePointsTet, quadratureWeightsTet, quadPolyDegree);
-
-    constexpr auto numQuadraturePointsTri = quadPolyDegree * quadPolyDegree;
-    double quadraturePointsTri[numQuadraturePointsTri][2];
-    double quadratureWeightsTri[numQuadraturePointsTri];
-    seissol::quadrature::TriangleQuadrature(
-        quadraturePointsTri, quadratureWeightsTri, quadPolyDegree);
-
-    // Needed to weight the integral.
-    const auto jacobiDet = 6 * volume;
-
-    alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
-    auto numericalSolution = init::dofsQP::view::create(numericalSolutionData);
-    // Evaluate numerical solution at quad. nodes
-    kernel::evalAtQP krnl;
-    krnl.evalAtQP = global->evalAtQPMatrix;
-    krnl.dofsQP = numericalSolutionData;
-    krnl.Q = ltsLut->lookup(lts->dofs, elementId);
-    krnl.execute();
+  auto& cellInformation = ltsLut->lookup(lts->cellInformation, elementId);
+  auto& faceDisplacements = ltsLut->lookup(lts->faceDisplacements, elementId);
+
+  constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
+  constexpr auto numQuadraturePointsTet = quadPolyDegree * quadPolyDegree * quadPolyDegree;
+  constexpr auto numQuadraturePointsTri = quadPolyDegree * quadPolyDegree;
+
+  // Needed to weight the integral.
+  const auto jacobiDet = 6 * volume;
+
+  alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
+  auto numericalSolution = init::dofsQP::view::create(numericalSolutionData);
+  // Evaluate numerical solution at quad. nodes
+  kernel::evalAtQP krnl;
+  krnl.evalAtQP = global->evalAtQPMatrix;
+  krnl.dofsQP = numericalSolutionData;
+  krnl.Q = ltsLut->lookup(lts->dofs, elementId);
+  krnl.execute();
 
 #ifdef MULTIPLE_SIMULATIONS
-    auto numSub = numericalSolution.subtensor(sim, yateto::slice<>(), yateto::slice<>());
+  auto numSub = numericalSolution.subtensor(sim, yateto::slice<>(), yateto::slice<>());
 #else
-    auto numSub = numericalSolution;
+  auto numSub = numericalSolution;
 #endif
-    for (size_t qp = 0; qp < numQuadraturePointsTet; ++qp) {
-      constexpr int uIdx = 6;
-      const auto curWeight = jacobiDet * quadratureWeightsTet[qp];
-      const auto rho = material.local.rho;
-
-      const auto u = numSub(qp, uIdx + 0);
-      const auto v = numSub(qp, uIdx + 1);
-      const auto w = numSub(qp, uIdx + 2);
-      const double curKineticEnergy = 0.5 * rho * (u * u + v * v + w * w);
-
-      if (std::abs(material.local.mu) < 10e-14) {
-        // Acoustic
-        constexpr int pIdx = 0;
-        const auto K = material.local.lambda;
-        const auto p = numSub(qp, pIdx);
-
-        const double curAcousticEnergy = (p * p) / (2 * K);
-        totalAcousticEnergyLocal += curWeight * curAcousticEnergy;
-        totalAcousticKineticEnergyLocal += curWeight * curKineticEnergy;
-      } else {
-        // Elastic
-        totalElasticKineticEnergyLocal += curWeight * curKineticEnergy;
-        auto getStressIndex = [](int i, int j) {
-          const static auto lookup =
-              std::array<std::array<int, 3>, 3>{{{0, 3, 5}, {3, 1, 4}, {5, 4, 2}}};
-          return lookup[i][j];
-        };
-        auto getStress = [&](int i, int j) { return numSub(qp, getStressIndex(i, j)); };
-
-        const auto lambda = material.local.lambda;
-        const auto mu = material.local.mu;
-        const auto sumUniaxialStresses = getStress(0, 0) + getStress(1, 1) + getStress(2, 2);
-        auto computeStrain = [&](int i, int j) {
-          double strain = 0.0;
-          const auto factor = -1.0 * (lambda) / (2.0 * mu * (3.0 * lambda + 2.0 * mu));
-          if (i == j) {
-            strain += factor * sumUniaxialStresses;
-          }
-          strain += 1.0 / (2.0 * mu) * getStress(i, j);
-          return strain;
-        };
-        double curElasticEnergy = 0.0;
-        for (int i = 0; i < 3; ++i) {
-          for (int j = 0; j < 3; ++j) {
-            curElasticEnergy += getStress(i, j) * computeStrain(i, j);
-          }
+  for (size_t qp = 0; qp < numQuadraturePointsTet; ++qp) {
+    constexpr int uIdx = 6;
+    const auto curWeight = jacobiDet * quadratureWeightsTet[qp];
+    const auto rho = material.local.rho;
+
+    const auto u = numSub(qp, uIdx + 0);
+    const auto v = numSub(qp, uIdx + 1);
+    const auto w = numSub(qp, uIdx + 2);
+    const double curKineticEnergy = 0.5 * rho * (u * u + v * v + w * w);
+
+    if (std::abs(material.local.mu) < 10e-14) {
+      // Acoustic
+      constexpr int pIdx = 0;
+      const auto K = material.local.lambda;
+      const auto p = numSub(qp, pIdx);
+
+      const double curAcousticEnergy = (p * p) / (2 * K);
+      totalAcousticEnergyLocal += curWeight * curAcousticEnergy;
+      totalAcousticKineticEnergyLocal += curWeight * curKineticEnergy;
+    } else {
+      // Elastic
+      totalElasticKineticEnergyLocal += curWeight * curKineticEnergy;
+      auto getStressIndex = [](int i, int j) {
+        const static auto lookup =
+            std::array<std::array<int, 3>, 3>{{{0, 3, 5}, {3, 1, 4}, {5, 4, 2}}};
+        return lookup[i][j];
+      };
+      auto getStress = [&](int i, int j) { return numSub(qp, getStressIndex(i, j)); };
+
+      const auto lambda = material.local.lambda;
+      const auto mu = material.local.mu;
+      const auto sumUniaxialStresses = getStress(0, 0) + getStress(1, 1) + getStress(2, 2);
+      auto computeStrain = [&](int i, int j) {
+        double strain = 0.0;
+        const auto factor = -1.0 * (lambda) / (2.0 * mu * (3.0 * lambda + 2.0 * mu));
+        if (i == j) {
+          strain += factor * sumUniaxialStresses;
         }
-        totalElasticEnergyLocal += curWeight * 0.5 * curElasticEnergy;
-      }
-    }
-
-    auto* boundaryMappings = ltsLut->lookup(lts->boundaryMapping, elementId);
-    // Compute gravitational energy
-    for (int face = 0; face < 4; ++face) {
-      if (cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity)
-        continue;
-
-      // Displacements are stored in face-aligned coordinate system.
-      // We need to rotate it to the global coordinate system.
-      auto& boundaryMapping = boundaryMappings[face];
-      auto Tinv = init::Tinv::view::create(boundaryMapping.TinvData);
-      alignas(ALIGNMENT)
-          real rotateDisplacementToFaceNormalData[init::displacementRotationMatrix::Size];
-
-      auto rotateDisplacementToFaceNormal =
-          init::displacementRotationMatrix::view::create(rotateDisplacementToFaceNormalData);
+        strain += 1.0 / (2.0 * mu) * getStress(i, j);
+        return strain;
+      };
+      double curElasticEnergy = 0.0;
       for (int i = 0; i < 3; ++i) {
         for (int j = 0; j < 3; ++j) {
-          rotateDisplacementToFaceNormal(i, j) = Tinv(i + 6, j + 6);
+          curElasticEnergy += getStress(i, j) * computeStrain(i, j);
         }
       }
+      totalElasticEnergyLocal += curWeight * 0.5 * curElasticEnergy;
+    }
+  }
 
-      alignas(ALIGNMENT) std::array<real, tensor::rotatedFaceDisplacementAtQuadratureNodes::Size>
-          displQuadData{};
-      const auto* curFaceDisplacementsData = faceDisplacements[face];
-      seissol::kernel::rotateFaceDisplacementsAndEvaluateAtQuadratureNodes evalKrnl;
-      evalKrnl.rotatedFaceDisplacement = curFaceDisplacementsData;
-      evalKrnl.V2nTo2JacobiQuad = init::V2nTo2JacobiQuad::Values;
-      evalKrnl.rotatedFaceDisplacementAtQuadratureNodes = displQuadData.data();
-      evalKrnl.displacementRotationMatrix = rotateDisplacementToFaceNormalData;
-      evalKrnl.execute();
-
-      // Perform quadrature
-      const auto surface = MeshTools::surface(elements[elementId], face, vertices);
-      const auto rho = material.local.rho;
-
-      static_assert(numQuadraturePointsTri ==
-                    init::rotatedFaceDisplacementAtQuadratureNodes::Shape[0]);
-      auto rotatedFaceDisplacement =
-          init::rotatedFaceDisplacementAtQuadratureNodes::view::create(displQuadData.data());
-      for (unsigned i = 0; i < rotatedFaceDisplacement.shape(0); ++i) {
-        // See for example (Saito, Tsunami generation and propagation, 2019) section 3.2.3 for
-        // derivation.
-        const auto displ = rotatedFaceDisplacement(i, 0);
-        const auto curEnergy = 0.5 * rho * g * displ * displ;
-        const auto curWeight = 2.0 * surface * quadratureWeightsTri[i];
-        totalGravitationalEnergyLocal += curWeight * curEnergy;
+  auto* boundaryMappings = ltsLut->lookup(lts->boundaryMapping, elementId);
+  // Compute gravitational energy
+  for (int face = 0; face < 4; ++face) {
+    if (cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity)
+      continue;
+
+    // Displacements are stored in face-aligned coordinate system.
+    // We need to rotate it to the global coordinate system.
+    auto& boundaryMapping = boundaryMappings[face];
+    auto Tinv = init::Tinv::view::create(boundaryMapping.TinvData);
+    alignas(ALIGNMENT)
+        real rotateDisplacementToFaceNormalData[init::displacementRotationMatrix::Size];
+
+    auto rotateDisplacementToFaceNormal =
+        init::displacementRotationMatrix::view::create(rotateDisplacementToFaceNormalData);
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        rotateDisplacementToFaceNormal(i, j) = Tinv(i + 6, j + 6);
       }
     }
+
+    alignas(ALIGNMENT) std::array<real, tensor::rotatedFaceDisplacementAtQuadratureNodes::Size>
+        displQuadData{};
+    const auto* curFaceDisplacementsData = faceDisplacements[face];
+    seissol::kernel::rotateFaceDisplacementsAndEvaluateAtQuadratureNodes evalKrnl;
+    evalKrnl.rotatedFaceDisplacement = curFaceDisplacementsData;
+    evalKrnl.V2nTo2JacobiQuad = init::V2nTo2JacobiQuad::Values;
+    evalKrnl.rotatedFaceDisplacementAtQuadratureNodes = displQuadData.data();
+    evalKrnl.displacementRotationMatrix = rotateDisplacementToFaceNormalData;
+    evalKrnl.execute();
+
+    // Perform quadrature
+    const auto surface = MeshTools::surface(elements[elementId], face, vertices);
+    const auto rho = material.local.rho;
+
+    static_assert(numQuadraturePointsTri ==
+                  init::rotatedFaceDisplacementAtQuadratureNodes::Shape[0]);
+    auto rotatedFaceDisplacement =
+        init::rotatedFaceDisplacementAtQuadratureNodes::view::create(displQuadData.data());
+    for (unsigned i = 0; i < rotatedFaceDisplacement.shape(0); ++i) {
+      // See for example (Saito, Tsunami generation and propagation, 2019) section 3.2.3 for
+      // derivation.
+      const auto displ = rotatedFaceDisplacement(i, 0);
+      const auto curEnergy = 0.5 * rho * gravitationalAcceleration * displ * displ;
+      const auto curWeight = 2.0 * surface * quadratureWeightsTri[i];
+      totalGravitationalEnergyLocal += curWeight * curEnergy;
+    }
+  }
 #endif
 
-    if (isPlasticityEnabled) {
-      // plastic moment
-      real* pstrainCell = ltsLut->lookup(lts->pstrain, elementId);
+  if (isPlasticityEnabled) {
+    // plastic moment
+    real* pstrainCell = ltsLut->lookup(lts->pstrain, elementId);
 #ifdef USE_ANISOTROPIC
-      real mu = (material.local.c44 + material.local.c55 + material.local.c66) / 3.0;
+    real mu = (material.local.c44 + material.local.c55 + material.local.c66) / 3.0;
 #else
-      real mu = material.local.mu;
+    real mu = material.local.mu;
+#endif
+    totalPlasticMoment += mu * volume * pstrainCell[tensor::QStress::size()];
+  }
+}
+
+void EnergyOutput::computeVolumeEnergies() {
+  EnergiesStorage energies{};
+  const auto numberOfElements = meshReader->getElements().size();
+
+#if defined(_OPENMP) && !NVHPC_AVOID_OMP
+#pragma omp parallel for schedule(static) reduction(energiesSum : energies)
 #endif
-      totalPlasticMoment += mu * volume * pstrainCell[tensor::QStress::size()];
+  for (std::size_t elementId = 0; elementId < numberOfElements; ++elementId) {
+    addElementEnergies(elementId, energies);
+  }
+  energiesStorage += energies;
+}
+
+bool EnergyOutput::isAccumulating(double syncTime) const {
+  // Outputs without volume energies only sweep the fault, which is cheap
+  return isEnabled && isFusedAccumulationEnabled && shouldComputeVolumeEnergies() &&
+         std::abs(syncTime - nextSyncPoint()) < SeisSol::main.timeManager().getTimeTolerance();
+}
+
+const unsigned* EnergyOutput::getMeshIds(const seissol::initializers::Layer& layer) const {
+  const auto offset = layerOffsets.find(&layer);
+  assert(offset != layerOffsets.end());
+  return meshIds.data() + offset->second;
+}
+
+#ifndef ACL_DEVICE
+void EnergyOutput::accumulateDynamicRuptureEnergies(seissol::initializers::Layer& layer,
+                                                    unsigned begin,
+                                                    unsigned numberOfFaces) {
+  real** timeDerivativePlus = layer.var(dynRup->timeDerivativePlus);
+  real** timeDerivativeMinus = layer.var(dynRup->timeDerivativeMinus);
+  DRGodunovData* godunovData = layer.var(dynRup->godunovData);
+  DRFaceInformation* faceInformation = layer.var(dynRup->faceInformation);
+  DREnergyOutput* drEnergyOutput = layer.var(dynRup->drEnergyOutput);
+  seissol::model::IsotropicWaveSpeeds* waveSpeedsPlus = layer.var(dynRup->waveSpeedsPlus);
+  seissol::model::IsotropicWaveSpeeds* waveSpeedsMinus = layer.var(dynRup->waveSpeedsMinus);
+
+  EnergiesStorage energies{};
+#if defined(_OPENMP) && !NVHPC_AVOID_OMP
+#pragma omp parallel for schedule(static) reduction(energiesSum : energies)
+#endif
+  for (unsigned i = begin; i < begin + numberOfFaces; ++i) {
+    if (faceInformation[i].plusSideOnThisRank) {
+      addFaceEnergies(timeDerivativePlus[i],
+                      timeDerivativeMinus[i],
+                      faceInformation[i],
+                      godunovData[i],
+                      drEnergyOutput[i],
+                      waveSpeedsPlus[i],
+                      waveSpeedsMinus[i],
+                      energies);
     }
   }
+  addAccumulatedEnergies(energies);
+}
+#endif
+
+void EnergyOutput::addAccumulatedEnergies(const EnergiesStorage& energies) {
+  std::lock_guard lock(accumulationMutex);
+  accumulatedEnergies += energies;
+  hasAccumulatedEnergies = true;
 }
 
 void EnergyOutput::computeEnergies() {
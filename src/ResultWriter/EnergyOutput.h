@@ -5,6 +5,9 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include <Initializer/typedefs.hpp>
 #include <Initializer/DynamicRupture.h>
@@ -39,6 +42,8 @@ struct EnergiesStorage {
   double& plasticMoment();
 
   double& seismicMoment();
+
+  EnergiesStorage& operator+=(const EnergiesStorage& other);
 };
 
 class EnergyOutput : public Module {
@@ -58,12 +63,57 @@ class EnergyOutput : public Module {
 
   void simulationStart() override;
 
+  /**
+   * In-loop accumulation: Instead of sweeping the mesh at the output, the time clusters add the
+   * energies of their cells and faces during the last time step before the output, while the
+   * data is still in cache. Only outputs which include the volume energies (see
+   * computeVolumeEnergiesEveryOutput) are accumulated.
+   *
+   * @return True if the energies are accumulated for the sync point at syncTime
+   */
+  bool isAccumulating(double syncTime) const;
+
+  /**
+   * @return The mesh ids of the cells of a copy or interior layer. Duplicated cells are marked
+   *  with std::numeric_limits<unsigned>::max(), such that they are only accumulated once.
+   */
+  const unsigned* getMeshIds(const seissol::initializers::Layer& layer) const;
+
+  /**
+   * Adds the volume energies of one element (with updated degrees of freedom)
+   */
+  void addElementEnergies(unsigned elementId, EnergiesStorage& energies) const;
+
+#ifndef ACL_DEVICE
+  /**
+   * Adds the energies of the faces [begin, begin + numberOfFaces) of a dynamic rupture layer
+   * to the accumulated energies. Call this after the friction law.
+   */
+  void accumulateDynamicRuptureEnergies(seissol::initializers::Layer& layer,
+                                        unsigned begin,
+                                        unsigned numberOfFaces);
+#endif
+
+  /**
+   * Adds energies to the accumulated energies. Thread-safe.
+   */
+  void addAccumulatedEnergies(const EnergiesStorage& energies);
+
   private:
   real computeStaticWork(const real* degreesOfFreedomPlus,
                          const real* degreesOfFreedomMinus,
                          DRFaceInformation const& faceInfo,
                          DRGodunovData const& godunovData,
-                         const real slip[seissol::tensor::slipInterpolated::size()]);
+                         const real slip[seissol::tensor::slipInterpolated::size()]) const;
+
+  void addFaceEnergies(const real* degreesOfFreedomPlus,
+                       const real* degreesOfFreedomMinus,
+                       const DRFaceInformation& faceInfo,
+                       const DRGodunovData& godunovData,
+                       const DREnergyOutput& drEnergyOutput,
+                       const seissol::model::IsotropicWaveSpeeds& waveSpeedsPlus,
+                       const seissol::model::IsotropicWaveSpeeds& waveSpeedsMinus,
+                       EnergiesStorage& energies) const;
 
   void computeDynamicRuptureEnergies();
 
@@ -100,8 +150,26 @@ class EnergyOutput : public Module {
   seissol::initializers::Lut* ltsLut = nullptr;
 
   EnergiesStorage energiesStorage{};
+
+  bool isFusedAccumulationEnabled = false;
+  double gravitationalAcceleration = 0.0;
+
+  std::vector<double> quadratureWeightsTet;
+  std::vector<double> quadratureWeightsTri;
+
+  /** Mesh ids of the copy and interior cells, ordered by the LTS tree */
+  std::vector<unsigned> meshIds;
+  std::unordered_map<const seissol::initializers::Layer*, std::size_t> layerOffsets;
+
+  std::mutex accumulationMutex;
+  EnergiesStorage accumulatedEnergies{};
+  bool hasAccumulatedEnergies = false;
 };
 
 } // namespace seissol::writer
 
+#ifdef _OPENMP
+#pragma omp declare reduction(energiesSum:seissol::writer::EnergiesStorage : omp_out += omp_in)
+#endif
+
 #endif // ENERGYOUTPUT_H
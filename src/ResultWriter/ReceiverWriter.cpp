@@ -52,7 +52,17 @@
 #include <string>
 #include <fstream>
 #include <regex>
+#include <cstring>
 #include "Initializer/InputParameters.hpp"
+#include "SeisSol.h"
+
+namespace {
+template <typename T>
+void appendBytes(std::vector<char>& buffer, const T& value) {
+  const auto* bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+} // namespace
 
 Eigen::Vector3d seissol::writer::parseReceiverLine(const std::string& line) {
   std::regex rgx("\\s+");
@@ -99,10 +109,7 @@ std::string seissol::writer::ReceiverWriter::fileName(unsigned pointId) const {
   return fns.str();
 }
 
-void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointId,
-                                                   Eigen::Vector3d const& point   ) {
-  auto name = fileName(pointId);
-
+std::vector<std::string> seissol::writer::ReceiverWriter::columnNames() const {
   std::vector<std::string> names({"xx", "yy", "zz", "xy", "yz", "xz", "v1", "v2", "v3"});
 #ifdef USE_POROELASTIC
   std::array<std::string, 4> additionalNames({"p", "v1_f", "v2_f", "v3_f"});
@@ -113,6 +120,24 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
     names.insert(names.end(), rotationNames.begin(), rotationNames.end());
   }
 
+  std::vector<std::string> columns({"Time"});
+#ifdef MULTIPLE_SIMULATIONS
+  for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
+    for (auto const& name : names) {
+      columns.push_back(name + std::to_string(sim));
+    }
+  }
+#else
+  columns.insert(columns.end(), names.begin(), names.end());
+#endif
+  return columns;
+}
+
+void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointId,
+                                                   Eigen::Vector3d const& point   ) {
+  auto name = fileName(pointId);
+  const auto columns = columnNames();
+
   /// \todo Find a nicer solution that is not so hard-coded.
   struct stat fileStat;
   // Write header if file does not exist
@@ -120,18 +145,10 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
     std::ofstream file;
     file.open(name);
     file << "TITLE = \"Temporal Signal for receiver number " << std::setfill('0') << std::setw(5) << (pointId+1) << "\"" << std::endl;
-    file << "VARIABLES = \"Time\"";
-#ifdef MULTIPLE_SIMULATIONS
-    for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-      for (auto const& name : names) {
-        file << ",\"" << name << sim << "\"";
-      }
-    }
-#else
-    for (auto const& name : names) {
-      file << ",\"" << name << "\"";
+    file << "VARIABLES = \"" << columns[0] << "\"";
+    for (size_t i = 1; i < columns.size(); ++i) {
+      file << ",\"" << columns[i] << "\"";
     }
-#endif
     file << std::endl;
     for (int d = 0; d < 3; ++d) {
       file << "# x" << (d+1) << "       " << std::scientific << std::setprecision(12) << point[d] << std::endl;
@@ -140,6 +157,20 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
   }
 }
 
+void seissol::writer::ReceiverWriter::setUp() {
+  setExecutor(m_executor);
+
+  if (isAffinityNecessary()) {
+    const auto freeCpus = SeisSol::main.getPinning().getFreeCPUsMask();
+    logInfo(seissol::MPI::mpi.rank()) << "Receiver writer thread affinity:"
+      << parallel::Pinning::maskToString(freeCpus);
+    if (parallel::Pinning::freeCPUsMaskEmpty(freeCpus)) {
+      logError() << "There are no free CPUs left. Make sure to leave one for the I/O thread(s).";
+    }
+    setAffinityIfNecessary(freeCpus);
+  }
+}
+
 void seissol::writer::ReceiverWriter::syncPoint(double)
 {
   if (m_receiverClusters.empty()) {
@@ -148,6 +179,18 @@ void seissol::writer::ReceiverWriter::syncPoint(double)
 
   m_stopwatch.start();
 
+  if (m_binaryEnabled) {
+    writeBinary();
+  } else {
+    writeAscii();
+  }
+
+  auto time = m_stopwatch.stop();
+  int const rank = seissol::MPI::mpi.rank();
+  logInfo(rank) << "Wrote receivers in" << time << "seconds.";
+}
+
+void seissol::writer::ReceiverWriter::writeAscii() {
   for (auto& [layer, clusters] : m_receiverClusters) {
     for (auto& cluster : clusters) {
       auto ncols = cluster.ncols();
@@ -169,17 +212,156 @@ void seissol::writer::ReceiverWriter::syncPoint(double)
       }
     }
   }
+}
 
-  auto time = m_stopwatch.stop();
-  int const rank = seissol::MPI::mpi.rank();
-  logInfo(rank) << "Wrote receivers in" << time << "seconds.";
+void seissol::writer::ReceiverWriter::initBinary() {
+  async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>::init();
+  m_binaryEnabled = true;
+
+  // Fix the order of the receivers in the file
+  m_binaryReceivers.clear();
+  for (auto layer : {Interior, Copy}) {
+    for (auto& cluster : m_receiverClusters[layer]) {
+      for (auto& receiver : cluster) {
+        m_binaryReceivers.push_back(&receiver);
+      }
+    }
+  }
+
+  const auto columns = columnNames();
+  const std::size_t sampleBytes = columns.size() * sizeof(realAcc);
+
+  std::vector<char> header;
+  std::size_t chunkBytes = 0;
+  if (!m_binaryReceivers.empty()) {
+    header.insert(header.end(), ReceiverBinaryFormat::Magic, ReceiverBinaryFormat::Magic + sizeof(ReceiverBinaryFormat::Magic));
+    appendBytes(header, ReceiverBinaryFormat::Version);
+    appendBytes(header, static_cast<std::uint64_t>(sizeof(realAcc)));
+    appendBytes(header, static_cast<std::uint64_t>(m_binaryReceivers.size()));
+    appendBytes(header, static_cast<std::uint64_t>(columns.size()));
+    for (const auto& column : columns) {
+      char name[ReceiverBinaryFormat::NameLength] = {};
+      std::strncpy(name, column.c_str(), ReceiverBinaryFormat::NameLength - 1);
+      header.insert(header.end(), name, name + ReceiverBinaryFormat::NameLength);
+    }
+    for (const auto* receiver : m_binaryReceivers) {
+      appendBytes(header, static_cast<std::uint64_t>(receiver->pointId + 1));
+      for (int d = 0; d < 3; ++d) {
+        appendBytes(header, static_cast<double>(receiver->position[d]));
+      }
+    }
+
+    // Enough space for all samples between two synchronization points, as the chunk is written
+    // at once (cf. writeBinary). The receivers reserve one sample less.
+    const std::size_t samplesPerSync = (m_samplingInterval > 0.0) ? static_cast<std::size_t>(syncInterval() / m_samplingInterval) + 2 : 2;
+    chunkBytes = sizeof(std::uint64_t) + m_binaryReceivers.size() * (2 * sizeof(std::uint64_t) + samplesPerSync * sampleBytes);
+  }
+  m_chunkBuffer.resize(chunkBytes);
+
+  std::stringstream fns;
+  fns << m_fileNamePrefix << "-receivers";
+#ifdef PARALLEL
+  fns << "-" << std::setfill('0') << std::setw(5) << seissol::MPI::mpi.rank();
+#endif
+  fns << ".bin";
+  const std::string name = fns.str();
+
+  unsigned int bufferId = addSyncBuffer(name.c_str(), name.size() + 1, true);
+  assert(bufferId == ReceiverWriterExecutor::FILENAME); NDBG_UNUSED(bufferId);
+  bufferId = addSyncBuffer(header.data(), header.size(), true);
+  assert(bufferId == ReceiverWriterExecutor::HEADER);
+  bufferId = addBuffer(m_chunkBuffer.data(), m_chunkBuffer.size());
+  assert(bufferId == ReceiverWriterExecutor::CHUNK);
+
+  sendBuffer(ReceiverWriterExecutor::FILENAME);
+  sendBuffer(ReceiverWriterExecutor::HEADER);
+
+  ReceiverInitParam param;
+  param.rank = seissol::MPI::mpi.rank();
+  callInit(param);
+
+  removeBuffer(ReceiverWriterExecutor::FILENAME);
+  removeBuffer(ReceiverWriterExecutor::HEADER);
 }
+
+void seissol::writer::ReceiverWriter::flushChunk(std::size_t size) {
+  sendBuffer(ReceiverWriterExecutor::CHUNK, size);
+
+  ReceiverParam param;
+  param.size = size;
+  call(param);
+}
+
+void seissol::writer::ReceiverWriter::writeBinary() {
+  // The executor may still be busy with the previous chunk
+  wait();
+
+  // In the asynchronous MPI modes, calling the executor is collective. Hence, every rank writes
+  // exactly one chunk per synchronization point, which is empty if it has no new samples.
+  const std::size_t ncols = columnNames().size();
+  const std::size_t sampleBytes = ncols * sizeof(realAcc);
+  const std::size_t entryBytes = 2 * sizeof(std::uint64_t);
+
+  std::uint64_t numEntries = 0;
+  std::size_t size = sizeof(numEntries);
+  for (const auto* binaryReceiver : m_binaryReceivers) {
+    assert(binaryReceiver->output.size() % ncols == 0);
+    if (!binaryReceiver->output.empty()) {
+      ++numEntries;
+      size += entryBytes + binaryReceiver->output.size() * sizeof(realAcc);
+    }
+  }
+  if (numEntries == 0) {
+    size = 0;
+  }
+  if (size > m_chunkBuffer.size()) {
+    logError() << "The receiver output of one synchronization interval (" << size
+               << "bytes) does not fit into the chunk buffer (" << m_chunkBuffer.size() << "bytes).";
+  }
+
+  // Pack the chunk
+  if (numEntries > 0) {
+    char* chunk = m_chunkBuffer.data();
+    std::memcpy(chunk, &numEntries, sizeof(numEntries));
+    chunk += sizeof(numEntries);
+    for (std::size_t receiver = 0; receiver < m_binaryReceivers.size(); ++receiver) {
+      const auto& output = m_binaryReceivers[receiver]->output;
+      if (!output.empty()) {
+        const std::uint64_t table[2] = {receiver, output.size() / ncols};
+        std::memcpy(chunk, table, sizeof(table));
+        chunk += sizeof(table);
+      }
+    }
+    for (const auto* binaryReceiver : m_binaryReceivers) {
+      const auto& output = binaryReceiver->output;
+      std::memcpy(chunk, output.data(), output.size() / ncols * sampleBytes);
+      chunk += output.size() / ncols * sampleBytes;
+    }
+    assert(static_cast<std::size_t>(chunk - m_chunkBuffer.data()) == size);
+  }
+
+  flushChunk(size);
+
+  for (auto* binaryReceiver : m_binaryReceivers) {
+    binaryReceiver->output.clear();
+  }
+}
+
+void seissol::writer::ReceiverWriter::close() {
+  if (m_binaryEnabled) {
+    wait();
+  }
+
+  finalize();
+}
+
 void seissol::writer::ReceiverWriter::init(const std::string& fileNamePrefix, double endTime, const seissol::initializer::parameters::ReceiverOutputParameters& parameters)
 {
   m_fileNamePrefix = fileNamePrefix;
   m_receiverFileName = parameters.fileName;
   m_samplingInterval = parameters.samplingInterval;
   m_computeRotation = parameters.computeRotation;
+  m_format = parameters.format;
   setSyncInterval(std::min(endTime, parameters.interval));
   Modules::registerHook(*this, SYNCHRONIZATION_POINT);
 }
@@ -230,8 +412,15 @@ void seissol::writer::ReceiverWriter::addPoints(seissol::geometry::MeshReader co
         clusters.emplace_back(global, quantities, m_samplingInterval, syncInterval(), m_computeRotation);
       }
 
-      writeHeader(point, points[point]);
+      if (m_format == seissol::initializer::parameters::ReceiverOutputFormat::Ascii) {
+        writeHeader(point, points[point]);
+      }
       m_receiverClusters[layer][cluster].addReceiver(meshId, point, points[point], mesh, ltsLut, lts);
     }
   }
+
+  if (m_format == seissol::initializer::parameters::ReceiverOutputFormat::Binary) {
+    logInfo(rank) << "Initializing binary receiver output...";
+    initBinary();
+  }
 }
@@ -44,25 +44,34 @@
 #include <string_view>
 
 #include <Eigen/Dense>
+#include <async/Module.h>
 #include "Geometry/MeshReader.h"
 #include "Initializer/tree/Lut.hpp"
 #include "Initializer/LTS.h"
 #include "Kernels/Receiver.h"
 #include "Modules/Module.h"
 #include "Monitoring/Stopwatch.h"
+#include "ReceiverWriterExecutor.h"
 
 struct LocalIntegrationData;
 struct GlobalData;
 namespace seissol::initializer::parameters {
   struct ReceiverOutputParameters;
+  enum class ReceiverOutputFormat : int;
 }
 
 namespace seissol::writer {
     Eigen::Vector3d parseReceiverLine(const std::string& line);
     std::vector<Eigen::Vector3d> parseReceiverFile(const std::string& receiverFileName);
 
-    class ReceiverWriter : public seissol::Module {
+    class ReceiverWriter : private async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>,
+                           public seissol::Module {
     public:
+      /**
+       * Called by ASYNC on all ranks
+       */
+      void setUp();
+
       void init(const std::string& fileNamePrefix, double endTime, const seissol::initializer::parameters::ReceiverOutputParameters& parameters);
 
       void addPoints(
@@ -80,6 +89,12 @@ namespace seissol::writer {
         }
         return nullptr;
       }
+      void close();
+
+      void tearDown() {
+        m_executor.finalize();
+      }
+
       //
       // Hooks
       //
@@ -87,15 +102,32 @@ namespace seissol::writer {
 
     private:
       [[nodiscard]] std::string fileName(unsigned pointId) const;
+      [[nodiscard]] std::vector<std::string> columnNames() const;
       void writeHeader(unsigned pointId, Eigen::Vector3d const& point);
+      void writeAscii();
+
+      /** Sets up the asynchronous module for the binary output (collective) */
+      void initBinary();
+      void writeBinary();
+
+      /** Calls the executor for the first size bytes of the chunk buffer */
+      void flushChunk(std::size_t size);
 
       std::string m_receiverFileName;
       std::string m_fileNamePrefix;
       double      m_samplingInterval;
       bool        m_computeRotation;
+      seissol::initializer::parameters::ReceiverOutputFormat m_format;
       // Map needed because LayerType enum casts weirdly to int.
       std::unordered_map<LayerType, std::vector<kernels::ReceiverCluster>> m_receiverClusters;
       Stopwatch   m_stopwatch;
+
+      /** The asynchronous executor for the binary output */
+      ReceiverWriterExecutor m_executor;
+      bool m_binaryEnabled{false};
+      /** All local receivers in the order of the binary file header */
+      std::vector<kernels::Receiver*> m_binaryReceivers;
+      std::vector<char> m_chunkBuffer;
     };
   }
 
@@ -0,0 +1,54 @@
+#include "ReceiverWriterExecutor.h"
+
+#include <string>
+#include <sys/stat.h>
+
+#include "utils/logger.h"
+
+void seissol::writer::ReceiverWriterExecutor::execInit(const async::ExecInfo& info,
+                                                       const ReceiverInitParam& param) {
+  if (m_file.is_open()) {
+    logError() << "Receiver writer already initialized.";
+  }
+
+  // Ranks without receivers do not create a file
+  if (info.bufferSize(HEADER) == 0) {
+    return;
+  }
+
+  const std::string fileName(static_cast<const char*>(info.buffer(FILENAME)));
+
+  // Keep existing files when restarting from a checkpoint (as for the ASCII output)
+  struct stat fileStat;
+  const bool exists = stat(fileName.c_str(), &fileStat) == 0;
+
+  m_file.open(fileName, std::ios::binary | std::ios::app);
+  if (!m_file) {
+    logError() << "Could not open receiver file" << fileName;
+  }
+  if (!exists) {
+    m_file.write(static_cast<const char*>(info.buffer(HEADER)), info.bufferSize(HEADER));
+    m_file.flush();
+  }
+
+  logDebug(param.rank) << "Initialized binary receiver output" << fileName;
+}
+
+void seissol::writer::ReceiverWriterExecutor::exec(const async::ExecInfo& info,
+                                                   const ReceiverParam& param) {
+  if (!m_file.is_open() || param.size == 0) {
+    return;
+  }
+
+  m_file.write(static_cast<const char*>(info.buffer(CHUNK)), param.size);
+  m_file.flush();
+  if (!m_file) {
+    logError() << "Could not write receiver output.";
+  }
+}
+
+void seissol::writer::ReceiverWriterExecutor::finalize() {
+  if (m_file.is_open()) {
+    m_file.close();
+  }
+}
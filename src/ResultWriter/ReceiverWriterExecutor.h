@@ -0,0 +1,71 @@
+#ifndef RESULTWRITER_RECEIVERWRITEREXECUTOR_H_
+#define RESULTWRITER_RECEIVERWRITEREXECUTOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+
+#include "async/ExecInfo.h"
+
+namespace seissol::writer {
+
+/**
+ * Layout of the binary receiver files (one file per rank, native byte order):
+ *
+ * Header
+ *   char     magic[8]      "SSRECV\0\0"
+ *   uint64_t version
+ *   uint64_t realSize      size of a sample value in bytes (4 or 8)
+ *   uint64_t numReceivers
+ *   uint64_t numColumns    including the time column
+ *   char     names[numColumns][ReceiverBinaryFormat::NameLength]
+ *   numReceivers x { uint64_t receiverNumber; double x, y, z; }
+ *
+ * Chunks (one per synchronization point at which the rank has new samples)
+ *   uint64_t numEntries
+ *   numEntries x { uint64_t receiverIndex; uint64_t numSamples; }
+ *   real     samples[sum(numSamples)][numColumns], ordered as the entries
+ *
+ * The receiverIndex refers to the receiver table in the header. Samples of one
+ * receiver may be spread over several chunks and have to be concatenated in order.
+ */
+struct ReceiverBinaryFormat {
+  static constexpr char Magic[8] = {'S', 'S', 'R', 'E', 'C', 'V', '\0', '\0'};
+  static constexpr std::uint64_t Version = 1;
+  static constexpr std::size_t NameLength = 16;
+};
+
+struct ReceiverInitParam {
+  int rank;
+};
+
+struct ReceiverParam {
+  /** Number of valid bytes in the chunk buffer */
+  std::size_t size;
+};
+
+class ReceiverWriterExecutor {
+  public:
+  enum BufferIds {
+    FILENAME = 0,
+    HEADER = 1,
+    CHUNK = 2,
+  };
+
+  private:
+  std::ofstream m_file;
+
+  public:
+  /**
+   * Opens the receiver file and writes the header if the file does not exist yet
+   */
+  void execInit(const async::ExecInfo& info, const ReceiverInitParam& param);
+
+  void exec(const async::ExecInfo& info, const ReceiverParam& param);
+
+  void finalize();
+};
+
+} // namespace seissol::writer
+
+#endif
@@ -0,0 +1,44 @@
+#include "VertexWeightsWriter.h"
+#include "Parallel/MPI.h"
+#include "Common/filesystem.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include "utils/logger.h"
+
+void seissol::writer::VertexWeightsWriter::write(
+    const initializer::parameters::VertexWeightParameters& configured,
+    double timePerElement,
+    double timePerDynamicRuptureFace) {
+  const int rank = seissol::MPI::mpi.rank();
+  if (timePerElement <= 0.0) {
+    return;
+  }
+
+  auto measured = configured;
+  if (timePerDynamicRuptureFace > 0.0) {
+    // A dynamic rupture face is computed once, but it is added to the weights of both adjacent
+    // elements.
+    measured.weightDynamicRupture = static_cast<int>(std::max(
+        1L,
+        std::lround(0.5 * configured.weightElement * timePerDynamicRuptureFace / timePerElement)));
+  }
+
+  logInfo(rank) << "Vertex weights matching the measured costs: element =" << measured.weightElement
+                << ", dynamic rupture =" << measured.weightDynamicRupture
+                << "(configured:" << configured.weightDynamicRupture << ")";
+
+  if (rank == 0) {
+    seissol::filesystem::path path(outputDirectory);
+    path += seissol::filesystem::path("-vertexWeights.yaml");
+
+    std::fstream fileStream(path, std::ios::out);
+    fileStream << "# vertex weights matching the costs measured in the previous run\n";
+    fileStream << "vertexweightelement: " << measured.weightElement << '\n';
+    fileStream << "vertexweightdynamicrupture: " << measured.weightDynamicRupture << '\n';
+    fileStream << "vertexweightfreesurfacewithgravity: " << measured.weightFreeSurfaceWithGravity
+               << '\n';
+    fileStream.close();
+  }
+}
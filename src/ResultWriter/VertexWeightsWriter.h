@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include "Initializer/InputParameters.hpp"
+
+namespace seissol::writer {
+/**
+ * Writes the vertex weights for the partitioning which match the costs measured during the run.
+ * The file can be passed to the next run (e.g. after a restart) with the parameter vertexWeightFile.
+ */
+class VertexWeightsWriter {
+  public:
+  VertexWeightsWriter(const char* outputDirectory) : outputDirectory(outputDirectory) {}
+
+  /**
+   * @param configured the vertex weights used for this run.
+   * @param timePerElement measured time for one element update.
+   * @param timePerDynamicRuptureFace measured time for one dynamic rupture face update.
+   */
+  void write(const initializer::parameters::VertexWeightParameters& configured,
+             double timePerElement,
+             double timePerDynamicRuptureFace);
+
+  private:
+  std::string outputDirectory;
+};
+} // namespace seissol::writer
@@ -0,0 +1,116 @@
+#include "WaveFieldCompressor.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Parallel/MPI.h"
+#include "utils/logger.h"
+
+namespace seissol::writer {
+
+void WaveFieldCompressor::init(initializer::parameters::WaveFieldCompression compression,
+                               double tolerance) {
+  this->compression = compression;
+  if (isEnabled()) {
+    if (tolerance <= 0.0) {
+      logError() << "The wave field compression tolerance has to be positive, got" << tolerance;
+    }
+    this->tolerance = tolerance;
+  }
+}
+
+const real* WaveFieldCompressor::compress(const real* data, std::size_t size) {
+  if (!isEnabled()) {
+    return data;
+  }
+
+  stopwatch.start();
+
+  buffer.resize(size);
+
+  real maxAbs = 0.0;
+  for (std::size_t i = 0; i < size; ++i) {
+    maxAbs = std::max(maxAbs, std::abs(data[i]));
+  }
+  if (maxAbs == 0.0 || !std::isfinite(maxAbs)) {
+    // nothing to gain for zeros, and a quantum cannot be derived from inf or nan
+    std::copy_n(data, size, buffer.data());
+    numberOfValues += size;
+    numberOfZeros += (maxAbs == 0.0) ? size : 0;
+    time = stopwatch.pause();
+    return buffer.data();
+  }
+
+  // Largest power of two with q / 2 <= tolerance * max |x|, which keeps the quantized values exact
+  const real quantum = std::exp2(std::floor(std::log2(2.0 * tolerance * maxAbs)));
+  minQuantum = std::min(minQuantum, static_cast<double>(quantum));
+  maxQuantum = std::max(maxQuantum, static_cast<double>(quantum));
+
+  const real invQuantum = 1.0 / quantum;
+  unsigned long long zeros = 0;
+  unsigned long long significantBits = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    const real multiple = std::nearbyint(data[i] * invQuantum);
+    buffer[i] = multiple * quantum;
+    if (multiple == 0.0) {
+      ++zeros;
+    } else {
+      // bits of the integer multiple plus the sign bit
+      significantBits += std::ilogb(multiple) + 2;
+    }
+  }
+  numberOfValues += size;
+  numberOfZeros += zeros;
+  numberOfSignificantBits += significantBits;
+
+  time = stopwatch.pause();
+
+  return buffer.data();
+}
+
+void WaveFieldCompressor::printStatistics(
+#ifdef USE_MPI
+    MPI_Comm comm
+#endif // USE_MPI
+) {
+  if (!isEnabled()) {
+    return;
+  }
+
+  int rank = seissol::MPI::mpi.rank();
+#ifdef USE_MPI
+  MPI_Comm_rank(comm, &rank);
+#endif // USE_MPI
+
+  // values, zeros, significant bits
+  unsigned long long counts[3] = {numberOfValues, numberOfZeros, numberOfSignificantBits};
+  double maxTime = time;
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, counts, 3, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+  MPI_Allreduce(MPI_IN_PLACE, &maxTime, 1, MPI_DOUBLE, MPI_MAX, comm);
+#endif // USE_MPI
+
+  if (counts[0] == 0) {
+    return;
+  }
+
+  const double rawBytes = static_cast<double>(counts[0]) * sizeof(real);
+  // Lower bound for the compressed size: the significant bits plus one bit per value
+  // to mark zeros, as approached by a shuffle filter followed by a lossless codec
+  const double estimatedBytes = (static_cast<double>(counts[2]) + counts[0]) / 8.0;
+
+  double quantumRange[2] = {-minQuantum, maxQuantum};
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, quantumRange, 2, MPI_DOUBLE, MPI_MAX, comm);
+#endif // USE_MPI
+
+  logInfo(rank) << "Wave field compression: relative tolerance" << tolerance << ", quantum in ["
+                << -quantumRange[0] << "," << quantumRange[1] << "],"
+                << 100.0 * counts[1] / counts[0] << "% zeros," << static_cast<double>(counts[2]) / (counts[0] - counts[1] + 1e-30)
+                << "significant bits per nonzero value";
+  logInfo(rank) << "Wave field compression:" << rawBytes * 1e-9 << "GB raw, estimated"
+                << estimatedBytes * 1e-9 << "GB compressed (ratio" << rawBytes / estimatedBytes
+                << "), throughput" << rawBytes * 1e-9 / maxTime << "GB/s (slowest rank)";
+}
+
+} // namespace seissol::writer
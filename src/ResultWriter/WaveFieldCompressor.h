@@ -0,0 +1,85 @@
+#ifndef RESULTWRITER_WAVEFIELDCOMPRESSOR_H_
+#define RESULTWRITER_WAVEFIELDCOMPRESSOR_H_
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif // USE_MPI
+
+#include "Initializer/InputParameters.hpp"
+#include "Kernels/precision.hpp"
+#include "Monitoring/Stopwatch.h"
+
+namespace seissol::writer {
+
+/**
+ * Error-bounded quantization of the wave field output, applied in the
+ * executor right before the data is passed to the XDMF writer.
+ *
+ * The tolerance is relative to the largest magnitude of each compressed array,
+ * i.e. of each variable in each output step: every value x is rounded to the
+ * closest multiple of a power-of-two quantum q <= 2 * tolerance * max |x|,
+ * such that |x - Q(x)| <= tolerance * max |x|. Hence, variables of very
+ * different magnitude (e.g. stresses and velocities) keep the same number of
+ * significant bits. The result is still a plain floating point value, but all
+ * mantissa bits below q are zero and values smaller than q/2 become exactly
+ * zero. Hence, the files compress
+ * well with lossless tools (e.g. h5repack with a shuffle and a deflate
+ * or zstd filter) while remaining readable by any XDMF reader.
+ */
+class WaveFieldCompressor {
+  public:
+  void init(initializer::parameters::WaveFieldCompression compression, double tolerance);
+
+  bool isEnabled() const {
+    return compression != initializer::parameters::WaveFieldCompression::None;
+  }
+
+  /**
+   * Returns the quantized copy of data, which is one variable of one output step.
+   * The pointer stays valid until the next call.
+   */
+  const real* compress(const real* data, std::size_t size);
+
+  /**
+   * Prints the accumulated size and throughput statistics.
+   */
+  void printStatistics(
+#ifdef USE_MPI
+      MPI_Comm comm
+#endif // USE_MPI
+  );
+
+  private:
+  initializer::parameters::WaveFieldCompression compression =
+      initializer::parameters::WaveFieldCompression::None;
+
+  double tolerance = 0.0;
+
+  std::vector<real> buffer;
+
+  /** Number of processed values */
+  unsigned long long numberOfValues = 0;
+
+  /** Number of values which were quantized to zero */
+  unsigned long long numberOfZeros = 0;
+
+  /** Sum of the significant bits (including the sign) of all nonzero quantized values */
+  unsigned long long numberOfSignificantBits = 0;
+
+  Stopwatch stopwatch;
+
+  /** Smallest and largest quantum used so far */
+  double minQuantum = std::numeric_limits<double>::infinity();
+  double maxQuantum = 0.0;
+
+  /** Time spent in the quantization */
+  double time = 0.0;
+};
+
+} // namespace seissol::writer
+
+#endif
@@ -181,6 +181,8 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 
   param.backend = backend;
   param.backupTimeStamp = backupTimeStamp;
+  param.compression = parameters.compression;
+  param.compressionTolerance = parameters.compressionTolerance;
 
   //
   // High order I/O
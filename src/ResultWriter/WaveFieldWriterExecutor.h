@@ -53,6 +53,8 @@
 
 #include "Monitoring/Stopwatch.h"
 
+#include "WaveFieldCompressor.h"
+
 namespace seissol
 {
 
@@ -80,6 +82,8 @@ struct WaveFieldInitParam
 	int bufferIds[BUFFERTAG_MAX+1];
 	xdmfwriter::BackendType backend;
 	std::string backupTimeStamp;
+	seissol::initializer::parameters::WaveFieldCompression compression;
+	double compressionTolerance;
 };
 
 struct WaveFieldParam
@@ -116,6 +120,9 @@ private:
 	/** Stopwatch for the wave field backend */
 	Stopwatch m_stopwatch;
 
+	/** Quantization of the variables before they are written */
+	WaveFieldCompressor m_compressor;
+
 public:
 	WaveFieldWriterExecutor()
 		: m_waveFieldWriter(0L),
@@ -142,6 +149,8 @@ public:
 
 		const char* outputPrefix = static_cast<const char*>(info.buffer(param.bufferIds[OUTPUT_PREFIX]));
 
+		m_compressor.init(param.compression, param.compressionTolerance);
+
 		//
 		// High order I/O
 		//
@@ -293,7 +302,8 @@ public:
 		for (unsigned int i = 0; i < m_numVariables; i++) {
 			if (m_outputFlags[i]) {
 				m_waveFieldWriter->writeCellData(nextId,
-					static_cast<const real*>(info.buffer(m_variableBufferIds[0]+nextId)));
+					m_compressor.compress(static_cast<const real*>(info.buffer(m_variableBufferIds[0]+nextId)),
+						info.bufferSize(m_variableBufferIds[0]+nextId) / sizeof(real)));
 
 				nextId++;
 			}
@@ -309,7 +319,8 @@ public:
 		for (unsigned int i = 0; i < NUM_LOWVARIABLES; i++) {
 			if (m_lowOutputFlags[i]) {
 				m_lowWaveFieldWriter->writeCellData(nextId,
-					static_cast<const real*>(info.buffer(m_variableBufferIds[1]+nextId)));
+					m_compressor.compress(static_cast<const real*>(info.buffer(m_variableBufferIds[1]+nextId)),
+						info.bufferSize(m_variableBufferIds[1]+nextId) / sizeof(real)));
 
 			nextId++;
 			}
@@ -330,6 +341,11 @@ public:
 			m_stopwatch.printTime("Time wave field writer backend:"
 #ifdef USE_MPI
 				, m_comm
+#endif // USE_MPI
+			);
+			m_compressor.printStatistics(
+#ifdef USE_MPI
+				m_comm
 #endif // USE_MPI
 			);
 		}
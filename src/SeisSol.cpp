@@ -104,6 +104,7 @@ bool seissol::SeisSol::init(int argc, char* argv[]) {
                 << parallel::Pinning::maskToString(pinning.getNodeMask());
 
   seissol::printCommThreadInfo(MPI::mpi);
+  seissol::printTaskSchedulerInfo(MPI::mpi);
   if (seissol::useCommThread(MPI::mpi)) {
     auto freeCpus = pinning.getFreeCPUsMask();
     logInfo(rank) << "Communication thread affinity        :"
@@ -176,6 +177,8 @@ bool seissol::SeisSol::init(int argc, char* argv[]) {
   m_seissolparameters.readParameters(*m_inputParams);
   m_memoryManager->setInputParams(m_inputParams);
 
+  m_tuningDatabase.load();
+
   return true;
 }
 
@@ -187,6 +190,8 @@ void seissol::SeisSol::finalize() {
 
   m_timeManager.freeDynamicResources();
 
+  m_tuningDatabase.store();
+
   MPI::mpi.finalize();
 
   logInfo(rank) << "SeisSol done. Goodbye.";
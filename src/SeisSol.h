@@ -48,6 +48,7 @@
 #include "utils/logger.h"
 
 #include "Checkpoint/Manager.h"
+#include "Common/TuningDatabase.h"
 #include "Initializer/InputParameters.hpp"
 #include "Initializer/time_stepping/LtsLayout.h"
 #include "Initializer/typedefs.hpp"
@@ -144,6 +145,12 @@ class SeisSol {
    * Get the flop counter
    */
   monitoring::FlopCounter& flopCounter() { return m_flopCounter; }
+
+  /**
+   * Get the database of the auto-tuned parameters
+   */
+  TuningDatabase& tuningDatabase() { return m_tuningDatabase; }
+
   /**
    * Reference for timeMirrorManagers to be accessed externally when required
    */
@@ -285,6 +292,9 @@ class SeisSol {
   //! Flop Counter
   monitoring::FlopCounter m_flopCounter;
 
+  //! Results of the auto-tuned parameters from previous runs
+  TuningDatabase m_tuningDatabase;
+
   std::pair<seissol::ITM::InstantaneousTimeMirrorManager,
             seissol::ITM::InstantaneousTimeMirrorManager>
       timeMirrorManagers;
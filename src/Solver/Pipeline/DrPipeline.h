@@ -38,6 +38,8 @@
  * An implementation of a pipeline.
  *
  * Specification of Dynamic Rupture pipeline.
+ *
+ * The pipeline is used on devices and, optionally, on the host (see TimeCluster).
  **/
 
 #ifndef DR_PIPELINE_H
@@ -46,6 +48,7 @@
 #include <Solver/Pipeline/GenericPipeline.h>
 #include <Solver/Pipeline/DrTuner.h>
 #include <generated_code/tensor.h>
+#include <utility>
 #ifdef ACL_DEVICE
 #include <device.h>
 #endif
@@ -84,6 +87,22 @@ namespace seissol::dr::pipeline {
     device::DeviceInstance &device = device::DeviceInstance::getInstance();
 #endif
   };
+
+  /**
+   * Wraps a function with the signature of PipelineCallBack::operator(), e.g. a lambda of the host
+   * pipeline, into a callback.
+   */
+  template<typename FunctionT>
+  class DrFunctionCallBack : public DrPipeline::PipelineCallBack {
+  public:
+    explicit DrFunctionCallBack(FunctionT function) : function(std::move(function)) {}
+    void operator()(size_t begin, size_t batchSize, size_t callCounter) override {
+      function(begin, batchSize, callCounter);
+    }
+    void finalize() override {}
+  private:
+    FunctionT function;
+  };
 }
 
 
@@ -41,6 +41,7 @@
  **/
 
 #include "DrTuner.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -60,6 +61,17 @@ namespace seissol::dr::pipeline {
     action = Action::BeginRecordingRightEvaluation;
   }
 
+  /**
+   * Uses the batch size of a previous tuning (e.g. from the tuning database) and skips the search.
+   *
+   * @param batchSize converged batch size of a previous run
+   **/
+  void DrPipelineTuner::seed(double batchSize) {
+    currBatchSize = std::max(batchSize, 1.0);
+    action = Action::SkipAction;
+    isConverged = true;
+  }
+
   /**
    * Implements a golden-section search to find a optimal batch size.
    *
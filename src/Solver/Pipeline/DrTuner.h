@@ -52,6 +52,7 @@ namespace seissol::dr::pipeline {
     DrPipelineTuner();
     ~DrPipelineTuner() override = default;
     void tune(const std::array<double, NumStages>& stageTiming) override;
+    void seed(double batchSize);
     [[nodiscard]] bool isTunerConverged() const {return isConverged;}
     [[nodiscard]] double getMaxBatchSize() const {return maxBatchSize;}
     [[nodiscard]] double getMinBatchSize() const {return minBatchSize;}
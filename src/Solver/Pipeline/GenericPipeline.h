@@ -112,6 +112,8 @@ namespace seissol {
       tuner.tune(stageTiming);
     }
 
+    TunerT& getTuner() { return tuner; }
+
   private:
     struct Range {
       Range() = default;
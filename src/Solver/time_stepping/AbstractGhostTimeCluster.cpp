@@ -3,13 +3,47 @@
 
 
 namespace seissol::time_stepping {
+const std::vector<char>& AbstractGhostTimeCluster::testRequests(MPI_Request* requests,
+                                                                const std::list<unsigned int>& regions) {
+  testedRequests.clear();
+  for (const auto region : regions) {
+    testedRequests.push_back(requests[region]);
+  }
+  completedIndices.resize(testedRequests.size());
+  completedFlags.assign(testedRequests.size(), 0);
+
+  int numberOfCompleted = 0;
+  MPI_Testsome(static_cast<int>(testedRequests.size()),
+               testedRequests.data(),
+               &numberOfCompleted,
+               completedIndices.data(),
+               MPI_STATUSES_IGNORE);
+  if (numberOfCompleted == MPI_UNDEFINED) {
+    // No active request left, i.e. all of them completed before
+    completedFlags.assign(testedRequests.size(), 1);
+  } else {
+    for (int i = 0; i < numberOfCompleted; ++i) {
+      completedFlags[completedIndices[i]] = 1;
+    }
+  }
+
+  // Completed non-persistent requests have been set to MPI_REQUEST_NULL
+  std::size_t i = 0;
+  for (const auto region : regions) {
+    requests[region] = testedRequests[i++];
+  }
+  return completedFlags;
+}
+
 bool AbstractGhostTimeCluster::testQueue(MPI_Request* requests,
                                          std::list<unsigned int>& regions) {
-  for (auto region = regions.begin(); region != regions.end();) {
-    MPI_Request *request = &requests[*region];
-    int testSuccess = 0;
-    MPI_Test(request, &testSuccess, MPI_STATUS_IGNORE);
-    if (testSuccess) {
+  if (regions.empty()) {
+    return true;
+  }
+  const auto& completed = testRequests(requests, regions);
+  auto flag = completed.begin();
+  for (auto region = regions.begin(); region != regions.end(); ++flag) {
+    if (*flag) {
       region = regions.erase(region);
     } else {
       ++region;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <list>
+#include <vector>
 #include "Initializer/typedefs.hpp"
 #include "AbstractTimeCluster.h"
 
@@ -15,9 +16,22 @@ class AbstractGhostTimeCluster : public AbstractTimeCluster {
 
   double lastSendTime = -1.0;
 
+  private:
+  //! scratch buffers for testRequests
+  std::vector<MPI_Request> testedRequests;
+  std::vector<int> completedIndices;
+  std::vector<char> completedFlags;
+
+  protected:
+
   virtual void sendCopyLayer() = 0;
   virtual void receiveGhostLayer() = 0;
 
+  /**
+   * Tests the requests of all given regions with a single MPI_Testsome call.
+   * Returns one flag per region (in the order of the list), which is set if the request completed.
+   */
+  const std::vector<char>& testRequests(MPI_Request* requests, const std::list<unsigned int>& regions);
   bool testQueue(MPI_Request* requests, std::list<unsigned int>& regions);
   bool testForCopyLayerSends();
   virtual bool testForGhostLayerReceives() = 0;
@@ -48,10 +48,12 @@ Message MessageQueue::pop() {
 }
 
 bool MessageQueue::hasMessages() const {
+  std::lock_guard lock{mutex};
   return !queue.empty();
 }
 
 size_t MessageQueue::size() const {
+  std::lock_guard lock{mutex};
   return queue.size();
 }
 
@@ -111,5 +113,9 @@ bool DynamicRuptureScheduler::hasDynamicRuptureFaces() const {
 bool DynamicRuptureScheduler::isFirstClusterWithDynamicRuptureFaces() const {
   return firstClusterWithDynamicRuptureFaces;
 }
+
+std::mutex& DynamicRuptureScheduler::getMutex() {
+  return mutex;
+}
 } // namespace seissol::time_stepping
 
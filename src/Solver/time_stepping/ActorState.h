@@ -27,7 +27,7 @@ inline std::ostream& operator<<(std::ostream& stream, const Message& message);
 class MessageQueue {
  private:
   std::queue<Message> queue;
-  std::mutex mutex;
+  mutable std::mutex mutex;
 
  public:
   MessageQueue() = default;
@@ -106,6 +106,7 @@ class DynamicRuptureScheduler {
   long lastFaultOutput = -1;
   long numberOfDynamicRuptureFaces;
   bool firstClusterWithDynamicRuptureFaces;
+  std::mutex mutex;
 
 public:
   DynamicRuptureScheduler(long numberOfDynamicRuptureFaces, bool isFirstDynamicRuptureCluster);
@@ -123,6 +124,9 @@ public:
   [[nodiscard]] bool hasDynamicRuptureFaces() const;
 
   [[nodiscard]] bool isFirstClusterWithDynamicRuptureFaces() const;
+
+  //! Serializes the dynamic rupture work of the copy and interior actors of the cluster
+  std::mutex& getMutex();
 };
 
 struct ActResult {
@@ -146,15 +146,18 @@ void GhostTimeClusterWithCopy<CommType>::receiveGhostLayer() {
 
 template <MPI::DataTransferMode CommType>
 bool GhostTimeClusterWithCopy<CommType>::testReceiveQueue() {
-  for (auto region = receiveQueue.begin(); region != receiveQueue.end();) {
+  if (receiveQueue.empty()) {
+    return true;
+  }
+  // Regions past the MPI testing hold inactive requests, which MPI_Testsome skips
+  const auto& received = testRequests(meshStructure->receiveRequests, receiveQueue);
+  auto receivedFlag = received.begin();
+  for (auto region = receiveQueue.begin(); region != receiveQueue.end(); ++receivedFlag) {
     const auto state = receiveRegionsStates[*region];
 
     switch (state) {
     case ReceiveState::RequiresMpiTesting: {
-      int testSuccess = 0;
-      MPI_Request* request = &(meshStructure->receiveRequests)[*region];
-      MPI_Test(request, &testSuccess, MPI_STATUS_IGNORE);
-      if (testSuccess) {
+      if (*receivedFlag) {
         prefetchGhostRegion(*region);
         receiveRegionsStates[*region] = ReceiveState::RequiresPrefetchTesting;
       }
@@ -40,6 +40,8 @@
 
 #include "MiniSeisSol.h"
 
+#include <algorithm>
+
 #include <Kernels/Time.h>
 #include <Kernels/Local.h>
 #include <Kernels/Touch.h>
@@ -208,8 +210,24 @@ void seissol::fakeData(initializers::LTS& lts,
     localIntegration[cell].specific.typicalTimeStepWidth = miniSeisSolTimeStep;
   }
 #endif
+
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    localIntegration[cell].jacobianId = 0;
+    std::fill_n(localIntegration[cell].fluxSolverIds, 4, 0);
+  }
+#endif
 }
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+void seissol::fakeCellMatrixTable(CellMatrixTable& table) {
+  table.jacobians.resize(1);
+  table.fluxSolvers.resize(1);
+  kernels::fillWithStuff(reinterpret_cast<real*>(table.jacobians.data()), sizeof(CellMatrixTable::Jacobians)/sizeof(real), false);
+  kernels::fillWithStuff(reinterpret_cast<real*>(table.fluxSolvers.data()), sizeof(CellMatrixTable::FluxSolvers)/sizeof(real), false);
+}
+#endif
+
 double seissol::miniSeisSol(initializers::MemoryManager& memoryManager, bool usePlasticity) {
   initializers::LTSTree ltsTree;
   initializers::LTS     lts;
@@ -260,6 +278,14 @@ double seissol::miniSeisSol(initializers::MemoryManager& memoryManager, bool use
   };
 #else
   auto* globalData = memoryManager.getGlobalDataOnHost();
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  // the table of the memory manager is not filled yet
+  CellMatrixTable cellMatrixTable;
+  fakeCellMatrixTable(cellMatrixTable);
+  GlobalData globalDataWithTable = *globalData;
+  globalDataWithTable.cellMatrixTable = &cellMatrixTable;
+  globalData = &globalDataWithTable;
+#endif
   auto runBenchmark = [globalData, &lts, &layer]() {
     localIntegration(globalData, lts, layer);
   };
@@ -55,6 +55,13 @@ namespace seissol {
   void fakeData(initializers::LTS& lts,
                 initializers::Layer& layer,
                 FaceType faceTp = FaceType::regular);
+
+#ifdef USE_COMPRESSED_CELL_MATRICES
+  /**
+   * Fills the table with a single material, which is referenced by all cells of fakeData.
+   **/
+  void fakeCellMatrixTable(CellMatrixTable& table);
+#endif
   
   double miniSeisSol(initializers::MemoryManager& memoryManager, bool usePlasticity);
   constexpr real miniSeisSolTimeStep = 1.0;
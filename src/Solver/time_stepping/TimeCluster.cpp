@@ -84,11 +84,19 @@
 #include <Monitoring/FlopCounter.hpp>
 #include <Monitoring/instrumentation.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <mutex>
 
 #include <generated_code/kernel.h>
 
+namespace {
+// The friction solver, the energy output and the fault output are shared between all actors,
+// which run concurrently when the task scheduler is enabled.
+std::mutex dynamicRuptureMutex;
+} // namespace
+
 seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsigned int i_globalClusterId,
                                                  unsigned int profilingId,
                                                  bool usePlasticity,
@@ -146,12 +154,46 @@ seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsig
   m_neighborKernel.setGlobalData(i_globalData);
   m_dynamicRuptureKernel.setGlobalData(i_globalData);
 
+  const auto* drParameters = seissol::SeisSol::main.getMemoryManager().getDRParameters();
+  if (drParameters != nullptr) {
+    frictionSubSteps = drParameters->frictionSubSteps;
+  }
+
   computeFlops();
 
   m_regionComputeLocalIntegration = m_loopStatistics->getRegion("computeLocalIntegration");
   m_regionComputeNeighboringIntegration = m_loopStatistics->getRegion("computeNeighboringIntegration");
   m_regionComputeDynamicRupture = m_loopStatistics->getRegion("computeDynamicRupture");
   m_regionComputePointSources = m_loopStatistics->getRegion("computePointSources");
+
+#ifndef ACL_DEVICE
+  useDynamicRupturePipeline = drParameters != nullptr && drParameters->isDynamicRuptureEnabled &&
+                              drParameters->hostPipeline;
+  if (useDynamicRupturePipeline) {
+    const CellLocalInformation* cellInformation = m_clusterData->var(m_lts->cellInformation);
+    for (unsigned cell = 0; cell < m_clusterData->getNumberOfCells(); ++cell) {
+      const auto& faceTypes = cellInformation[cell].faceTypes;
+      if (std::find(std::begin(faceTypes), std::end(faceTypes), FaceType::dynamicRupture) != std::end(faceTypes)) {
+        cellsWithDynamicRupture.push_back(cell);
+      } else {
+        cellsWithoutDynamicRupture.push_back(cell);
+      }
+    }
+
+    // Seed the batch size with the result of a previous run on the same configuration
+    std::size_t numberOfFaces = dynRupInteriorData != nullptr ? dynRupInteriorData->getNumberOfCells() : 0;
+    if (layerType == Copy && dynRupCopyData != nullptr) {
+      numberOfFaces += dynRupCopyData->getNumberOfCells();
+    }
+    const auto frictionLaw = "fl" + std::to_string(static_cast<int>(drParameters->frictionLawType)) +
+                             (drParameters->isThermalPressureOn ? "tp" : "");
+    drPipelineTuningKey = TuningDatabase::makeKey("drPipelineBatchSize", frictionLaw, numberOfFaces);
+    if (const auto batchSize = seissol::SeisSol::main.tuningDatabase().get(drPipelineTuningKey)) {
+      drPipeline.getTuner().seed(*batchSize);
+      drPipelineTuningStored = true;
+    }
+  }
+#endif
 }
 
 seissol::time_stepping::TimeCluster::~TimeCluster() {
@@ -204,6 +246,51 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
 
   m_loopStatistics->begin(m_regionComputeDynamicRupture);
 
+  // The friction law may be sub-cycled: Each sub step interpolates the time derivatives of the
+  // whole time step to its own time points, and the imposed states of all sub steps are summed up.
+  for (unsigned subStep = 0; subStep < frictionSubSteps; ++subStep) {
+    if (subStep > 0) {
+      SCOREP_USER_REGION_BEGIN(myRegionHandle, "computeDynamicRuptureSpaceTimeInterpolation", SCOREP_USER_REGION_TYPE_COMMON )
+    }
+    m_dynamicRuptureKernel.setSubTimeStep(timeStepSize(), subStep, frictionSubSteps);
+    frictionSolver->computeDeltaT(m_dynamicRuptureKernel.timePoints);
+
+#pragma omp parallel 
+    {
+    LIKWID_MARKER_START("computeDynamicRuptureSpaceTimeInterpolation");
+    }
+    computeDynamicRuptureSpaceTimeInterpolation(layerData, 0, layerData.getNumberOfCells());
+    SCOREP_USER_REGION_END(myRegionHandle)
+#pragma omp parallel 
+    {
+    LIKWID_MARKER_STOP("computeDynamicRuptureSpaceTimeInterpolation");
+    LIKWID_MARKER_START("computeDynamicRuptureFrictionLaw");
+    }
+
+    SCOREP_USER_REGION_BEGIN(myRegionHandle, "computeDynamicRuptureFrictionLaw", SCOREP_USER_REGION_TYPE_COMMON )
+    frictionSolver->setAccumulateImposedState(subStep > 0);
+    frictionSolver->evaluate(layerData,
+                             m_dynRup,
+                             ct.correctionTime + m_dynamicRuptureKernel.getSubTimeStepStart(),
+                             m_dynamicRuptureKernel.timeWeights);
+    SCOREP_USER_REGION_END(myRegionHandle)
+#pragma omp parallel 
+    {
+    LIKWID_MARKER_STOP("computeDynamicRuptureFrictionLaw");
+    }
+    reportFrictionStatistics(layerData.getNumberOfCells());
+  }
+  frictionSolver->setAccumulateImposedState(false);
+  if (accumulateEnergies) {
+    seissol::SeisSol::main.energyOutput().accumulateDynamicRuptureEnergies(layerData, 0, layerData.getNumberOfCells());
+  }
+
+  m_loopStatistics->end(m_regionComputeDynamicRupture, layerData.getNumberOfCells(), m_profilingId);
+}
+
+void seissol::time_stepping::TimeCluster::computeDynamicRuptureSpaceTimeInterpolation( seissol::initializers::Layer&  layerData,
+                                                                                       unsigned startFace,
+                                                                                       unsigned numberOfFaces ) {
   DRFaceInformation* faceInformation = layerData.var(m_dynRup->faceInformation);
   DRGodunovData* godunovData = layerData.var(m_dynRup->godunovData);
   DREnergyOutput* drEnergyOutput = layerData.var(m_dynRup->drEnergyOutput);
@@ -212,17 +299,10 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
   auto* qInterpolatedPlus = layerData.var(m_dynRup->qInterpolatedPlus);
   auto* qInterpolatedMinus = layerData.var(m_dynRup->qInterpolatedMinus);
 
-  m_dynamicRuptureKernel.setTimeStepWidth(timeStepSize());
-  frictionSolver->computeDeltaT(m_dynamicRuptureKernel.timePoints);
-
-#pragma omp parallel 
-  {
-  LIKWID_MARKER_START("computeDynamicRuptureSpaceTimeInterpolation");
-  }
 #ifdef _OPENMP
   #pragma omp parallel for schedule(static)
 #endif
-  for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
+  for (unsigned face = startFace; face < startFace + numberOfFaces; ++face) {
     unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
     m_dynamicRuptureKernel.spaceTimeInterpolation(faceInformation[face],
                                                   m_globalDataOnHost,
@@ -235,25 +315,100 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
                                                   timeDerivativePlus[prefetchFace],
                                                   timeDerivativeMinus[prefetchFace]);
   }
-  SCOREP_USER_REGION_END(myRegionHandle)
-#pragma omp parallel 
-  {
-  LIKWID_MARKER_STOP("computeDynamicRuptureSpaceTimeInterpolation");
-  LIKWID_MARKER_START("computeDynamicRuptureFrictionLaw");
+}
+
+void seissol::time_stepping::TimeCluster::computeDynamicRuptureWithPipeline( seissol::initializers::Layer* const (&layers)[2],
+                                                                             double subTimeStart ) {
+  std::size_t numberOfFaces = 0;
+  for (auto* layer : layers) {
+    if (layer != nullptr) {
+      numberOfFaces += layer->getNumberOfCells();
+    }
+  }
+  const std::size_t numberOfCells = cellsWithoutDynamicRupture.size();
+  if (numberOfFaces == 0) {
+    computeNeighboringIntegration(*m_clusterData, subTimeStart, cellsWithoutDynamicRupture.data(), numberOfCells);
+    return;
   }
 
-  SCOREP_USER_REGION_BEGIN(myRegionHandle, "computeDynamicRuptureFrictionLaw", SCOREP_USER_REGION_TYPE_COMMON )
-  frictionSolver->evaluate(layerData,
-                           m_dynRup,
-                           ct.correctionTime,
-                           m_dynamicRuptureKernel.timeWeights);
-  SCOREP_USER_REGION_END(myRegionHandle)
-#pragma omp parallel 
-  {
-  LIKWID_MARKER_STOP("computeDynamicRuptureFrictionLaw");
+  // After processing the first numberOfProcessedFaces faces, a proportional share of the cells
+  // without dynamic rupture faces has been integrated as well.
+  const auto cellsUntil = [&](std::size_t numberOfProcessedFaces) {
+    return numberOfProcessedFaces * numberOfCells / numberOfFaces;
+  };
+
+  std::size_t faceOffset = 0;
+  for (auto* layer : layers) {
+    if (layer == nullptr || layer->getNumberOfCells() == 0) {
+      continue;
+    }
+    SCOREP_USER_REGION( "computeDynamicRupturePipeline", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+    m_dynamicRuptureKernel.setTimeStepWidth(timeStepSize());
+
+    // Each sample of the loop statistics covers the space-time interpolation and the friction law
+    // of one pipeline step, which run back to back, but not the neighbour integration.
+    bool stepStarted = false;
+    timespec stepBegin;
+
+    auto interpolation = [&](std::size_t begin, std::size_t batchSize, std::size_t) {
+      if (!stepStarted) {
+        clock_gettime(CLOCK_MONOTONIC, &stepBegin);
+        stepStarted = true;
+      }
+      computeDynamicRuptureSpaceTimeInterpolation(*layer, begin, batchSize);
+    };
+    auto friction = [&](std::size_t begin, std::size_t batchSize, std::size_t) {
+      if (!stepStarted) {
+        clock_gettime(CLOCK_MONOTONIC, &stepBegin);
+      }
+      {
+        // The friction solver is shared by all clusters; other actors may have used it since the
+        // last batch
+        std::lock_guard lock{dynamicRuptureMutex};
+        frictionSolver->computeDeltaT(m_dynamicRuptureKernel.timePoints);
+        frictionSolver->evaluateBatch(*layer,
+                                      m_dynRup,
+                                      ct.correctionTime,
+                                      m_dynamicRuptureKernel.timeWeights,
+                                      begin,
+                                      batchSize);
+        reportFrictionStatistics(batchSize);
+        if (accumulateEnergies) {
+          seissol::SeisSol::main.energyOutput().accumulateDynamicRuptureEnergies(*layer, begin, batchSize);
+        }
+      }
+      timespec stepEnd;
+      clock_gettime(CLOCK_MONOTONIC, &stepEnd);
+      m_loopStatistics->addSample(m_regionComputeDynamicRupture, batchSize, m_profilingId, stepBegin, stepEnd);
+      stepStarted = false;
+    };
+    auto neighboringIntegration = [&](std::size_t begin, std::size_t batchSize, std::size_t) {
+      const auto first = cellsUntil(faceOffset + begin);
+      const auto last = cellsUntil(faceOffset + begin + batchSize);
+      computeNeighboringIntegration(*m_clusterData,
+                                    subTimeStart,
+                                    cellsWithoutDynamicRupture.data() + first,
+                                    last - first);
+    };
+
+    dr::pipeline::DrFunctionCallBack<decltype(interpolation)> interpolationCallBack(interpolation);
+    dr::pipeline::DrFunctionCallBack<decltype(friction)> frictionCallBack(friction);
+    dr::pipeline::DrFunctionCallBack<decltype(neighboringIntegration)> neighboringIntegrationCallBack(neighboringIntegration);
+    drPipeline.registerCallBack(0, &interpolationCallBack);
+    drPipeline.registerCallBack(1, &frictionCallBack);
+    drPipeline.registerCallBack(2, &neighboringIntegrationCallBack);
+
+    drPipeline.run(layer->getNumberOfCells());
+
+    faceOffset += layer->getNumberOfCells();
   }
 
-  m_loopStatistics->end(m_regionComputeDynamicRupture, layerData.getNumberOfCells(), m_profilingId);
+  if (!drPipelineTuningStored && drPipeline.getTuner().isTunerConverged()) {
+    std::lock_guard lock{dynamicRuptureMutex};
+    seissol::SeisSol::main.tuningDatabase().set(drPipelineTuningKey, drPipeline.getTuner().getBatchSize());
+    drPipelineTuningStored = true;
+  }
 }
 #else
 
@@ -307,6 +462,19 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
 #endif
 
 
+void seissol::time_stepping::TimeCluster::reportFrictionStatistics( unsigned numberOfFaces ) {
+  seissol::SeisSol::main.flopCounter().incrementDynamicRuptureFaces(
+      m_globalClusterId, numberOfFaces, frictionSolver->getNumberOfLockedFaces());
+  const auto& iterationStatistics = frictionSolver->getIterationStatistics();
+  if (iterationStatistics.numberOfUpdates > 0) {
+    seissol::SeisSol::main.flopCounter().incrementFrictionIterations(
+        iterationStatistics.numberOfUpdates,
+        iterationStatistics.histogram,
+        dr::friction_law::IterationStatistics::NumberOfBins,
+        iterationStatistics.numberOfFallbackPoints);
+  }
+}
+
 void seissol::time_stepping::TimeCluster::computeDynamicRuptureFlops( seissol::initializers::Layer& layerData,
                                                                       long long&                    nonZeroFlops,
                                                                       long long&                    hardwareFlops )
@@ -318,7 +486,7 @@ void seissol::time_stepping::TimeCluster::computeDynamicRuptureFlops( seissol::i
 
   for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
     long long faceNonZeroFlops, faceHardwareFlops;
-    m_dynamicRuptureKernel.flopsGodunovState(faceInformation[face], faceNonZeroFlops, faceHardwareFlops);
+    m_dynamicRuptureKernel.flopsGodunovState(faceInformation[face], faceNonZeroFlops, faceHardwareFlops, frictionSubSteps);
 
     nonZeroFlops += faceNonZeroFlops;
     hardwareFlops += faceHardwareFlops;
@@ -547,10 +715,20 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(
 #ifndef ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeNeighboringIntegration(seissol::initializers::Layer& i_layerData,
                                                                         double subTimeStart) {
+  computeNeighboringIntegration(i_layerData, subTimeStart, nullptr, i_layerData.getNumberOfCells());
+}
+
+void seissol::time_stepping::TimeCluster::computeNeighboringIntegration(seissol::initializers::Layer& i_layerData,
+                                                                        double subTimeStart,
+                                                                        unsigned const* cellIds,
+                                                                        unsigned numberOfCells) {
   if (usePlasticity) {
-    computeNeighboringIntegrationImplementation<true>(i_layerData, subTimeStart);
+    const auto [nonZeroFlopsPlasticity, hardwareFlopsPlasticity] =
+        computeNeighboringIntegrationImplementation<true>(i_layerData, subTimeStart, cellIds, numberOfCells);
+    seissol::SeisSol::main.flopCounter().incrementNonZeroFlopsPlasticity(nonZeroFlopsPlasticity);
+    seissol::SeisSol::main.flopCounter().incrementHardwareFlopsPlasticity(hardwareFlopsPlasticity);
   } else {
-    computeNeighboringIntegrationImplementation<false>(i_layerData, subTimeStart);
+    computeNeighboringIntegrationImplementation<false>(i_layerData, subTimeStart, cellIds, numberOfCells);
   }
 }
 #else // ACL_DEVICE
@@ -690,6 +868,10 @@ void seissol::time_stepping::TimeCluster::computeFlops() {
   computeDynamicRuptureFlops(*dynRupCopyData,
                              m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawCopy)],
                              m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
+  seissol::kernels::Plasticity::flopsPlasticityPreCheck(
+          m_flops_nonZero[static_cast<int>(ComputePart::PlasticityPreCheck)],
+          m_flops_hardware[static_cast<int>(ComputePart::PlasticityPreCheck)]
+          );
   seissol::kernels::Plasticity::flopsPlasticity(
           m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)],
           m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)],
@@ -760,25 +942,59 @@ void TimeCluster::correct() {
    */
   double subTimeStart = ct.correctionTime - lastSubTime;
 
+  // In the last time step before an energy output, the energies are accumulated during the update
+  accumulateEnergies = ct.nextCorrectionSteps() >= ct.stepsUntilSync
+                       && seissol::SeisSol::main.energyOutput().isAccumulating(syncTime);
+
   // Note, if this is a copy layer actor, we need the FL_Copy and the FL_Int.
   // Otherwise, this is an interior layer actor, and we need only the FL_Int.
   // We need to avoid computing it twice.
+  // With the host DR pipeline, the cells without dynamic rupture faces are integrated together
+  // with the dynamic rupture batches.
+  bool pipelined = false;
   if (dynamicRuptureScheduler->hasDynamicRuptureFaces()) {
+    // The copy and interior actors of this cluster share the dynamic rupture faces. The global
+    // lock is only taken for the friction law, such that the neighbour integration of the cells
+    // without dynamic rupture faces in the pipeline does not block the other clusters.
+    std::lock_guard clusterLock{dynamicRuptureScheduler->getMutex()};
+    seissol::initializers::Layer* dynamicRuptureLayers[2] = {nullptr, nullptr};
     if (dynamicRuptureScheduler->mayComputeInterior(ct.stepsSinceStart)) {
-      computeDynamicRupture(*dynRupInteriorData);
+      dynamicRuptureLayers[0] = dynRupInteriorData;
       seissol::SeisSol::main.flopCounter().incrementNonZeroFlopsDynamicRupture(m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawInterior)]);
       seissol::SeisSol::main.flopCounter().incrementHardwareFlopsDynamicRupture(m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawInterior)]);
       dynamicRuptureScheduler->setLastCorrectionStepsInterior(ct.stepsSinceStart);
     }
     if (layerType == Copy) {
-      computeDynamicRupture(*dynRupCopyData);
+      dynamicRuptureLayers[1] = dynRupCopyData;
       seissol::SeisSol::main.flopCounter().incrementNonZeroFlopsDynamicRupture(m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
       seissol::SeisSol::main.flopCounter().incrementHardwareFlopsDynamicRupture(m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
       dynamicRuptureScheduler->setLastCorrectionStepsCopy((ct.stepsSinceStart));
     }
 
+#ifndef ACL_DEVICE
+    if (useDynamicRupturePipeline) {
+      computeDynamicRuptureWithPipeline(dynamicRuptureLayers, subTimeStart);
+      pipelined = true;
+    }
+#endif
+    if (!pipelined) {
+      std::lock_guard lock{dynamicRuptureMutex};
+      for (auto* layer : dynamicRuptureLayers) {
+        if (layer != nullptr) {
+          computeDynamicRupture(*layer);
+        }
+      }
+    }
   }
+#ifndef ACL_DEVICE
+  if (pipelined) {
+    computeNeighboringIntegration(*m_clusterData, subTimeStart, cellsWithDynamicRupture.data(), cellsWithDynamicRupture.size());
+  } else {
+    computeNeighboringIntegration(*m_clusterData, subTimeStart);
+  }
+#else
   computeNeighboringIntegration(*m_clusterData, subTimeStart);
+#endif
 
   seissol::SeisSol::main.flopCounter().incrementNonZeroFlopsNeighbor(m_flops_nonZero[static_cast<int>(ComputePart::Neighbor)]);
   seissol::SeisSol::main.flopCounter().incrementHardwareFlopsNeighbor(m_flops_hardware[static_cast<int>(ComputePart::Neighbor)]);
@@ -788,10 +1004,13 @@ void TimeCluster::correct() {
   // First cluster calls fault receiver output
   // Call fault output only if both interior and copy parts of DR were computed
   // TODO: Change from iteration based to time based
-  if (dynamicRuptureScheduler->isFirstClusterWithDynamicRuptureFaces()
-      && dynamicRuptureScheduler->mayComputeFaultOutput(ct.stepsSinceStart)) {
-    faultOutputManager->writePickpointOutput(ct.correctionTime + timeStepSize(), timeStepSize());
-    dynamicRuptureScheduler->setLastFaultOutput(ct.stepsSinceStart);
+  if (dynamicRuptureScheduler->isFirstClusterWithDynamicRuptureFaces()) {
+    std::lock_guard clusterLock{dynamicRuptureScheduler->getMutex()};
+    std::lock_guard lock{dynamicRuptureMutex};
+    if (dynamicRuptureScheduler->mayComputeFaultOutput(ct.stepsSinceStart)) {
+      faultOutputManager->writePickpointOutput(ct.correctionTime + timeStepSize(), timeStepSize());
+      dynamicRuptureScheduler->setLastFaultOutput(ct.stepsSinceStart);
+    }
   }
 
   // TODO(Lukas) Adjust with time step rate? Relevant is maximum cluster is not on this node
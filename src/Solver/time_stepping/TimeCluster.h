@@ -75,6 +75,9 @@
 #include <mpi.h>
 #include <list>
 #endif
+#include <limits>
+#include <string>
+#include <vector>
 
 #include <Initializer/typedefs.hpp>
 #include <SourceTerm/typedefs.hpp>
@@ -95,12 +98,13 @@
 #include "Initializer/DynamicRupture.h"
 #include "DynamicRupture/FrictionLaws/FrictionSolver.h"
 #include "DynamicRupture/Output/OutputManager.hpp"
+#include "ResultWriter/EnergyOutput.h"
 
 #include "AbstractTimeCluster.h"
 
+#include <Solver/Pipeline/DrPipeline.h>
 #ifdef ACL_DEVICE
 #include <device.h>
-#include <Solver/Pipeline/DrPipeline.h>
 #endif
 
 namespace seissol {
@@ -154,8 +158,23 @@ private:
     GlobalData *m_globalDataOnDevice{nullptr};
 #ifdef ACL_DEVICE
     device::DeviceInstance& device = device::DeviceInstance::getInstance();
-    dr::pipeline::DrPipeline drPipeline;
 #endif
+    dr::pipeline::DrPipeline drPipeline;
+
+    //! true if dynamic rupture is computed with the host DR pipeline
+    bool useDynamicRupturePipeline{false};
+    //! number of sub steps of the friction law in each time step
+    unsigned frictionSubSteps{1};
+    //! cells of this layer without dynamic rupture faces, only set up for the host DR pipeline
+    std::vector<unsigned> cellsWithoutDynamicRupture;
+    //! cells of this layer with at least one dynamic rupture face
+    std::vector<unsigned> cellsWithDynamicRupture;
+    //! key of the DR pipeline batch size in the tuning database
+    std::string drPipelineTuningKey;
+    //! true if the tuning database already contains the batch size of this cluster
+    bool drPipelineTuningStored{false};
+    //! true if the energies are accumulated in this time step (the last one before an energy output)
+    bool accumulateEnergies{false};
 
     /*
      * element data
@@ -176,6 +195,7 @@ private:
       DRNeighbor,
       DRFrictionLawInterior,
       DRFrictionLawCopy,
+      PlasticityPreCheck,
       PlasticityCheck,
       PlasticityYield,
       NUM_COMPUTE_PARTS
@@ -215,6 +235,29 @@ private:
      **/
     void computeDynamicRupture( seissol::initializers::Layer&  layerData );
 
+#ifndef ACL_DEVICE
+    /**
+     * Computes the space-time interpolation of the faces startFace, ..., startFace + numberOfFaces - 1.
+     **/
+    void computeDynamicRuptureSpaceTimeInterpolation( seissol::initializers::Layer&  layerData,
+                                                      unsigned startFace,
+                                                      unsigned numberOfFaces );
+
+    /**
+     * Computes dynamic rupture of the given layers (nullptr if a layer is skipped) with the host DR pipeline.
+     * The batches of the pipeline are interleaved with the neighboring integration of the cells without
+     * dynamic rupture faces; all of them are integrated by this function.
+     * The cells with dynamic rupture faces still have to be integrated afterwards.
+     **/
+    void computeDynamicRuptureWithPipeline( seissol::initializers::Layer* const (&layers)[2],
+                                            double subTimeStart );
+#endif
+
+    /**
+     * Adds the statistics of the last friction law evaluation to the flop counter.
+     **/
+    void reportFrictionStatistics( unsigned numberOfFaces );
+
     /**
      * Computes all cell local integration.
      *
@@ -249,12 +292,26 @@ private:
      **/
     void computeNeighboringIntegration( seissol::initializers::Layer&  i_layerData, double subTimeStart );
 
+#ifndef ACL_DEVICE
+    /**
+     * Computes the neighboring integration of the given cells of the layer only.
+     *
+     * @param cellIds ids of the cells in the layer; nullptr for the cells 0, ..., numberOfCells - 1.
+     **/
+    void computeNeighboringIntegration( seissol::initializers::Layer&  i_layerData,
+                                        double subTimeStart,
+                                        unsigned const* cellIds,
+                                        unsigned numberOfCells );
+#endif
+
     void computeLocalIntegrationFlops(seissol::initializers::Layer& layerData);
 #ifndef ACL_DEVICE
     template<bool usePlasticity>
     std::pair<long, long> computeNeighboringIntegrationImplementation(seissol::initializers::Layer& i_layerData,
-                                                                      double subTimeStart) {
-      if (i_layerData.getNumberOfCells() == 0) return {0,0};
+                                                                      double subTimeStart,
+                                                                      unsigned const* cellIds,
+                                                                      unsigned numberOfCells) {
+      if (numberOfCells == 0) return {0,0};
       SCOREP_USER_REGION( "computeNeighboringIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
 
       m_loopStatistics->begin(m_regionComputeNeighboringIntegration);
@@ -265,6 +322,7 @@ private:
       PlasticityData* plasticity = i_layerData.var(m_lts->plasticity);
       auto* pstrain = i_layerData.var(m_lts->pstrain);
       unsigned numberOTetsWithPlasticYielding = 0;
+      unsigned numberOfTetsBelowYieldSurface = 0;
 
       kernels::NeighborData::Loader loader;
       loader.load(*m_lts, i_layerData);
@@ -272,11 +330,18 @@ private:
       real *l_timeIntegrated[4];
       real *l_faceNeighbors_prefetch[4];
 
+      auto& energyOutput = seissol::SeisSol::main.energyOutput();
+      const unsigned* meshIds = accumulateEnergies ? energyOutput.getMeshIds(i_layerData) : nullptr;
+      writer::EnergiesStorage energies{};
+
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static) default(none) private(l_timeIntegrated, l_faceNeighbors_prefetch) shared(cellInformation, loader, faceNeighbors, pstrain, i_layerData, plasticity, drMapping, subTimeStart) reduction(+:numberOTetsWithPlasticYielding)
+#pragma omp parallel for schedule(static) default(none) private(l_timeIntegrated, l_faceNeighbors_prefetch) shared(cellInformation, loader, faceNeighbors, pstrain, i_layerData, plasticity, drMapping, subTimeStart, cellIds, numberOfCells, energyOutput, meshIds) reduction(+:numberOTetsWithPlasticYielding,numberOfTetsBelowYieldSurface) reduction(energiesSum:energies)
 #endif
-      for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
+      for( unsigned int l_index = 0; l_index < numberOfCells; l_index++ ) {
+        const unsigned int l_cell = (cellIds == nullptr) ? l_index : cellIds[l_index];
         auto data = loader.entry(l_cell);
+        // The integration buffers are indexed by the thread of the outermost team,
+        // which stays unique if this loop runs serialized inside a task of the task scheduler.
         seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
                                                        data.cellInformation.ltsSetup,
                                                        data.cellInformation.faceTypes,
@@ -284,7 +349,7 @@ private:
                                                        timeStepSize(),
                                                        faceNeighbors[l_cell],
 #ifdef _OPENMP
-                                                       *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
+                                                       *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[omp_get_ancestor_thread_num(1)*4*tensor::I::size()])),
 #else
             *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalData->integrationBufferLTS),
 #endif
@@ -301,10 +366,11 @@ private:
                                       drMapping[l_cell][3].godunov;
 
         // fourth face's prefetches
-        if (l_cell < (i_layerData.getNumberOfCells()-1) ) {
-          l_faceNeighbors_prefetch[3] = (cellInformation[l_cell+1].faceTypes[0] != FaceType::dynamicRupture) ?
-                                        faceNeighbors[l_cell+1][0] :
-                                        drMapping[l_cell+1][0].godunov;
+        if (l_index < (numberOfCells-1) ) {
+          const unsigned int l_nextCell = (cellIds == nullptr) ? l_index+1 : cellIds[l_index+1];
+          l_faceNeighbors_prefetch[3] = (cellInformation[l_nextCell].faceTypes[0] != FaceType::dynamicRupture) ?
+                                        faceNeighbors[l_nextCell][0] :
+                                        drMapping[l_nextCell][0].godunov;
         } else {
           l_faceNeighbors_prefetch[3] = faceNeighbors[l_cell][3];
         }
@@ -316,13 +382,17 @@ private:
 
         if constexpr (usePlasticity) {
           updateRelaxTime();
-          numberOTetsWithPlasticYielding += seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
-                                                                                             timeStepSize(),
-                                                                                             m_tv,
-                                                                                             m_globalDataOnHost,
-                                                                                             &plasticity[l_cell],
-                                                                                             data.dofs,
-                                                                                             pstrain[l_cell] );
+          if (seissol::kernels::Plasticity::isBelowYieldSurface(m_globalDataOnHost, &plasticity[l_cell], data.dofs)) {
+            ++numberOfTetsBelowYieldSurface;
+          } else {
+            numberOTetsWithPlasticYielding += seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
+                                                                                               timeStepSize(),
+                                                                                               m_tv,
+                                                                                               m_globalDataOnHost,
+                                                                                               &plasticity[l_cell],
+                                                                                               data.dofs,
+                                                                                               pstrain[l_cell] );
+          }
         }
 #ifdef INTEGRATE_QUANTITIES
         seissol::SeisSol::main.postProcessor().integrateQuantities( m_timeStepWidth,
@@ -330,16 +400,33 @@ private:
                                                               l_cell,
                                                               dofs[l_cell] );
 #endif // INTEGRATE_QUANTITIES
+
+        // the cell is fully updated, evaluate its energies while its data is in cache
+        if (meshIds != nullptr && meshIds[l_cell] != std::numeric_limits<unsigned>::max()) {
+          energyOutput.addElementEnergies(meshIds[l_cell], energies);
+        }
+      }
+
+      if (meshIds != nullptr) {
+        energyOutput.addAccumulatedEnergies(energies);
       }
 
+      if constexpr (usePlasticity) {
+        seissol::SeisSol::main.flopCounter().incrementPlasticityCells(
+            m_globalClusterId, numberOfCells, numberOfTetsBelowYieldSurface);
+      }
+
+      const unsigned numberOfCheckedTets = numberOfCells - numberOfTetsBelowYieldSurface;
       const long long nonZeroFlopsPlasticity =
-          i_layerData.getNumberOfCells() * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)] +
+          numberOfCells * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityPreCheck)] +
+          numberOfCheckedTets * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)] +
           numberOTetsWithPlasticYielding * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)];
       const long long hardwareFlopsPlasticity =
-          i_layerData.getNumberOfCells() * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)] +
+          numberOfCells * m_flops_hardware[static_cast<int>(ComputePart::PlasticityPreCheck)] +
+          numberOfCheckedTets * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)] +
           numberOTetsWithPlasticYielding * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)];
 
-      m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), m_profilingId);
+      m_loopStatistics->end(m_regionComputeNeighboringIntegration, numberOfCells, m_profilingId);
 
       return {nonZeroFlopsPlasticity, hardwareFlopsPlasticity};
     }
@@ -439,6 +526,9 @@ public:
   [[nodiscard]] unsigned int getClusterId() const;
   [[nodiscard]] unsigned int getGlobalClusterId() const;
   [[nodiscard]] LayerType getLayerType() const;
+  [[nodiscard]] unsigned int getNumberOfCells() const {
+    return m_clusterData->getNumberOfCells();
+  }
   void setReceiverTime(double receiverTime);
 
   std::vector<NeighborCluster>* getNeighborClusters();
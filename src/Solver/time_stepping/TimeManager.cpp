@@ -47,10 +47,22 @@
 #include <Initializer/time_stepping/common.hpp>
 #include "SeisSol.h"
 #include <ResultWriter/ClusteringWriter.h>
+#include <ResultWriter/VertexWeightsWriter.h>
 #include "Parallel/Helper.hpp"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+// Actors with fewer cells per thread are executed as a single task instead of
+// parallelizing their cell loops, when the task scheduler is enabled.
+constexpr unsigned MinCellsPerThreadForParallelLoops = 256;
+} // namespace
+
 seissol::time_stepping::TimeManager::TimeManager():
-  m_logUpdates(std::numeric_limits<unsigned int>::max()), actorStateStatisticsManager(m_loopStatistics)
+  m_logUpdates(std::numeric_limits<unsigned int>::max()), actorStateStatisticsManager(m_loopStatistics),
+  useTasks(seissol::useTaskScheduler())
 {
   m_loopStatistics.addRegion("computeLocalIntegration");
   m_loopStatistics.addRegion("computeNeighboringIntegration");
@@ -286,6 +298,17 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
     assert(cluster->getState() == ActorState::Corrected);
   }
 
+  if (useTasks) {
+    runClustersAsTasks();
+  } else {
+    pollClusters();
+  }
+#ifdef ACL_DEVICE
+  device.api->popLastProfilingMark();
+#endif
+}
+
+void seissol::time_stepping::TimeManager::pollClusters() {
   bool finished = false; // Is true, once all clusters reached next sync point
   while (!finished) {
     finished = true;
@@ -330,9 +353,70 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
     });
     finished &= communicationManager->checkIfFinished();
   }
-#ifdef ACL_DEVICE
-  device.api->popLastProfilingMark();
+}
+
+void seissol::time_stepping::TimeManager::runClustersAsTasks() {
+#ifdef _OPENMP
+  const unsigned numberOfThreads = omp_get_max_threads();
+#else
+  const unsigned numberOfThreads = 1;
 #endif
+  std::vector<TimeCluster*> largeClusters;
+  std::vector<TimeCluster*> smallClusters;
+
+  bool finished = false; // Is true, once all clusters reached next sync point
+  while (!finished) {
+    communicationManager->progression();
+
+    // Every actor is collected at most once per wave, hence no actor acts concurrently with itself.
+    // Copy layers come first, as other ranks wait for them.
+    largeClusters.clear();
+    smallClusters.clear();
+    for (auto* prioClusters : {&highPrioClusters, &lowPrioClusters}) {
+      for (auto* cluster : *prioClusters) {
+        if (cluster->getNextLegalAction() != ActorAction::Nothing) {
+          if (cluster->getNumberOfCells() >= MinCellsPerThreadForParallelLoops * numberOfThreads) {
+            largeClusters.push_back(cluster);
+          } else {
+            smallClusters.push_back(cluster);
+          }
+        }
+      }
+    }
+
+    for (auto* cluster : largeClusters) {
+      communicationManager->progression();
+      cluster->act();
+    }
+
+    if (smallClusters.size() == 1) {
+      smallClusters.front()->act();
+    } else if (!smallClusters.empty()) {
+#ifdef _OPENMP
+      // Nested parallel regions (i.e. the cell loops) are serialized on the thread executing the task.
+      // Idle threads steal the remaining tasks.
+      const int maxActiveLevels = omp_get_max_active_levels();
+      omp_set_max_active_levels(1);
+#pragma omp parallel
+#pragma omp single
+      for (auto* cluster : smallClusters) {
+#pragma omp task default(none) firstprivate(cluster) priority(cluster->getPriority() == ActorPriority::High ? 1 : 0)
+        cluster->act();
+      }
+      omp_set_max_active_levels(maxActiveLevels);
+#else
+      for (auto* cluster : smallClusters) {
+        cluster->act();
+      }
+#endif
+    }
+
+    finished = std::all_of(clusters.begin(), clusters.end(),
+                           [](auto& c) {
+      return c->synced();
+    });
+    finished &= communicationManager->checkIfFinished();
+  }
 }
 
 void seissol::time_stepping::TimeManager::printComputationTime(
@@ -340,6 +424,16 @@ void seissol::time_stepping::TimeManager::printComputationTime(
   actorStateStatisticsManager.finish();
   m_loopStatistics.printSummary(MPI::mpi.comm());
   m_loopStatistics.writeSamples(outputPrefix, isLoopStatisticsNetcdfOutputOn);
+
+  const double timePerElement =
+      m_loopStatistics.getTimePerIteration(m_loopStatistics.getRegion("computeLocalIntegration")) +
+      m_loopStatistics.getTimePerIteration(m_loopStatistics.getRegion("computeNeighboringIntegration"));
+  const double timePerDynamicRuptureFace =
+      m_loopStatistics.getTimePerIteration(m_loopStatistics.getRegion("computeDynamicRupture"));
+  writer::VertexWeightsWriter(outputPrefix.c_str())
+      .write(seissol::SeisSol::main.getSeisSolParameters().timeStepping.vertexWeight,
+             timePerElement,
+             timePerDynamicRuptureFace);
 }
 
 double seissol::time_stepping::TimeManager::getTimeTolerance() {
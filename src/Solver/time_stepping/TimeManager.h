@@ -120,6 +120,22 @@ class seissol::time_stepping::TimeManager {
     //! dynamic rupture output
     dr::output::OutputManager* m_faultOutputManager{};
 
+    //! execute independent actors concurrently as OpenMP tasks
+    bool useTasks;
+
+    /**
+     * Advances the actors by polling them one after another; the cell loops of each
+     * actor are parallelized over all threads.
+     **/
+    void pollClusters();
+
+    /**
+     * Advances the actors in waves: All actors which may act are collected, small ones are
+     * executed concurrently as tasks (each with serialized cell loops), large ones as before.
+     * Dependencies are resolved by the actor messages, as in the polling loop.
+     **/
+    void runClustersAsTasks();
+
   public:
     /**
      * Construct a new time manager.
@@ -11,6 +11,8 @@ ${CMAKE_CURRENT_BINARY_DIR}/src/generated_code/subroutine.cpp
 ${CMAKE_CURRENT_BINARY_DIR}/src/generated_code/init.cpp
 
 src/Initializer/ParameterDB.cpp
+src/Initializer/EasiCache.cpp
+src/Initializer/WarmStartImage.cpp
 src/Initializer/PointMapper.cpp
 src/Initializer/GlobalData.cpp
 src/Initializer/InternalState.cpp
@@ -71,19 +73,23 @@ src/Checkpoint/Manager.cpp
 
 src/Checkpoint/Backend.cpp
 src/Checkpoint/Fault.cpp
+src/Checkpoint/Delta.cpp
 src/Checkpoint/posix/Wavefield.cpp
 src/Checkpoint/posix/Fault.cpp
 src/ResultWriter/AnalysisWriter.cpp
 src/ResultWriter/MiniSeisSolWriter.cpp
+src/ResultWriter/VertexWeightsWriter.cpp
 src/ResultWriter/ClusteringWriter.cpp
 src/ResultWriter/EnergyOutput.cpp
 src/ResultWriter/ThreadsPinningWriter.cpp
 src/ResultWriter/FreeSurfaceWriterExecutor.cpp
 src/ResultWriter/PostProcessor.cpp
 src/ResultWriter/ReceiverWriter.cpp
+src/ResultWriter/ReceiverWriterExecutor.cpp
 src/ResultWriter/FaultWriterExecutor.cpp
 src/ResultWriter/FaultWriter.cpp
 src/ResultWriter/WaveFieldWriter.cpp
+src/ResultWriter/WaveFieldCompressor.cpp
 src/ResultWriter/FreeSurfaceWriter.cpp
 
 src/Numerical_aux/ODEInt.cpp
@@ -96,6 +102,7 @@ src/Equations/poroelastic/Model/datastructures.cpp
 src/Equations/elastic/Kernels/GravitationalFreeSurfaceBC.cpp
 
 src/Common/IntegerMaskParser.cpp
+src/Common/TuningDatabase.cpp
 
 
 )
@@ -1,3 +1,4 @@
 #include "doctest.h"
 
-#include "IntegerMaskParser.t.h"
\ No newline at end of file
+#include "IntegerMaskParser.t.h"
+#include "TuningDatabase.t.h"
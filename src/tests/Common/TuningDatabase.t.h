@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Common/TuningDatabase.h"
+
+namespace seissol::unit_test::common {
+
+using namespace seissol;
+
+TEST_CASE("Tuning database") {
+  SUBCASE("Keys only depend on the order of magnitude of the size") {
+    REQUIRE(TuningDatabase::makeKey("batchSize", "fl6", 1024) ==
+            TuningDatabase::makeKey("batchSize", "fl6", 2047));
+    REQUIRE(TuningDatabase::makeKey("batchSize", "fl6", 1023) !=
+            TuningDatabase::makeKey("batchSize", "fl6", 1024));
+    REQUIRE(TuningDatabase::makeKey("batchSize", "fl6", 1024) !=
+            TuningDatabase::makeKey("batchSize", "fl16", 1024));
+    REQUIRE(TuningDatabase::makeKey("batchSize", "fl6", 1024) !=
+            TuningDatabase::makeKey("wiggleFactor", "fl6", 1024));
+  }
+
+  SUBCASE("Returns the values set before") {
+    TuningDatabase database;
+    const auto key = TuningDatabase::makeKey("batchSize", "fl6", 100);
+    REQUIRE(!database.get(key).has_value());
+    database.set(key, 317.0);
+    REQUIRE(database.get(key).has_value());
+    REQUIRE(*database.get(key) == 317.0);
+  }
+}
+
+} // namespace seissol::unit_test::common
@@ -1,6 +1,7 @@
 #ifndef SEISSOL_FRICTIONSOLVERCOMMON_T_H
 #define SEISSOL_FRICTIONSOLVERCOMMON_T_H
 
+#include <algorithm>
 #include <numeric>
 
 #include "DynamicRupture/Misc.h"
@@ -162,6 +163,41 @@ TEST_CASE("Friction Solver Common") {
       REQUIRE(iSPlus[8][p] == AbsApprox(expectedW[1]).epsilon(epsilon));
     }
   }
+
+  SUBCASE("Accumulate Imposed State") {
+    auto postcompute = [&](bool accumulate) {
+      friction_law::common::postcomputeImposedStateFromNewStress(faultStresses,
+                                                                 tractionResults,
+                                                                 impAndEta,
+                                                                 impMats,
+                                                                 imposedStatePlus,
+                                                                 imposedStateMinus,
+                                                                 qInterpolatedPlus,
+                                                                 qInterpolatedMinus,
+                                                                 timeWeights,
+                                                                 0,
+                                                                 accumulate);
+    };
+    postcompute(false);
+    alignas(ALIGNMENT) real singlePlus[tensor::QInterpolated::size()];
+    alignas(ALIGNMENT) real singleMinus[tensor::QInterpolated::size()];
+    std::copy(std::begin(imposedStatePlus), std::end(imposedStatePlus), singlePlus);
+    std::copy(std::begin(imposedStateMinus), std::end(imposedStateMinus), singleMinus);
+
+    // two sub steps with the same data sum up to twice the imposed state of one sub step
+    postcompute(true);
+    for (size_t i = 0; i < tensor::QInterpolated::size(); i++) {
+      REQUIRE(imposedStatePlus[i] == AbsApprox(2 * singlePlus[i]).epsilon(epsilon));
+      REQUIRE(imposedStateMinus[i] == AbsApprox(2 * singleMinus[i]).epsilon(epsilon));
+    }
+
+    // without accumulation, the imposed state is overwritten
+    postcompute(false);
+    for (size_t i = 0; i < tensor::QInterpolated::size(); i++) {
+      REQUIRE(imposedStatePlus[i] == AbsApprox(singlePlus[i]).epsilon(epsilon));
+      REQUIRE(imposedStateMinus[i] == AbsApprox(singleMinus[i]).epsilon(epsilon));
+    }
+  }
 }
 
 } // namespace seissol::unit_test::dr
@@ -0,0 +1,235 @@
+#ifndef SEISSOL_FRICTIONSUBSTEPS_T_H
+#define SEISSOL_FRICTIONSUBSTEPS_T_H
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+
+#include "DynamicRupture/FrictionLaws/LinearSlipWeakening.h"
+#include "DynamicRupture/Misc.h"
+#include "Kernels/DynamicRupture.h"
+#include "tests/TestHelper.h"
+
+namespace seissol::unit_test::dr {
+
+using namespace seissol;
+using namespace seissol::dr;
+
+/**
+ * A single fault face with homogeneous initial stresses and without any stress change from the
+ * wave field, i.e. the fault slides with a slip rate which only depends on the friction.
+ */
+struct SubStepFault {
+  alignas(ALIGNMENT) real initialStressInFaultCS[1][misc::numPaddedPoints][6] = {};
+  alignas(ALIGNMENT) real initialPressure[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) real cohesion[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) realAcc mu[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) real muS[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) real muD[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) real dC[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) real forcedRuptureTime[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) real slipRateMagnitude[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) realAcc slipRate1[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) realAcc slipRate2[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) realAcc slip1[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) realAcc slip2[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) realAcc accumulatedSlipMagnitude[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) real traction1[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) real traction2[1][misc::numPaddedPoints] = {};
+  ImpedancesAndEta impAndEta[1] = {};
+
+  SubStepFault(real staticFriction, real dynamicFriction) {
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; ++pointIndex) {
+      initialStressInFaultCS[0][pointIndex][0] = -50.0e6;
+      initialStressInFaultCS[0][pointIndex][3] = 30.0e6;
+      mu[0][pointIndex] = staticFriction;
+      muS[0][pointIndex] = staticFriction;
+      muD[0][pointIndex] = dynamicFriction;
+      dC[0][pointIndex] = 0.01;
+      forcedRuptureTime[0][pointIndex] = 1.0e10;
+    }
+    impAndEta[0].etaS = 1.0e7;
+    impAndEta[0].invEtaS = 1.0e-7;
+  }
+};
+
+class TestSubStepLinearSlipWeakening
+    : public friction_law::LinearSlipWeakeningLaw<friction_law::NoSpecialization> {
+  public:
+  using LinearSlipWeakeningLaw::LinearSlipWeakeningLaw;
+
+  void setFaultData(SubStepFault& fault) {
+    this->initialStressInFaultCS = fault.initialStressInFaultCS;
+    this->initialPressure = fault.initialPressure;
+    this->cohesion = fault.cohesion;
+    this->mu = fault.mu;
+    this->muS = fault.muS;
+    this->muD = fault.muD;
+    this->dC = fault.dC;
+    this->forcedRuptureTime = fault.forcedRuptureTime;
+    this->slipRateMagnitude = fault.slipRateMagnitude;
+    this->slipRate1 = fault.slipRate1;
+    this->slipRate2 = fault.slipRate2;
+    this->slip1 = fault.slip1;
+    this->slip2 = fault.slip2;
+    this->accumulatedSlipMagnitude = fault.accumulatedSlipMagnitude;
+    this->traction1 = fault.traction1;
+    this->traction2 = fault.traction2;
+    this->impAndEta = fault.impAndEta;
+  }
+
+  /**
+   * Evaluates the friction law in the time interval set by computeDeltaT, starting at
+   * fullUpdateTime, and returns the time at the end of the interval.
+   */
+  double update(double fullUpdateTime) {
+    this->mFullUpdateTime = fullUpdateTime;
+    FaultStresses faultStresses{};
+    TractionResults tractionResults{};
+    std::array<real, misc::numPaddedPoints> stateVariableBuffer{};
+    std::array<real, misc::numPaddedPoints> strengthBuffer{};
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+      this->updateFrictionAndSlip(
+          faultStresses, tractionResults, stateVariableBuffer, strengthBuffer, 0, timeIndex);
+    }
+    return fullUpdateTime + std::accumulate(std::begin(this->deltaT), std::end(this->deltaT), 0.0);
+  }
+};
+
+/**
+ * Advances the fault by one time step with the given number of friction sub steps, in the same
+ * way as TimeCluster::computeDynamicRupture, and returns the time at the end of the step.
+ */
+inline double advanceWithSubSteps(TestSubStepLinearSlipWeakening& frictionLaw,
+                                  kernels::DynamicRupture& dynamicRuptureKernel,
+                                  double correctionTime,
+                                  double timeStepSize,
+                                  unsigned numberOfSubSteps) {
+  const double epsilon = 1e2 * std::numeric_limits<real>::epsilon() * timeStepSize;
+  double endTime = correctionTime;
+  for (unsigned subStep = 0; subStep < numberOfSubSteps; ++subStep) {
+    dynamicRuptureKernel.setSubTimeStep(timeStepSize, subStep, numberOfSubSteps);
+    frictionLaw.computeDeltaT(dynamicRuptureKernel.timePoints);
+    // the sub steps are contiguous; the time increments of the friction law are stored in the
+    // working precision
+    REQUIRE(correctionTime + dynamicRuptureKernel.getSubTimeStepStart() ==
+            AbsApprox(endTime).epsilon(epsilon));
+    endTime = frictionLaw.update(correctionTime + dynamicRuptureKernel.getSubTimeStepStart());
+  }
+  return endTime;
+}
+
+TEST_CASE("Friction sub steps") {
+  DRParameters drParameters;
+  drParameters.t0 = 0.0;
+  kernels::DynamicRupture dynamicRuptureKernel;
+  constexpr double CorrectionTime = 2.0;
+  constexpr double TimeStepSize = 0.01;
+  constexpr double Epsilon = 1e2 * std::numeric_limits<real>::epsilon();
+
+  SUBCASE("The time points of the sub steps cover the time step") {
+    for (const unsigned numberOfSubSteps : {1u, 2u, 3u, 5u}) {
+      CAPTURE(numberOfSubSteps);
+      double sumOfWeights = 0.0;
+      for (unsigned subStep = 0; subStep < numberOfSubSteps; ++subStep) {
+        dynamicRuptureKernel.setSubTimeStep(TimeStepSize, subStep, numberOfSubSteps);
+        const double start = dynamicRuptureKernel.getSubTimeStepStart();
+        REQUIRE(start == AbsApprox(subStep * TimeStepSize / numberOfSubSteps).epsilon(1e-15));
+        for (unsigned point = 0; point < CONVERGENCE_ORDER; ++point) {
+          REQUIRE(dynamicRuptureKernel.timePoints[point] > 0.0);
+          REQUIRE(dynamicRuptureKernel.timePoints[point] < TimeStepSize / numberOfSubSteps);
+          sumOfWeights += dynamicRuptureKernel.timeWeights[point];
+        }
+      }
+      REQUIRE(sumOfWeights == AbsApprox(TimeStepSize).epsilon(1e-15));
+    }
+  }
+
+  SUBCASE("Slip and time at the end of the time step") {
+    // for constant friction, the fault slides with (30 MPa - 0.5 * 50 MPa) / eta_s = 0.5 m/s
+    constexpr double SlipRate = 0.5;
+    for (const unsigned numberOfSubSteps : {1u, 2u, 3u, 5u}) {
+      CAPTURE(numberOfSubSteps);
+      SubStepFault fault(0.5, 0.5);
+      TestSubStepLinearSlipWeakening frictionLaw(&drParameters);
+      frictionLaw.setFaultData(fault);
+      const double endTime = advanceWithSubSteps(
+          frictionLaw, dynamicRuptureKernel, CorrectionTime, TimeStepSize, numberOfSubSteps);
+
+      REQUIRE(endTime ==
+              AbsApprox(CorrectionTime + TimeStepSize).epsilon(Epsilon * TimeStepSize));
+      for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints;
+           ++pointIndex) {
+        REQUIRE(fault.slipRateMagnitude[0][pointIndex] == AbsApprox(SlipRate).epsilon(Epsilon));
+        REQUIRE(fault.slip1[0][pointIndex] ==
+                AbsApprox(SlipRate * TimeStepSize).epsilon(Epsilon * SlipRate * TimeStepSize));
+        REQUIRE(fault.slip2[0][pointIndex] == 0.0);
+      }
+    }
+  }
+
+  SUBCASE("One sub step agrees with the time step") {
+    // with slip weakening, the result depends on the time points of the friction law
+    SubStepFault baselineFault(0.55, 0.4);
+    TestSubStepLinearSlipWeakening baseline(&drParameters);
+    baseline.setFaultData(baselineFault);
+    dynamicRuptureKernel.setTimeStepWidth(TimeStepSize);
+    REQUIRE(dynamicRuptureKernel.getSubTimeStepStart() == 0.0);
+    double timePoints[CONVERGENCE_ORDER];
+    double timeWeights[CONVERGENCE_ORDER];
+    std::copy_n(dynamicRuptureKernel.timePoints, CONVERGENCE_ORDER, timePoints);
+    std::copy_n(dynamicRuptureKernel.timeWeights, CONVERGENCE_ORDER, timeWeights);
+    baseline.computeDeltaT(dynamicRuptureKernel.timePoints);
+    const double baselineEndTime = baseline.update(CorrectionTime);
+
+    SubStepFault fault(0.55, 0.4);
+    TestSubStepLinearSlipWeakening frictionLaw(&drParameters);
+    frictionLaw.setFaultData(fault);
+    const double endTime =
+        advanceWithSubSteps(frictionLaw, dynamicRuptureKernel, CorrectionTime, TimeStepSize, 1);
+
+    for (unsigned point = 0; point < CONVERGENCE_ORDER; ++point) {
+      REQUIRE(dynamicRuptureKernel.timePoints[point] == timePoints[point]);
+      REQUIRE(dynamicRuptureKernel.timeWeights[point] == timeWeights[point]);
+    }
+    REQUIRE(endTime == baselineEndTime);
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; ++pointIndex) {
+      REQUIRE(fault.slipRateMagnitude[0][pointIndex] ==
+              baselineFault.slipRateMagnitude[0][pointIndex]);
+      REQUIRE(fault.slip1[0][pointIndex] == baselineFault.slip1[0][pointIndex]);
+      REQUIRE(fault.accumulatedSlipMagnitude[0][pointIndex] ==
+              baselineFault.accumulatedSlipMagnitude[0][pointIndex]);
+      REQUIRE(fault.mu[0][pointIndex] == baselineFault.mu[0][pointIndex]);
+      REQUIRE(fault.traction1[0][pointIndex] == baselineFault.traction1[0][pointIndex]);
+    }
+  }
+}
+
+TEST_CASE("Friction sub steps scale the dynamic rupture flops") {
+  kernels::DynamicRupture dynamicRuptureKernel;
+  DRFaceInformation faceInformation{};
+  faceInformation.plusSide = 1;
+  faceInformation.minusSide = 2;
+  faceInformation.faceRelation = 3;
+
+  long long nonZeroFlops = 0;
+  long long hardwareFlops = 0;
+  dynamicRuptureKernel.flopsGodunovState(faceInformation, nonZeroFlops, hardwareFlops);
+  REQUIRE(nonZeroFlops > 0);
+  REQUIRE(hardwareFlops > 0);
+
+  for (const unsigned numberOfSubSteps : {1u, 2u, 4u}) {
+    CAPTURE(numberOfSubSteps);
+    long long subStepNonZeroFlops = 0;
+    long long subStepHardwareFlops = 0;
+    dynamicRuptureKernel.flopsGodunovState(
+        faceInformation, subStepNonZeroFlops, subStepHardwareFlops, numberOfSubSteps);
+    REQUIRE(subStepNonZeroFlops == numberOfSubSteps * nonZeroFlops);
+    REQUIRE(subStepHardwareFlops == numberOfSubSteps * hardwareFlops);
+  }
+}
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_FRICTIONSUBSTEPS_T_H
@@ -0,0 +1,84 @@
+#ifndef SEISSOL_LINEARSLIPWEAKENING_T_H
+#define SEISSOL_LINEARSLIPWEAKENING_T_H
+
+#include <array>
+#include <type_traits>
+
+#include "DynamicRupture/FrictionLaws/LinearSlipWeakening.h"
+#include "DynamicRupture/Misc.h"
+
+namespace seissol::unit_test::dr {
+
+using namespace seissol;
+using namespace seissol::dr;
+
+// The fault time is passed in double precision, also if the wave field is computed in single
+// precision.
+static_assert(std::is_same_v<decltype(&friction_law::FrictionSolver::copyLtsTreeToLocal),
+                             void (friction_law::FrictionSolver::*)(
+                                 initializers::Layer&, initializers::DynamicRupture const*, double)>);
+
+#if defined(DOUBLE_PRECISION) || defined(USE_MIXED_PRECISION)
+class TestLinearSlipWeakening
+    : public friction_law::LinearSlipWeakeningLaw<friction_law::NoSpecialization> {
+  public:
+  using LinearSlipWeakeningLaw::LinearSlipWeakeningLaw;
+
+  void setFaultData(double fullUpdateTime,
+                    real (*slipRateMagnitude)[misc::numPaddedPoints],
+                    realAcc (*accumulatedSlipMagnitude)[misc::numPaddedPoints],
+                    real (*dC)[misc::numPaddedPoints],
+                    real (*forcedRuptureTime)[misc::numPaddedPoints]) {
+    this->mFullUpdateTime = fullUpdateTime;
+    this->slipRateMagnitude = slipRateMagnitude;
+    this->accumulatedSlipMagnitude = accumulatedSlipMagnitude;
+    this->dC = dC;
+    this->forcedRuptureTime = forcedRuptureTime;
+  }
+};
+
+TEST_CASE("Linear slip weakening after a long simulated time") {
+  DRParameters drParameters;
+  drParameters.t0 = 0.0;
+  TestLinearSlipWeakening frictionLaw(&drParameters);
+
+  alignas(ALIGNMENT) real slipRateMagnitude[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) realAcc accumulatedSlipMagnitude[1][misc::numPaddedPoints] = {};
+  alignas(ALIGNMENT) real dC[1][misc::numPaddedPoints];
+  alignas(ALIGNMENT) real forcedRuptureTime[1][misc::numPaddedPoints];
+  std::fill_n(dC[0], misc::numPaddedPoints, 1.0);
+  // the rupture is forced after 10^6 s, i.e. 11.6 days; the spacing of floats is 0.0625 s there
+  std::fill_n(forcedRuptureTime[0], misc::numPaddedPoints, 1.0e6);
+
+  double timePoints[CONVERGENCE_ORDER];
+  for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+    timePoints[timeIndex] = 0.02 * (timeIndex + 1);
+  }
+  frictionLaw.computeDeltaT(timePoints);
+
+  std::array<real, misc::numPaddedPoints> stateVariable{};
+
+  SUBCASE("Before the forced rupture time") {
+    // the first time point is 10 ms before the forced rupture time, which rounds to it in float
+    frictionLaw.setFaultData(
+        1.0e6 - 0.03, slipRateMagnitude, accumulatedSlipMagnitude, dC, forcedRuptureTime);
+    frictionLaw.calcStateVariableHook(stateVariable, 0, 0);
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; ++pointIndex) {
+      REQUIRE(stateVariable[pointIndex] == 0.0);
+    }
+  }
+
+  SUBCASE("After the forced rupture time") {
+    frictionLaw.setFaultData(
+        1.0e6 - 0.01, slipRateMagnitude, accumulatedSlipMagnitude, dC, forcedRuptureTime);
+    frictionLaw.calcStateVariableHook(stateVariable, 0, 0);
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; ++pointIndex) {
+      REQUIRE(stateVariable[pointIndex] == 1.0);
+    }
+  }
+}
+#endif
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_LINEARSLIPWEAKENING_T_H
@@ -0,0 +1,73 @@
+#ifndef SEISSOL_DRFACEALIGNEDDOFS_T_H
+#define SEISSOL_DRFACEALIGNEDDOFS_T_H
+
+#include <random>
+#include <vector>
+
+#include "DynamicRupture/Output/ReceiverBasedOutput.hpp"
+#include "generated_code/init.h"
+#include "generated_code/kernel.h"
+#include "generated_code/tensor.h"
+#include "tests/TestHelper.h"
+
+namespace seissol::unit_test::dr {
+
+TEST_CASE("Face-aligned DOFs at the receivers of a face") {
+  constexpr auto NumberOfBasisFunctions = tensor::basisFunctionsAtPoint::Shape[0];
+  constexpr auto ReceiversPerBlock = tensor::basisFunctionsAtFaceReceivers::Shape[1];
+
+  std::mt19937 generator(17);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  alignas(ALIGNMENT) real dofs[tensor::Q::size()];
+  alignas(ALIGNMENT) real tinv[tensor::Tinv::size()];
+  for (auto& value : dofs) {
+    value = distribution(generator);
+  }
+  for (auto& value : tinv) {
+    value = distribution(generator);
+  }
+
+  // one full and one partial block
+  for (const std::size_t numberOfReceivers : {std::size_t{1}, ReceiversPerBlock + 1}) {
+    CAPTURE(numberOfReceivers);
+    const auto numberOfBlocks = (numberOfReceivers + ReceiversPerBlock - 1) / ReceiversPerBlock;
+
+    std::vector<std::vector<real>> basisFunctions(numberOfReceivers,
+                                                  std::vector<real>(NumberOfBasisFunctions));
+    std::vector<real> blocks(numberOfBlocks * tensor::basisFunctionsAtFaceReceivers::size(), 0.0);
+    for (std::size_t k = 0; k < numberOfReceivers; ++k) {
+      auto block = init::basisFunctionsAtFaceReceivers::view::create(
+          &blocks[(k / ReceiversPerBlock) * tensor::basisFunctionsAtFaceReceivers::size()]);
+      for (std::size_t l = 0; l < NumberOfBasisFunctions; ++l) {
+        basisFunctions[k][l] = distribution(generator);
+        block(l, k % ReceiversPerBlock) = basisFunctions[k][l];
+      }
+    }
+
+    std::vector<real> faceAlignedValues(numberOfBlocks * tensor::QAtFaceReceivers::size());
+    output::ReceiverOutput::evaluateFaceAlignedDofs(
+        dofs, tinv, blocks.data(), numberOfReceivers, faceAlignedValues.data());
+
+    // reference: the kernel for a single receiver
+    for (std::size_t k = 0; k < numberOfReceivers; ++k) {
+      CAPTURE(k);
+      real expected[tensor::QAtPoint::size()]{};
+      seissol::dynamicRupture::kernel::evaluateFaceAlignedDOFSAtPoint krnl;
+      krnl.Q = dofs;
+      krnl.Tinv = tinv;
+      krnl.basisFunctionsAtPoint = basisFunctions[k].data();
+      krnl.QAtPoint = expected;
+      krnl.execute();
+
+      for (std::size_t i = 0; i < tensor::QAtPoint::size(); ++i) {
+        REQUIRE(faceAlignedValues[k * tensor::QAtPoint::size() + i] ==
+                AbsApprox(expected[i]).epsilon(1e-5));
+      }
+    }
+  }
+}
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_DRFACEALIGNEDDOFS_T_H
@@ -0,0 +1,44 @@
+#include <Eigen/Dense>
+#include <array>
+
+#include "Initializer/ParameterDB.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Adaptive homogenization probes") {
+  using seissol::initializers::ElementAverageGenerator;
+  const std::array<Eigen::Vector3d, 4> vertices = {{Eigen::Vector3d(0.0, 0.0, 0.0),
+                                                    Eigen::Vector3d(1.0, 0.0, 0.0),
+                                                    Eigen::Vector3d(0.0, 1.0, 0.0),
+                                                    Eigen::Vector3d(0.0, 0.0, 1.0)}};
+  const auto probes = ElementAverageGenerator::probePoints(vertices);
+  const Eigen::Vector3d barycenter(0.25, 0.25, 0.25);
+
+  SUBCASE("The probes lie strictly inside the element") {
+    for (const auto& probe : probes) {
+      REQUIRE(probe.minCoeff() > 0.0);
+      REQUIRE(probe.sum() < 1.0);
+    }
+    REQUIRE((probes[ElementAverageGenerator::NumProbes - 1] - barycenter).norm() == 0.0);
+  }
+
+  SUBCASE("A thin layer away from the vertices and the barycentre is detected") {
+    // The layer 0.49 <= x <= 0.51 cuts the element between the vertex and barycentre probes
+    auto isInLayer = [](const Eigen::Vector3d& point) {
+      return point(0) >= 0.49 && point(0) <= 0.51;
+    };
+    for (unsigned vertex = 0; vertex < 4; ++vertex) {
+      REQUIRE(!isInLayer(probes[vertex]));
+    }
+    REQUIRE(!isInLayer(barycenter));
+
+    unsigned probesInLayer = 0;
+    for (const auto& probe : probes) {
+      probesInLayer += isInLayer(probe) ? 1 : 0;
+    }
+    // the midpoints of the three edges at (1, 0, 0)
+    REQUIRE(probesInLayer == 3);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -1,4 +1,7 @@
 #include <Eigen/Dense>
+#include <cstdlib>
+#include <limits>
+#include <vector>
 
 #include "tests/Geometry/MockReader.h"
 #include "Initializer/PointMapper.h"
@@ -41,4 +44,84 @@ TEST_CASE("Point mapper") {
   }
 }
 
-} // namespace seissol::unit_test
\ No newline at end of file
+TEST_CASE("Point mapper on structured mesh") {
+  // Split the unit cube into n^3 sub-cubes and each sub-cube into 6 tetrahedra
+  constexpr int n = 4;
+  std::vector<Vertex> vertices;
+  for (int k = 0; k <= n; ++k) {
+    for (int j = 0; j <= n; ++j) {
+      for (int i = 0; i <= n; ++i) {
+        Vertex vertex;
+        vertex.coords[0] = static_cast<double>(i) / n;
+        vertex.coords[1] = static_cast<double>(j) / n;
+        vertex.coords[2] = static_cast<double>(k) / n;
+        vertices.push_back(vertex);
+      }
+    }
+  }
+  auto vertexId = [&](int i, int j, int k) { return i + (n + 1) * (j + (n + 1) * k); };
+
+  constexpr int kuhn[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+  std::vector<Element> elements;
+  for (int k = 0; k < n; ++k) {
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        for (const auto& permutation : kuhn) {
+          int corner[3] = {i, j, k};
+          Element element{};
+          element.localId = elements.size();
+          element.vertices[0] = vertexId(corner[0], corner[1], corner[2]);
+          for (int v = 0; v < 3; ++v) {
+            ++corner[permutation[v]];
+            element.vertices[v + 1] = vertexId(corner[0], corner[1], corner[2]);
+          }
+          // Ensure positive orientation such that the face normals point outward
+          VrtxCoords a, b, c, axb;
+          MeshTools::sub(vertices[element.vertices[1]].coords, vertices[element.vertices[0]].coords, a);
+          MeshTools::sub(vertices[element.vertices[2]].coords, vertices[element.vertices[0]].coords, b);
+          MeshTools::sub(vertices[element.vertices[3]].coords, vertices[element.vertices[0]].coords, c);
+          MeshTools::cross(a, b, axb);
+          if (MeshTools::dot(axb, c) < 0.0) {
+            std::swap(element.vertices[1], element.vertices[2]);
+          }
+          elements.push_back(element);
+        }
+      }
+    }
+  }
+
+  std::srand(123);
+  constexpr unsigned numPoints = 200;
+  std::vector<Eigen::Vector3d> points;
+  for (unsigned p = 0; p < numPoints; ++p) {
+    // Some points are placed outside of the mesh on purpose
+    points.emplace_back(1.2 * std::rand() / RAND_MAX - 0.1,
+                        1.2 * std::rand() / RAND_MAX - 0.1,
+                        1.2 * std::rand() / RAND_MAX - 0.1);
+  }
+  // Points on vertices, edges and faces are contained in several elements
+  points.emplace_back(0.5, 0.5, 0.5);
+  points.emplace_back(0.0, 0.0, 0.0);
+  points.emplace_back(1.0 / n, 0.5 / n, 0.0);
+
+  std::vector<short> contained(points.size());
+  std::vector<unsigned> meshIds(points.size(), std::numeric_limits<unsigned>::max());
+  seissol::initializers::findMeshIds(
+      points.data(), vertices, elements, points.size(), contained.data(), meshIds.data());
+
+  for (unsigned p = 0; p < points.size(); ++p) {
+    VrtxCoords coords = {points[p](0), points[p](1), points[p](2)};
+    short expectedContained = 0;
+    unsigned expectedMeshId = std::numeric_limits<unsigned>::max();
+    for (const auto& element : elements) {
+      if (MeshTools::inside(element, vertices, coords)) {
+        expectedContained = 1;
+        expectedMeshId = std::min(expectedMeshId, static_cast<unsigned>(element.localId));
+      }
+    }
+    REQUIRE(contained[p] == expectedContained);
+    REQUIRE(meshIds[p] == expectedMeshId);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -2,4 +2,6 @@
 #include "tests/TestHelper.h"
 
 #include "time_stepping/LTSWeights.t.h"
-#include "PointMapper.t.h"
\ No newline at end of file
+#include "PointMapper.t.h"
+#include "ElementAverageGenerator.t.h"
+#include "WarmStartImage.t.h"
@@ -0,0 +1,51 @@
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+#include "Common/filesystem.h"
+#include "Initializer/WarmStartImage.h"
+
+namespace seissol::unit_test {
+
+// the warm start image is disabled in GPU builds
+#ifndef ACL_DEVICE
+TEST_CASE("Warm start image") {
+  const auto directory = seissol::filesystem::temp_directory_path() /
+                         ("seissol-warmstart-test-" + std::to_string(::getpid()));
+  seissol::filesystem::create_directories(directory);
+  const auto modelFile = (directory / "material.yaml").string();
+  const auto includedFile = (directory / "included.yaml").string();
+  const auto writeFile = [](const std::string& fileName, const std::string& contents) {
+    std::ofstream file(fileName, std::ios::trunc);
+    file << contents;
+  };
+  writeFile(modelFile, "!Include included.yaml\n");
+  writeFile(includedFile, "!ConstantMap\nmap:\n  rho: 2600\n");
+  ::setenv("SEISSOL_WARMSTART_IMAGE", (directory / "image").c_str(), 1);
+
+  const auto loadImage = [&]() {
+    seissol::initializers::WarmStartImage image;
+    image.addModelFileToKey(modelFile);
+    return image.load();
+  };
+
+  {
+    seissol::initializers::WarmStartImage image;
+    image.addModelFileToKey(modelFile);
+    REQUIRE(!image.load());
+    image.store();
+  }
+  REQUIRE(loadImage());
+
+  // changing an included file invalidates the image
+  writeFile(includedFile, "!ConstantMap\nmap:\n  rho: 2700\n");
+  REQUIRE(!loadImage());
+
+  ::unsetenv("SEISSOL_WARMSTART_IMAGE");
+  seissol::filesystem::remove_all(directory);
+}
+#endif // ACL_DEVICE
+
+} // namespace seissol::unit_test
@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "Geometry/MeshTools.h"
+#include "Initializer/CellLocalMatrices.h"
+#include "Kernels/CompressedCellMatrices.h"
+#include "Model/common.hpp"
+#include "Numerical_aux/Transformation.h"
+#include "generated_code/init.h"
+#include "generated_code/kernel.h"
+#include "generated_code/tensor.h"
+#include "tests/TestHelper.h"
+
+namespace seissol::unit_test {
+
+namespace {
+template <std::size_t N>
+void requireRelativelyClose(const real (&expected)[N], const real (&actual)[N]) {
+  double scale = 0.0;
+  for (std::size_t i = 0; i < N; ++i) {
+    scale = std::max(scale, static_cast<double>(std::abs(expected[i])));
+  }
+  const double epsilon = 1e3 * std::numeric_limits<real>::epsilon() * scale;
+  for (std::size_t i = 0; i < N; ++i) {
+    REQUIRE(actual[i] == AbsApprox(expected[i]).epsilon(epsilon));
+  }
+}
+} // namespace
+
+TEST_CASE("Compressed cell-local matrices agree with the uncompressed ones") {
+  constexpr unsigned NumberOfTetrahedra = 4;
+  constexpr FaceType FaceTypes[] = {FaceType::regular,
+                                    FaceType::freeSurface,
+                                    FaceType::freeSurfaceGravity,
+                                    FaceType::dynamicRupture,
+                                    FaceType::dirichlet,
+                                    FaceType::outflow,
+                                    FaceType::periodic,
+                                    FaceType::analytical};
+
+  std::mt19937 generator(20231018);
+  std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+  std::uniform_real_distribution<double> density(2000.0, 3000.0);
+  std::uniform_real_distribution<double> modulus(1.0e9, 4.0e10);
+
+  std::array<model::ElasticMaterial, 3> materials;
+  for (auto& material : materials) {
+    material.rho = density(generator);
+    material.mu = modulus(generator);
+    material.lambda = modulus(generator);
+  }
+
+  CellMatrixTable table;
+  initializers::CellMatrixTableBuilder builder(table);
+
+  for (unsigned tetrahedron = 0; tetrahedron < NumberOfTetrahedra; ++tetrahedron) {
+    std::vector<Vertex> vertices(4);
+    Element element{};
+    real x[4];
+    real y[4];
+    real z[4];
+    for (unsigned vertex = 0; vertex < 4; ++vertex) {
+      element.vertices[vertex] = vertex;
+      for (unsigned dim = 0; dim < 3; ++dim) {
+        vertices[vertex].coords[dim] = coordinate(generator);
+      }
+      x[vertex] = vertices[vertex].coords[0];
+      y[vertex] = vertices[vertex].coords[1];
+      z[vertex] = vertices[vertex].coords[2];
+    }
+    const double volume = MeshTools::volume(element, vertices);
+
+    const auto& local = materials[tetrahedron % materials.size()];
+    LocalIntegrationData localIntegration{};
+    localIntegration.jacobianId = builder.addMaterial(local);
+
+    // star matrices, as in initializeCellLocalMatrices
+    real gradXi[3];
+    real gradEta[3];
+    real gradZeta[3];
+    transformations::tetrahedronGlobalToReferenceJacobian(x, y, z, gradXi, gradEta, gradZeta);
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      localIntegration.gradients[0][dim] = gradXi[dim];
+      localIntegration.gradients[1][dim] = gradEta[dim];
+      localIntegration.gradients[2][dim] = gradZeta[dim];
+    }
+
+    real ATData[tensor::star::size(0)];
+    real BTData[tensor::star::size(1)];
+    real CTData[tensor::star::size(2)];
+    auto AT = init::star::view<0>::create(ATData);
+    auto BT = init::star::view<0>::create(BTData);
+    auto CT = init::star::view<0>::create(CTData);
+    model::getTransposedCoefficientMatrix(local, 0, AT);
+    model::getTransposedCoefficientMatrix(local, 1, BT);
+    model::getTransposedCoefficientMatrix(local, 2, CT);
+
+    real expectedStarMatrices[3][tensor::star::size(0)];
+    initializers::setStarMatrix(ATData, BTData, CTData, gradXi, expectedStarMatrices[0]);
+    initializers::setStarMatrix(ATData, BTData, CTData, gradEta, expectedStarMatrices[1]);
+    initializers::setStarMatrix(ATData, BTData, CTData, gradZeta, expectedStarMatrices[2]);
+
+    real starMatrices[3][tensor::star::size(0)];
+    kernels::assembleStarMatrices(table, localIntegration, starMatrices);
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      requireRelativelyClose(expectedStarMatrices[dim], starMatrices[dim]);
+    }
+
+    // flux solvers
+    for (unsigned side = 0; side < 4; ++side) {
+      VrtxCoords normal;
+      VrtxCoords tangent1;
+      VrtxCoords tangent2;
+      MeshTools::normalAndTangents(element, side, vertices, normal, tangent1, tangent2);
+      const double surface = MeshTools::surface(normal);
+      MeshTools::normalize(normal, normal);
+      MeshTools::normalize(tangent1, tangent1);
+      MeshTools::normalize(tangent2, tangent2);
+      const real fluxScale = -2.0 * surface / (6.0 * volume);
+
+      for (unsigned dim = 0; dim < 3; ++dim) {
+        localIntegration.faceFrames[side][0][dim] = normal[dim];
+        localIntegration.faceFrames[side][1][dim] = tangent1[dim];
+        localIntegration.faceFrames[side][2][dim] = tangent2[dim];
+      }
+      localIntegration.fluxScales[side] = fluxScale;
+
+      const auto& neighbor = materials[(tetrahedron + side) % materials.size()];
+      const unsigned neighborId = builder.addMaterial(neighbor);
+
+      real TData[tensor::T::size()];
+      real TinvData[tensor::Tinv::size()];
+      auto T = init::T::view::create(TData);
+      auto Tinv = init::Tinv::view::create(TinvData);
+      model::getFaceRotationMatrix(normal, tangent1, tangent2, T, Tinv);
+
+      for (const auto faceType : FaceTypes) {
+        CAPTURE(tetrahedron);
+        CAPTURE(side);
+        CAPTURE(static_cast<int>(faceType));
+        localIntegration.fluxSolverIds[side] =
+            builder.addFluxSolvers(localIntegration.jacobianId, neighborId, faceType);
+
+        // uncompressed, as in initializeCellLocalMatrices
+        real QgodLocalData[tensor::QgodLocal::size()];
+        real QgodNeighborData[tensor::QgodNeighbor::size()];
+        real ATtildeData[tensor::star::size(0)];
+        auto QgodLocal = init::QgodLocal::view::create(QgodLocalData);
+        auto QgodNeighbor = init::QgodNeighbor::view::create(QgodNeighborData);
+        auto ATtilde = init::star::view<0>::create(ATtildeData);
+        model::getTransposedGodunovState(local, neighbor, faceType, QgodLocal, QgodNeighbor);
+        model::getTransposedCoefficientMatrix(local, 0, ATtilde);
+
+        real expectedAplusT[tensor::AplusT::size()];
+        kernel::computeFluxSolverLocal localKrnl;
+        localKrnl.fluxScale = fluxScale;
+        localKrnl.AplusT = expectedAplusT;
+        localKrnl.QgodLocal = QgodLocalData;
+        localKrnl.T = TData;
+        localKrnl.Tinv = TinvData;
+        localKrnl.star(0) = ATtildeData;
+        localKrnl.execute();
+
+        real expectedAminusT[tensor::AminusT::size()];
+        kernel::computeFluxSolverNeighbor neighKrnl;
+        neighKrnl.fluxScale = fluxScale;
+        neighKrnl.AminusT = expectedAminusT;
+        neighKrnl.QgodNeighbor = QgodNeighborData;
+        neighKrnl.T = TData;
+        neighKrnl.Tinv = TinvData;
+        neighKrnl.star(0) = ATtildeData;
+        if (faceType == FaceType::dirichlet || faceType == FaceType::freeSurfaceGravity) {
+          neighKrnl.Tinv = init::identityT::Values;
+        }
+        neighKrnl.execute();
+
+        // compressed
+        real AplusT[tensor::AplusT::size()];
+        real AminusT[tensor::AminusT::size()];
+        kernels::computeLocalFluxSolver(table, localIntegration, side, AplusT);
+        kernels::computeNeighborFluxSolver(table, localIntegration, faceType, side, AminusT);
+
+        requireRelativelyClose(expectedAplusT, AplusT);
+        requireRelativelyClose(expectedAminusT, AminusT);
+      }
+    }
+  }
+
+  // every material and every combination with a face type is stored once; the sides of each
+  // tetrahedron cycle through all neighbouring materials, hence every combination occurs
+  REQUIRE(table.jacobians.size() == materials.size());
+  REQUIRE(table.fluxSolvers.size() == materials.size() * materials.size() * std::size(FaceTypes));
+}
+
+TEST_CASE("Compressed star matrices of a scaled reference tetrahedron") {
+  // the reference coordinates are the global ones divided by h, hence the star matrices are the
+  // transposed Jacobians divided by h
+  constexpr double H = 0.25;
+  real x[4] = {0.0, H, 0.0, 0.0};
+  real y[4] = {0.0, 0.0, H, 0.0};
+  real z[4] = {0.0, 0.0, 0.0, H};
+
+  model::ElasticMaterial material;
+  material.rho = 2670.0;
+  material.mu = 3.204e10;
+  material.lambda = 3.2059e10;
+
+  CellMatrixTable table;
+  initializers::CellMatrixTableBuilder builder(table);
+  LocalIntegrationData localIntegration{};
+  localIntegration.jacobianId = builder.addMaterial(material);
+  transformations::tetrahedronGlobalToReferenceJacobian(x,
+                                                        y,
+                                                        z,
+                                                        localIntegration.gradients[0],
+                                                        localIntegration.gradients[1],
+                                                        localIntegration.gradients[2]);
+
+  real starMatrices[3][tensor::star::size(0)];
+  kernels::assembleStarMatrices(table, localIntegration, starMatrices);
+
+  for (unsigned dim = 0; dim < 3; ++dim) {
+    CAPTURE(dim);
+    real jacobianData[tensor::star::size(0)] = {};
+    auto jacobian = init::star::view<0>::create(jacobianData);
+    model::getTransposedCoefficientMatrix(material, dim, jacobian);
+    real expected[tensor::star::size(0)];
+    for (unsigned idx = 0; idx < tensor::star::size(0); ++idx) {
+      expected[idx] = jacobianData[idx] / H;
+    }
+    requireRelativelyClose(expected, starMatrices[dim]);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -2,6 +2,10 @@
 
 #include "PointSourceCluster.t.h"
 
+#ifdef USE_COMPRESSED_CELL_MATRICES
+#include "CompressedCellMatrices.t.h"
+#endif // USE_COMPRESSED_CELL_MATRICES
+
 #ifdef USE_POROELASTIC
 #include "STP.t.h"
 #endif // USE_POROELASTIC
@@ -45,5 +45,15 @@ TEST_CASE("Dr tuner") {
     }
     REQUIRE(batchSize == AbsApprox(midPoint).epsilon(eps));
   }
+
+  SUBCASE("Seeded batch size skips the search") {
+    tuner.seed(317.0);
+    REQUIRE(tuner.isTunerConverged());
+    REQUIRE(tuner.getBatchSize() == 317);
+
+    timing[ComputeStageId] = 1.0;
+    tuner.tune(timing);
+    REQUIRE(tuner.getBatchSize() == 317);
+  }
 }
 } // namespace seissol::unit_test
@@ -3,3 +3,4 @@
 
 #include "ReceiverWriter.t.h"
 
+#include "WaveFieldCompressor.t.h"
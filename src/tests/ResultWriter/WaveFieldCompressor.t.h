@@ -0,0 +1,47 @@
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "ResultWriter/WaveFieldCompressor.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Wave field quantization is bounded relative to each variable") {
+  constexpr double Tolerance = 1e-4;
+  seissol::writer::WaveFieldCompressor compressor;
+  compressor.init(seissol::initializer::parameters::WaveFieldCompression::Quantize, Tolerance);
+
+  std::mt19937 generator(9);
+  std::uniform_real_distribution<double> unit(-1.0, 1.0);
+
+  // stresses (Pa) and particle velocities (m/s) differ by ten orders of magnitude
+  for (const double magnitude : {1e7, 1e-3, 1e-12}) {
+    CAPTURE(magnitude);
+    std::vector<real> data(1000);
+    for (auto& value : data) {
+      value = magnitude * unit(generator);
+    }
+    data[0] = magnitude;
+
+    const real* quantized = compressor.compress(data.data(), data.size());
+
+    unsigned numberOfChangedValues = 0;
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      REQUIRE(std::abs(quantized[i] - data[i]) <= Tolerance * magnitude);
+      numberOfChangedValues += (quantized[i] != data[i]) ? 1 : 0;
+    }
+    // the small variables are quantized as well instead of being rounded to zero
+    REQUIRE(numberOfChangedValues > data.size() / 2);
+    REQUIRE(quantized[0] != 0.0);
+  }
+
+  SUBCASE("Zeros are kept") {
+    std::vector<real> zeros(10, 0.0);
+    const real* quantized = compressor.compress(zeros.data(), zeros.size());
+    for (std::size_t i = 0; i < zeros.size(); ++i) {
+      REQUIRE(quantized[i] == 0.0);
+    }
+  }
+}
+
+} // namespace seissol::unit_test